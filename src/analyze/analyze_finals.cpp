@@ -1,5 +1,10 @@
 #include "analyze_finals.h"
 
+#include <algorithm>
+#include <limits>
+
+#include "common/arena.h"
+
 // 初始化静态向量，按照 ast::SvCompOp 枚举顺序映射到 CompOp
 // ast::SvCompOp: SV_OP_EQ, SV_OP_NE, SV_OP_LT, SV_OP_GT, SV_OP_LE, SV_OP_GE, SV_OP_IN, SV_OP_NOT_IN
 std::vector<CompOp> Analyze::CompOpMap = {
@@ -17,7 +22,7 @@ std::shared_ptr<Query> Analyze::do_analyze(std::shared_ptr<ast::TreeNode> parse)
 {
     const auto &db_ = sm_manager_->db_;
 
-    std::shared_ptr<Query> query = std::make_shared<Query>();
+    std::shared_ptr<Query> query = make_arena_shared<Query>();
     switch (parse->type)
     {
     case ast::SelectStmtNode:
@@ -63,12 +68,15 @@ std::shared_ptr<Query> Analyze::do_analyze(std::shared_ptr<ast::TreeNode> parse)
             }
         }
 
+        // WHERE（先于 HAVING 处理，使 params 保持字面量在文本中的顺序）
+        get_clause(x->conds, *query);
+        check_clause(query->tables, query->conds);
+
         // GROUP BY / HAVING
-        get_having(x->group_by, query->having_conds, only_one_table ? query->tables[0] : std::string{}, query->cols);
+        get_having(x->group_by, query->having_conds, only_one_table ? query->tables[0] : std::string{}, query->cols, query->params);
 
-        // WHERE
-        get_clause(x->conds, query->conds);
-        check_clause(query->tables, query->conds);
+        // LIMIT / OFFSET 的 VALUE_INT 允许带符号，负数在这里拒绝
+        if (x->limit != nullptr && (x->limit->count < 0 || x->limit->offset < 0)) throw RMDBError();
         break;
     }
     case ast::UpdateStmtNode:
@@ -83,8 +91,12 @@ std::shared_ptr<Query> Analyze::do_analyze(std::shared_ptr<ast::TreeNode> parse)
         // 处理需要更新的列和值
         for (const auto &set_clause : x->set_clauses)
         {
+            auto &col = tab->get_col(set_clause->col_name);
+
             // 使用局部变量来避免多次创建对象
-            SetClause update_clause(convert_sv_value(set_clause->val));
+            SetClause update_clause(set_clause->val->type == ast::ParamLitNode ? make_param(col.type, *query) : convert_sv_value(set_clause->val));
+            update_clause.param_idx = static_cast<int>(query->params.size());
+            query->params.push_back(update_clause.rhs);
 
             if (set_clause->self_update)
             {
@@ -95,22 +107,8 @@ std::shared_ptr<Query> Analyze::do_analyze(std::shared_ptr<ast::TreeNode> parse)
                 update_clause.op = UpdateOp::ASSINGMENT;
             }
 
-            // 类型转换
-
-            auto &col = tab->get_col(set_clause->col_name);
-
             // 如果类型不匹配，进行类型转换
-            if (col.type != update_clause.rhs.type)
-            {
-                if (!can_cast_type(update_clause.rhs.type, col.type))
-                {
-                    throw RMDBError();
-                }
-                else
-                {
-                    cast_value(update_clause.rhs, col.type);
-                }
-            }
+            bind_set_value(update_clause.rhs, col);
 
             // 将更新的 SetClause 添加到 query 中
             update_clause.lhs = std::make_unique<ColMeta>(col);
@@ -118,7 +116,7 @@ std::shared_ptr<Query> Analyze::do_analyze(std::shared_ptr<ast::TreeNode> parse)
         }
 
         // 处理where条件
-        get_clause(x->conds, query->conds);
+        get_clause(x->conds, *query);
         check_clause(query->tables, query->conds);
         break;
     }
@@ -135,7 +133,7 @@ std::shared_ptr<Query> Analyze::do_analyze(std::shared_ptr<ast::TreeNode> parse)
         }
 
         // 处理where条件
-        get_clause(x->conds, query->conds);
+        get_clause(x->conds, *query);
         check_clause(query->tables, query->conds);
         break;
     }
@@ -151,10 +149,24 @@ std::shared_ptr<Query> Analyze::do_analyze(std::shared_ptr<ast::TreeNode> parse)
             throw RMDBError();
         }
 
-        // 处理insert的values值
-        for (auto &sv_val : x->vals)
+        // 处理insert的values值，多行按行依次展开，列数和字符串长度在这里检查，避免写越界
+        const auto tab = sm_manager_->db_.get_table(x->tab_name);
+        query->values.reserve(x->rows.size() * tab->cols.size());
+        for (auto &row : x->rows)
         {
-            //query->values.emplace_back(convert_sv_value(sv_val));
+            if (row.size() != tab->cols.size())
+            {
+                throw RMDBError();
+            }
+            for (size_t i = 0; i < row.size(); ++i)
+            {
+                query->values.emplace_back(convert_sv_value(row[i]));
+                auto &val = query->values.back();
+                if (val.type == TYPE_STRING && static_cast<int>(val.str_val.size()) > tab->cols[i].len)
+                {
+                    throw RMDBError();
+                }
+            }
         }
         break;
     }
@@ -199,7 +211,7 @@ void Analyze::get_all_cols(const std::vector<std::string> &tab_names, std::vecto
 }
 
 
-void Analyze::get_having(std::shared_ptr<ast::GroupBy> &group_by, std::vector<HavingCond> &having_conds, const std::string &table_name, const std::vector<TabCol> &select_cols)
+void Analyze::get_having(std::shared_ptr<ast::GroupBy> &group_by, std::vector<HavingCond> &having_conds, const std::string &table_name, const std::vector<TabCol> &select_cols, std::vector<Value> &params)
 {
     bool has_non_agg_col = false;
     bool has_agg_func = false;
@@ -277,6 +289,8 @@ void Analyze::get_having(std::shared_ptr<ast::GroupBy> &group_by, std::vector<Ha
         {
             auto rhs_val = std::static_pointer_cast<ast::Value>(expr->rhs);
             cond.rhs_val = convert_sv_value(rhs_val);
+            cond.param_idx = static_cast<int>(params.size());
+            params.push_back(cond.rhs_val);
             break;
         }
         default:
@@ -286,9 +300,29 @@ void Analyze::get_having(std::shared_ptr<ast::GroupBy> &group_by, std::vector<Ha
     }
 }
 
-void Analyze::get_clause(const std::vector<std::shared_ptr<ast::BinaryExpr>> &sv_conds,
-                         std::vector<Condition> &conds)
+Value Analyze::make_param(ColType type, Query &query)
+{
+    Value val;
+    switch (type)
+    {
+    case TYPE_INT:
+        val.set_int(0);
+        break;
+    case TYPE_FLOAT:
+        val.set_float(0);
+        break;
+    case TYPE_STRING:
+        val.set_str("");
+        break;
+    }
+    query.placeholders.push_back(query.params.size());
+    return val;
+}
+
+void Analyze::get_clause(const std::vector<std::shared_ptr<ast::BinaryExpr>> &sv_conds, Query &query)
 {
+    auto &conds = query.conds;
+    auto &params = query.params;
     conds.clear();
     conds.reserve(sv_conds.size());
 
@@ -304,6 +338,20 @@ void Analyze::get_clause(const std::vector<std::shared_ptr<ast::BinaryExpr>> &sv
 
         switch (expr->rhs->type)
         {
+        case ast::ParamLitNode:
+        {
+            // '?' 参数的类型取自左边的列，列的解析规则与 check_clause 相同
+            TabCol lhs_col = cond.lhs_col;
+            if (query.tables.size() == 1) {
+                lhs_col.tab_name = query.tables[0];
+            }
+            check_column(lhs_col);
+            cond.is_rhs_val = true;
+            cond.rhs_val = make_param(sm_manager_->db_.get_table(lhs_col.tab_name)->get_col(lhs_col.col_name).type, query);
+            cond.param_idx = static_cast<int>(params.size());
+            params.push_back(cond.rhs_val);
+            break;
+        }
         case ast::ValueNode:
         case ast::IntLitNode:
         case ast::FloatLitNode:
@@ -313,6 +361,8 @@ void Analyze::get_clause(const std::vector<std::shared_ptr<ast::BinaryExpr>> &sv
             cond.is_rhs_val = true;
             auto rhs_val = std::static_pointer_cast<ast::Value>(expr->rhs);
             cond.rhs_val = convert_sv_value(rhs_val);
+            cond.param_idx = static_cast<int>(params.size());
+            params.push_back(cond.rhs_val);
             break;
         }
         case ast::ColNode:
@@ -341,6 +391,10 @@ void Analyze::check_clause(const std::vector<std::string> &tab_names, std::vecto
         check_column(cond.lhs_col);
         if (!cond.is_rhs_val && !cond.is_subquery)
         {
+            if (tab_names.size() == 1 && cond.rhs_col.tab_name.empty())
+            {
+                cond.rhs_col.tab_name = tab_names[0];
+            }
             check_column(cond.rhs_col);
         }
 
@@ -349,25 +403,9 @@ void Analyze::check_clause(const std::vector<std::string> &tab_names, std::vecto
         auto lhs_col = lhs_tab->get_col(cond.lhs_col.col_name);
         cond.lhs = lhs_col;
 
-        ColType lhs_type = lhs_col.type;
-        ColType rhs_type;
-
         if (cond.is_rhs_val && !cond.is_subquery)
         {
-            cond.rhs_val.init_raw(lhs_col.len);
-            rhs_type = cond.rhs_val.type;
-
-            // Check if rhs_val can be cast to lhs_type
-            if (!can_cast_type(rhs_type, lhs_type))
-            {
-                throw RMDBError();
-            }
-
-            // Perform the cast if necessary
-            if (rhs_type != lhs_type)
-            {
-                cast_value(cond.rhs_val, lhs_type);
-            }
+            bind_cond_value(cond.rhs_val, lhs_col);
         }
         else if (!cond.is_subquery)
         {
@@ -375,9 +413,8 @@ void Analyze::check_clause(const std::vector<std::string> &tab_names, std::vecto
             auto rhs_tab = sm_manager_->db_.get_table(cond.rhs_col.tab_name);
             auto rhs_col = rhs_tab->get_col(cond.rhs_col.col_name);
             cond.rhs = rhs_col;
-            rhs_type = rhs_col.type;
 
-            if (lhs_type != rhs_type)
+            if (lhs_col.type != rhs_col.type)
             {
                 throw RMDBError();
             }
@@ -387,6 +424,35 @@ void Analyze::check_clause(const std::vector<std::string> &tab_names, std::vecto
     return;
 }
 
+void Analyze::bind_cond_value(Value &val, const ColMeta &col)
+{
+    // Check if val can be cast to the column type
+    if (!can_cast_type(val.type, col.type))
+    {
+        throw RMDBError();
+    }
+
+    // Perform the cast if necessary
+    if (val.type != col.type)
+    {
+        cast_value(val, col.type);
+    }
+    // 转换之后再按列类型生成 raw，索引扫描的边界直接使用这些字节
+    val.init_raw(col.len);
+}
+
+void Analyze::bind_set_value(Value &val, const ColMeta &col)
+{
+    if (col.type != val.type)
+    {
+        if (!can_cast_type(val.type, col.type))
+        {
+            throw RMDBError();
+        }
+        cast_value(val, col.type);
+    }
+}
+
 bool Analyze::can_cast_type(ColType from, ColType to)
 {
     // Add logic to determine if a type can be cast to another type
@@ -410,7 +476,12 @@ void Analyze::cast_value(Value &val, ColType to)
     }
     else if (val.type == TYPE_FLOAT && to == TYPE_INT)
     {
-        // do not things
+        // 截断取整，超出 INT 范围时取边界值；INT 列与 FLOAT 字面量的比较由 QueryRewriter::fold_constants 按比较运算符重新取整
+        double float_val = val.float_val;
+        float_val = std::max<double>(float_val, std::numeric_limits<int>::min());
+        float_val = std::min<double>(float_val, std::numeric_limits<int>::max());
+        val.type = TYPE_INT;
+        val.int_val = static_cast<int>(float_val);
     }
     else
     {
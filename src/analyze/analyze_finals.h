@@ -23,11 +23,25 @@ public:
     std::vector<std::string> tables;
     // update 的set 值
     std::vector<SetClause> set_clauses;
-    // insert 的values值
-    //std::vector<Value> values;
+    // insert 的values值，多行时按行依次展开
+    std::vector<Value> values;
 
     std::vector<HavingCond> having_conds;
 
+    // 语句中的字面量，按在 SQL 文本中出现的顺序排列（类型转换前），
+    // 条件和 set 子句通过 param_idx 指向这里，计划缓存据此重新绑定参数
+    std::vector<Value> params;
+    // params 中由 '?' 参数占位的下标，只允许出现在 PREPARE 语句里
+    std::vector<size_t> placeholders;
+
+    // 以下由逻辑优化填写
+    // PREPARE 的计划要用不同参数反复执行，不能做依赖字面量取值的改写
+    bool prepared = false;
+    // WHERE 恒假，每张表都不用扫描
+    bool always_false = false;
+    // 计划需要读取的列
+    std::vector<TabCol> required_cols;
+
     Query() {}
 };
 
@@ -44,6 +58,13 @@ public:
     // 静态向量映射 ast::SvCompOp 到 CompOp，按照 ast::SvCompOp 枚举顺序
     static std::vector<CompOp> CompOpMap;
 
+    // 把字面量转换成列的类型，条件右值还需要按列长生成 raw，计划缓存绑定参数时复用
+    static void bind_cond_value(Value &val, const ColMeta &col);
+
+    static void bind_set_value(Value &val, const ColMeta &col);
+
+    Value convert_sv_value(const std::shared_ptr<ast::Value> &sv_val);
+
 private:
 
 private:
@@ -51,15 +72,15 @@ private:
 
     void get_all_cols(const std::vector<std::string> &tab_names, std::vector<ColMeta> &all_cols);
 
-    void get_clause(const std::vector<std::shared_ptr<ast::BinaryExpr>> &sv_conds, std::vector<Condition> &conds);
+    void get_clause(const std::vector<std::shared_ptr<ast::BinaryExpr>> &sv_conds, Query &query);
 
-    void check_clause(const std::vector<std::string> &tab_names, std::vector<Condition> &conds);
+    Value make_param(ColType type, Query &query);
 
-    Value convert_sv_value(const std::shared_ptr<ast::Value> &sv_val);
+    void check_clause(const std::vector<std::string> &tab_names, std::vector<Condition> &conds);
 
     static bool can_cast_type(ColType from, ColType to);
 
     static void cast_value(Value &val, ColType to);
 
-    void get_having(std::shared_ptr<ast::GroupBy> &group_by, std::vector<HavingCond> &having_conds, const std::string &table_name, const std::vector<TabCol> &select_cols);
+    void get_having(std::shared_ptr<ast::GroupBy> &group_by, std::vector<HavingCond> &having_conds, const std::string &table_name, const std::vector<TabCol> &select_cols, std::vector<Value> &params);
 };
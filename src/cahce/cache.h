@@ -5,185 +5,530 @@
 #ifndef RMDB_CACHE_H
 #define RMDB_CACHE_H
 
+#include <strings.h>
+
+#include <cctype>
+#include <cstdlib>
 #include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
 #include "defs_finals.h"
 #include "system/sm_manager_finals.h"
 #include "common/context_finals.h"
 #include "errors_finals.h"
 #include "transaction/txn_defs_finals.h"
+#include "execution/execution_manager_finals.h"
+#include "execution/executor_delete_finals.h"
+#include "execution/executor_insert_finals.h"
+#include "execution/executor_update_finals.h"
+
+// 语句模板匹配用的手写扫描器，只识别快速路径需要的记号。
+// 注释、未知字符等一律产生 BAD，模板匹配失败后回退到完整流程，
+// 数值的切分和转换与 lex.l 保持一致（带符号的数字是一个字面量，atoi/atof 转换）。
+class FastScanner {
+public:
+    enum Kind { END, WORD, INT, FLOAT, STRING, SYMBOL, BAD };
+
+    explicit FastScanner(const char *sql) : cur_(sql) {
+        advance();
+    }
+
+    // 关键字大小写不敏感
+    bool keyword(const char *kw) {
+        if (kind_ != WORD || strlen(kw) != len_ || strncasecmp(str_, kw, len_) != 0) {
+            return false;
+        }
+        advance();
+        return true;
+    }
 
+    // 标识符区分大小写
+    bool identifier(std::string &out) {
+        if (kind_ != WORD) {
+            return false;
+        }
+        out.assign(str_, len_);
+        advance();
+        return true;
+    }
+
+    bool symbol(char c) {
+        if (kind_ != SYMBOL || *str_ != c) {
+            return false;
+        }
+        advance();
+        return true;
+    }
+
+    bool literal(Value &out) {
+        switch (kind_) {
+            case INT:
+                out.set_int(atoi(str_));
+                break;
+            case FLOAT:
+                out.set_float(static_cast<float>(atof(str_)));
+                break;
+            case STRING:
+                out.set_str(std::string(str_ + 1, len_ - 2));
+                break;
+            default:
+                return false;
+        }
+        advance();
+        return true;
+    }
+
+    // 可选的分号之后只允许空白，一次只接受一条语句
+    bool finish() {
+        symbol(';');
+        return kind_ == END;
+    }
+
+private:
+    void advance() {
+        while (*cur_ == ' ' || *cur_ == '\t' || *cur_ == '\r' || *cur_ == '\n') ++cur_;
+        str_ = cur_;
+        auto c = static_cast<unsigned char>(*cur_);
+        const char *end = cur_ + 1;
+        if (c == '\0') {
+            kind_ = END;
+            end = cur_;
+        } else if (isalpha(c)) {
+            kind_ = WORD;
+            while (isalnum(static_cast<unsigned char>(*end)) || *end == '_') ++end;
+        } else if (isdigit(c) || ((c == '+' || c == '-') && isdigit(static_cast<unsigned char>(cur_[1])))) {
+            kind_ = INT;
+            while (isdigit(static_cast<unsigned char>(*end))) ++end;
+            if (*end == '.') {
+                kind_ = FLOAT;
+                ++end;
+                while (isdigit(static_cast<unsigned char>(*end))) ++end;
+            }
+        } else if (c == '\'') {
+            while (*end != '\'' && *end != '\0') ++end;
+            if (*end == '\0') {
+                kind_ = BAD;
+            } else {
+                kind_ = STRING;
+                ++end;
+            }
+        } else if ((c == '-' && cur_[1] == '-') || (c == '/' && cur_[1] == '*')) {
+            kind_ = BAD;
+        } else if (strchr("(),*=;.+-/", c) != nullptr) {
+            kind_ = SYMBOL;
+        } else {
+            kind_ = BAD;
+        }
+        len_ = end - str_;
+        // BAD 之后不再前进，后续所有匹配都会失败
+        if (kind_ != BAD) {
+            cur_ = end;
+        }
+    }
+
+    const char *cur_;
+    Kind kind_ = END;
+    const char *str_ = nullptr;
+    size_t len_ = 0;
+};
+
+// 按完整索引键找到的至多一条记录，cols 为投影后的列，偏移仍指向整条记录
+class PointLookupExecutor : public AbstractExecutor {
+public:
+    PointLookupExecutor(RmFileHandle *fh, char *rid, std::vector<ColMeta> cols)
+        : fh_(fh), rid_(rid), cols_(std::move(cols)) {
+    }
+
+    const std::vector<ColMeta> &cols() const override { return cols_; }
+
+    void beginTuple() override { end_ = rid_ == nullptr; }
+
+    void nextTuple() override { end_ = true; }
+
+    bool is_end() const override { return end_; }
+
+    char *rid() const override { return rid_; }
+
+    std::unique_ptr<RmRecord> Next() override { return fh_->get_record(rid_); }
+
+    // 直接把记录指针放进批次，不复制
+    size_t NextBatch(TupleBatch &batch) override {
+        batch.clear();
+        if (!end_) {
+            batch.append(rid_);
+            end_ = true;
+        }
+        return batch.sel_size;
+    }
+
+private:
+    RmFileHandle *fh_;
+    char *rid_;
+    std::vector<ColMeta> cols_;
+    bool end_ = true;
+};
+
+// 热点 OLTP 语句的快速路径：按首个关键字分派到注册的语句模板，
+// 命中的语句跳过解析、语义分析和优化，直接操作 IxIndexHandle / RmFileHandle。
+// 模板只接受能与完整流程得到相同结果的语句，类型不一致、字符串超长、
+// 列不存在等情况都返回 false，由完整流程负责报错。
 class DBCahce {
 public:
-    explicit DBCahce(SmManager *sm_manager) : sm_manager(sm_manager) {
+    DBCahce(SmManager *sm_manager, QlManager *ql_manager) : sm_manager(sm_manager), ql_manager(ql_manager) {
+        templates_ = {
+            {"insert", &DBCahce::do_insert_cache},
+            {"select", &DBCahce::do_select_cache},
+            {"update", &DBCahce::do_update_cache},
+            {"delete", &DBCahce::do_delete_cache},
+            {"begin", &DBCahce::do_begin_cache},
+            {"commit", &DBCahce::do_commit_cache},
+        };
     }
 
+    // 命中模板时执行语句并返回 true，否则返回 false 且没有任何副作用
     bool has_cache(const char *sql, Context *ctx) const;
 
-    void do_insert_cache(const char *sql, Context *ctx) const;
+    SmManager *sm_manager;
+    QlManager *ql_manager;
+
+private:
+    // 模板在确认整条语句匹配之前不能产生副作用
+    using Template = bool (DBCahce::*)(FastScanner &, Context *) const;
 
-    static void do_begin_cache(Context *ctx);
+    struct TemplateEntry {
+        const char *keyword;
+        Template match;
+    };
 
-    static void do_commit_cache(Context *ctx);
+    bool do_insert_cache(FastScanner &scan, Context *ctx) const;
 
-    SmManager *sm_manager;
+    bool do_select_cache(FastScanner &scan, Context *ctx) const;
+
+    bool do_update_cache(FastScanner &scan, Context *ctx) const;
+
+    bool do_delete_cache(FastScanner &scan, Context *ctx) const;
+
+    bool do_begin_cache(FastScanner &scan, Context *ctx) const;
+
+    bool do_commit_cache(FastScanner &scan, Context *ctx) const;
+
+    TabMeta *match_table(FastScanner &scan) const;
+
+    static const ColMeta *match_column(FastScanner &scan, TabMeta *tab);
+
+    bool match_point_key(FastScanner &scan, TabMeta *tab, char *&rid) const;
+
+    std::vector<TemplateEntry> templates_;
 };
 
 inline bool DBCahce::has_cache(const char *sql, Context *ctx) const {
-    switch (sql[0]) {
-        case 'i': {
-            do_insert_cache(sql, ctx);
-            return true;
-        }
-        case 'c': {
-            if (sql[1] == 'o') {
-                do_commit_cache(ctx);
-                return true;
-            }
-            return false;
-        }
-        case 'b': {
-            do_begin_cache(ctx);
-            return true;
-        }
-        default: {
-            return false;
+    FastScanner scan(sql);
+    for (auto &entry: templates_) {
+        if (scan.keyword(entry.keyword)) {
+            return (this->*entry.match)(scan, ctx);
         }
     }
+    return false;
 }
 
-inline void DBCahce::do_begin_cache(Context *ctx) {
-    ctx->txn_->txn_mode_ = true; // Set the transaction mode to false
+inline TabMeta *DBCahce::match_table(FastScanner &scan) const {
+    std::string tab_name;
+    if (!scan.identifier(tab_name)) {
+        return nullptr;
+    }
+    auto pos = sm_manager->db_.tabs_.find(tab_name);
+    return pos == sm_manager->db_.tabs_.end() ? nullptr : pos->second.get();
 }
 
-inline void DBCahce::do_commit_cache(Context *ctx) {
-    ctx->txn_->txn_mode_ = false; // Commit the transaction
+// col 或 tab.col
+inline const ColMeta *DBCahce::match_column(FastScanner &scan, TabMeta *tab) {
+    std::string col_name;
+    if (!scan.identifier(col_name)) {
+        return nullptr;
+    }
+    if (scan.symbol('.')) {
+        if (col_name != tab->name_ || !scan.identifier(col_name)) {
+            return nullptr;
+        }
+    }
+    auto pos = tab->cols_idx_.find(col_name);
+    return pos == tab->cols_idx_.end() ? nullptr : &pos->second;
 }
 
-inline void DBCahce::do_insert_cache(const char *sql, Context *ctx) const {
-    int now_lex = 12; // Skip over "insert into "
-    std::string table_name;
-
-    // Direct table name parsing without creating intermediate strings
-    while (sql[now_lex] != ' ' && sql[now_lex] != '\0') {
-        table_name += sql[now_lex++];
+// 匹配 "where c1 = v1 and c2 = v2 ... [;]"，等值列必须恰好是表上某个索引的全部列，
+// 成功时 rid 为找到的记录（不存在时为 nullptr）
+inline bool DBCahce::match_point_key(FastScanner &scan, TabMeta *tab, char *&rid) const {
+    if (!scan.keyword("where")) {
+        return false;
+    }
+    std::vector<std::pair<const ColMeta *, Value> > conds;
+    do {
+        Value val;
+        auto col = match_column(scan, tab);
+        if (col == nullptr || !scan.symbol('=') || !scan.literal(val) || val.type != col->type) {
+            return false;
+        }
+        if (col->type == TYPE_STRING && static_cast<int>(val.str_val.size()) > col->len) {
+            return false;
+        }
+        for (auto &cond: conds) {
+            if (cond.first->name == col->name) {
+                return false;
+            }
+        }
+        conds.emplace_back(col, std::move(val));
+    } while (scan.keyword("and"));
+    if (!scan.finish()) {
+        return false;
     }
 
-    // Skip spaces and "values"
-    while (sql[now_lex] == ' ') ++now_lex;
-    now_lex += 6;
-    while (sql[now_lex] == ' ' || sql[now_lex] == '(') ++now_lex;
-
-    const auto tab = sm_manager->db_.get_table(table_name);
-    const auto fh_ = sm_manager->fhs_[tab->fd_].get();
-    char *insert_data = sm_manager->memory_pool_manager_->allocate(fh_->record_size);
-
-    // Efficient data parsing using direct index manipulation
-    for (size_t col_idx = 0; col_idx < tab->cols.size(); ++col_idx) {
-        const auto &col = tab->cols[col_idx];
-        char *col_data = insert_data + col.offset;
-
-        // Skip leading spaces
-        while (sql[now_lex] == ' ') ++now_lex;
-
-        // Directly handle each column type efficiently
-        switch (col.type) {
-            case TYPE_INT: {
-                int value = 0;
-                bool negative = false;
-                if (sql[now_lex] == '-') {
-                    negative = true;
-                    ++now_lex; // Skip the negative sign
+    for (auto &index: tab->indexes) {
+        if (index.cols_.size() != conds.size()) {
+            continue;
+        }
+        std::vector<char> key(sm_manager->fhs_[tab->fd_]->record_size, 0);
+        size_t matched = 0;
+        for (auto &index_col: index.cols_) {
+            for (auto &cond: conds) {
+                if (cond.first->name != index_col.name) {
+                    continue;
                 }
-                // Manually parse the integer
-                while (sql[now_lex] >= '0' && sql[now_lex] <= '9') {
-                    value = value * 10 + (sql[now_lex] - '0');
-                    ++now_lex;
+                char *dst = key.data() + index_col.offset;
+                auto &val = cond.second;
+                if (val.type == TYPE_INT) {
+                    std::memcpy(dst, &val.int_val, sizeof(int));
+                } else if (val.type == TYPE_FLOAT) {
+                    std::memcpy(dst, &val.float_val, sizeof(float));
+                } else {
+                    std::memcpy(dst, val.str_val.data(), val.str_val.size());
                 }
-                if (negative) value = -value; // Apply the negative sign if needed
-                std::memcpy(col_data, &value, sizeof(value));
+                ++matched;
                 break;
             }
-            case TYPE_FLOAT: {
-                bool negative = false;
-                if (sql[now_lex] == '-') {
-                    negative = true;
-                    ++now_lex; // Skip the negative sign
-                }
+        }
+        if (matched != conds.size()) {
+            continue;
+        }
+        auto ih = sm_manager->ihs_[index.fd_].get();
+        auto it = ih->find_entry(key.data());
+        rid = it == ih->end() ? nullptr : *it;
+        return true;
+    }
+    return false;
+}
 
-                // Parse integer part
-                double integer_part = 0.0;
-                while (sql[now_lex] >= '0' && sql[now_lex] <= '9') {
-                    integer_part = integer_part * 10.0 + (sql[now_lex] - '0');
-                    ++now_lex;
+// select * | c1, c2, ... from t where <完整索引键>
+inline bool DBCahce::do_select_cache(FastScanner &scan, Context *ctx) const {
+    std::vector<std::pair<std::string, std::string> > names; // 为空表示 *
+    if (!scan.symbol('*')) {
+        do {
+            std::string tab_name, col_name;
+            if (!scan.identifier(col_name)) {
+                return false;
+            }
+            if (scan.symbol('.')) {
+                tab_name = std::move(col_name);
+                if (!scan.identifier(col_name)) {
+                    return false;
                 }
+            }
+            names.emplace_back(std::move(tab_name), std::move(col_name));
+        } while (scan.symbol(','));
+    }
+    if (!scan.keyword("from")) {
+        return false;
+    }
+    auto tab = match_table(scan);
+    if (tab == nullptr) {
+        return false;
+    }
 
-                double value = integer_part;
+    std::vector<ColMeta> cols;
+    if (names.empty()) {
+        cols = tab->cols;
+    } else {
+        for (auto &name: names) {
+            auto pos = tab->cols_idx_.find(name.second);
+            if ((!name.first.empty() && name.first != tab->name_) || pos == tab->cols_idx_.end()) {
+                return false;
+            }
+            cols.push_back(pos->second);
+        }
+    }
 
-                // Parse fractional part if exists
-                if (sql[now_lex] == '.') {
-                    now_lex++; // Skip decimal point
-                    double fractional_part = 0.0;
-                    double decimal_place = 0.1;
+    char *rid = nullptr;
+    if (!match_point_key(scan, tab, rid)) {
+        return false;
+    }
 
-                    while (sql[now_lex] >= '0' && sql[now_lex] <= '9') {
-                        fractional_part += (sql[now_lex] - '0') * decimal_place;
-                        decimal_place *= 0.1;
-                        ++now_lex;
-                    }
-                    value += fractional_part;
-                }
+    std::vector<TabCol> sel_cols;
+    sel_cols.reserve(cols.size());
+    for (auto &col: cols) {
+        sel_cols.push_back({tab->name_, col.name, "", ast::default_type});
+    }
+    auto fh = sm_manager->fhs_[tab->fd_].get();
+    ql_manager->select_from(std::make_unique<PointLookupExecutor>(fh, rid, std::move(cols)), sel_cols, ctx);
+    return true;
+}
 
-                if (negative) value = -value; // Apply the negative sign if needed
-                float float_value = static_cast<float>(value);
-                std::memcpy(col_data, &float_value, sizeof(float_value));
-                break;
+// update t set c = v | c = c op v [, ...] where <完整索引键>
+inline bool DBCahce::do_update_cache(FastScanner &scan, Context *ctx) const {
+    auto tab = match_table(scan);
+    if (tab == nullptr || !scan.keyword("set")) {
+        return false;
+    }
+
+    std::vector<SetClause> set_clauses;
+    do {
+        auto col = match_column(scan, tab);
+        if (col == nullptr || !scan.symbol('=')) {
+            return false;
+        }
+        Value val;
+        UpdateOp op = ASSINGMENT;
+        if (!scan.literal(val)) {
+            // 自更新：c = c + v，或 c = c -1 这种带符号字面量的写法（按加法处理，同 yacc.y）
+            auto rhs_col = match_column(scan, tab);
+            if (rhs_col == nullptr || rhs_col->name != col->name) {
+                return false;
             }
-            case TYPE_STRING: {
-                ++now_lex; // Skip opening quote
-                int start_lex = now_lex;
-                while (sql[now_lex] != '\'' && sql[now_lex] != '\0') {
-                    ++now_lex;
-                }
-                int len = now_lex - start_lex;
-                std::memcpy(col_data, &sql[start_lex], len);
-                *(col_data + len) = '\0'; // Null terminate
-                ++now_lex; // Skip closing quote
-                break;
+            if (scan.symbol('+')) {
+                op = SELF_ADD;
+            } else if (scan.symbol('-')) {
+                op = SELF_SUB;
+            } else if (scan.symbol('*')) {
+                op = SELF_MUT;
+            } else if (scan.symbol('/')) {
+                op = SELF_DIV;
+            } else {
+                op = SELF_ADD;
             }
-            default: {
-                break;
+            if (!scan.literal(val) || col->type == TYPE_STRING) {
+                return false;
             }
         }
-
-        // Skip trailing spaces and comma (if not the last column)
-        while (sql[now_lex] == ' ') ++now_lex;
-        if (col_idx < tab->cols.size() - 1 && sql[now_lex] == ',') {
-            ++now_lex; // Skip comma
-            while (sql[now_lex] == ' ') ++now_lex; // Skip spaces after comma
+        if ((val.type == TYPE_STRING) != (col->type == TYPE_STRING) ||
+            (col->type == TYPE_STRING && static_cast<int>(val.str_val.size()) > col->len)) {
+            return false;
+        }
+        // 数值之间的转换与 Analyze::bind_set_value 相同
+        if (val.type == TYPE_INT && col->type == TYPE_FLOAT) {
+            val.set_float(static_cast<float>(val.int_val));
+        } else if (val.type == TYPE_FLOAT && col->type == TYPE_INT) {
+            val.set_int(static_cast<int>(val.float_val));
         }
+        SetClause set_clause(std::move(val));
+        set_clause.lhs = std::make_shared<ColMeta>(*col);
+        set_clause.op = op;
+        set_clauses.push_back(std::move(set_clause));
+    } while (scan.symbol(','));
+
+    char *rid = nullptr;
+    if (!match_point_key(scan, tab, rid)) {
+        return false;
+    }
+    if (rid != nullptr) {
+        UpdateExecutor(sm_manager, tab->name_, std::move(set_clauses), {rid}, ctx);
     }
+    return true;
+}
 
-    // Stage 3: Insert data into indexes and record file
-    const auto &indexes = tab->indexes;
-    if (IxIndexHandle::unique_check) {
-        for (auto &index: indexes) {
-            auto ih = sm_manager->ihs_[index.fd_].get();
-            if (ih->exists_entry(insert_data)) {
-                sm_manager->memory_pool_manager_->deallocate(insert_data, fh_->record_size);
-                throw IndexEntryAlreadyExistError();
-            }
-        }
+// delete from t where <完整索引键>
+inline bool DBCahce::do_delete_cache(FastScanner &scan, Context *ctx) const {
+    if (!scan.keyword("from")) {
+        return false;
+    }
+    auto tab = match_table(scan);
+    char *rid = nullptr;
+    if (tab == nullptr || !match_point_key(scan, tab, rid)) {
+        return false;
+    }
+    if (rid != nullptr) {
+        DeleteExecutor(sm_manager, tab->name_, {rid}, ctx);
+    }
+    return true;
+}
+
+inline bool DBCahce::do_begin_cache(FastScanner &scan, Context *ctx) const {
+    if (!scan.finish()) {
+        return false;
     }
+    ctx->txn_->txn_mode_ = true;
+    return true;
+}
 
-    // Parallelize index insertion (if possible)
-    for (auto &index: indexes) {
-        auto ih = sm_manager->ihs_[index.fd_].get();
-        ih->insert_entry(insert_data);
+inline bool DBCahce::do_commit_cache(FastScanner &scan, Context *ctx) const {
+    if (!scan.finish()) {
+        return false;
+    }
+    ctx->txn_->txn_mode_ = false;
+    return true;
+}
+
+// insert into t values (v1, ...) [, (v1, ...)]*
+inline bool DBCahce::do_insert_cache(FastScanner &scan, Context *ctx) const {
+    if (!scan.keyword("into")) {
+        return false;
+    }
+    auto tab = match_table(scan);
+    if (tab == nullptr || !scan.keyword("values")) {
+        return false;
+    }
+    const auto fh_ = sm_manager->fhs_[tab->fd_].get();
+    auto pool = sm_manager->memory_pool_manager_;
+
+    // Stage 1: 先把所有行解析成记录，语句不匹配时释放已分配的记录并回退
+    std::vector<char *> rows;
+    auto release = [&](size_t from) {
+        for (size_t i = from; i < rows.size(); ++i) {
+            pool->deallocate(rows[i], fh_->record_size);
+        }
+        rows.resize(from);
+    };
+    do {
+        if (!scan.symbol('(')) {
+            release(0);
+            return false;
+        }
+        char *insert_data = pool->allocate(fh_->record_size);
+        std::memset(insert_data, 0, fh_->record_size);
+        rows.push_back(insert_data);
+        for (size_t col_idx = 0; col_idx < tab->cols.size(); ++col_idx) {
+            const auto &col = tab->cols[col_idx];
+            Value val;
+            if ((col_idx > 0 && !scan.symbol(',')) || !scan.literal(val)) {
+                release(0);
+                return false;
+            }
+            char *col_data = insert_data + col.offset;
+            if (col.type == TYPE_STRING && val.type == TYPE_STRING &&
+                static_cast<int>(val.str_val.size()) <= col.len) {
+                std::memcpy(col_data, val.str_val.data(), val.str_val.size());
+            } else if (col.type == TYPE_INT && val.type != TYPE_STRING) {
+                int value = val.type == TYPE_INT ? val.int_val : static_cast<int>(val.float_val);
+                std::memcpy(col_data, &value, sizeof(value));
+            } else if (col.type == TYPE_FLOAT && val.type != TYPE_STRING) {
+                float value = val.type == TYPE_FLOAT ? val.float_val : static_cast<float>(val.int_val);
+                std::memcpy(col_data, &value, sizeof(value));
+            } else {
+                release(0);
+                return false;
+            }
+        }
+        if (!scan.symbol(')')) {
+            release(0);
+            return false;
+        }
+    } while (scan.symbol(','));
+    if (!scan.finish()) {
+        release(0);
+        return false;
     }
 
-    // Insert into record file
-    fh_->insert_record(insert_data);
-    ctx->txn_->append_write_record(WriteType::INSERT_TUPLE, tab->fd_, insert_data);
+    // Stage 2: 整批做唯一性检查后写入索引和记录文件，冲突时整条语句不产生写入
+    InsertExecutor::insert_batch(sm_manager, tab, rows, ctx);
+    return true;
 }
 
 
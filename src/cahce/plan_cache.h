@@ -0,0 +1,436 @@
+#pragma once
+
+#include <cctype>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "analyze/analyze_finals.h"
+#include "optimizer/plan_finals.h"
+#include "system/sm_manager_finals.h"
+#include "../deps/parallel_hashmap/phmap.h"
+
+// 计划缓存的键：去掉字面量后的 SQL 文本加上各字面量的类型，字面量按出现顺序放在 params 里
+struct PlanCacheKey {
+    std::string sql;
+    std::vector<Value> params;
+    uint64_t schema_version = 0;
+};
+
+// PREPARE 生成的语句，保存在会话（Connection）中
+struct PreparedStatement {
+    std::string sql; // 语句文本，DDL 之后据此重新准备
+    std::shared_ptr<Plan> plan;
+    std::vector<Value> params; // 语句中的字面量，'?' 处为对应列类型的占位值
+    std::vector<size_t> placeholders;
+    uint64_t schema_version = 0;
+};
+
+// 自动计划缓存：select/update/delete 语句按归一化后的文本缓存执行计划，
+// 命中时跳过词法/语法分析、语义分析和优化，只需复制计划并重新绑定字面量。
+// 计划中每个字面量都通过 param_idx 指回 Query::params，DDL 会使 schema_version_ 变化从而使缓存失效。
+class PlanCache {
+public:
+    static constexpr size_t MAX_ENTRIES = 4096;
+
+    explicit PlanCache(SmManager *sm_manager) : sm_manager_(sm_manager) {}
+
+    // 归一化 SQL，返回 false 表示该语句不走计划缓存
+    bool make_key(const char *sql, PlanCacheKey &key) const {
+        key.schema_version = sm_manager_->schema_version_.load();
+        if (!normalize(sql, key.sql, key.params)) {
+            key.sql.clear();
+            return false;
+        }
+        // 分析器按字面量类型做转换和折叠，同一文本中 2 和 2.5 得到的计划不同，不能共用
+        key.sql += '#';
+        for (const auto &param: key.params) {
+            key.sql += type_tag(param.type);
+        }
+        return true;
+    }
+
+    // 命中时返回一份绑定了新字面量的计划，可以直接交给 Portal::start
+    std::shared_ptr<Plan> lookup(const PlanCacheKey &key) const {
+        std::shared_ptr<const Entry> entry;
+        {
+            std::shared_lock lock(mutex_);
+            auto it = plans_.find(key.sql);
+            if (it == plans_.end()) {
+                return nullptr;
+            }
+            entry = it->second;
+        }
+        if (entry->schema_version != key.schema_version || entry->num_params != key.params.size()) {
+            return nullptr;
+        }
+        return instantiate(entry->plan, key.params);
+    }
+
+    // 复制一份计划并绑定参数，类型不匹配时抛出 RMDBError
+    static std::shared_ptr<Plan> instantiate(const std::shared_ptr<Plan> &plan, const std::vector<Value> &params) {
+        auto copy = clone_plan(plan);
+        bind_params(copy, params);
+        return copy;
+    }
+
+    // 在 Portal::start 之前调用，返回 false 表示该计划无法重新绑定参数
+    static bool prepare(const Query &query, const std::shared_ptr<Plan> &plan, PreparedStatement &stmt) {
+        auto copy = clone_plan(plan);
+        if (copy == nullptr || !covers_params(copy, query.params.size())) {
+            return false;
+        }
+        stmt.plan = std::move(copy);
+        stmt.params = query.params;
+        stmt.placeholders = query.placeholders;
+        return true;
+    }
+
+    // 在 Portal::start 之前调用（start 会把计划中的条件 move 走）
+    void insert(const PlanCacheKey &key, const Query &query, const std::shared_ptr<Plan> &plan) {
+        if (!same_params(query.params, key.params)) {
+            // 分析器看到的字面量和文本中的不一致，无法可靠地重新绑定
+            return;
+        }
+        auto copy = clone_plan(plan);
+        if (copy == nullptr || !covers_params(copy, key.params.size()) || has_mixed_types(copy, key.params)) {
+            return;
+        }
+        auto entry = std::make_shared<Entry>();
+        entry->plan = std::move(copy);
+        entry->num_params = key.params.size();
+        entry->schema_version = key.schema_version;
+
+        std::unique_lock lock(mutex_);
+        if (plans_.size() >= MAX_ENTRIES) {
+            plans_.clear();
+        }
+        plans_[key.sql] = std::move(entry);
+    }
+
+private:
+    struct Entry {
+        std::shared_ptr<Plan> plan;
+        size_t num_params;
+        uint64_t schema_version;
+    };
+
+    struct Slots {
+        std::vector<Condition *> conds;
+        std::vector<SetClause *> set_clauses;
+        std::vector<HavingCond *> having_conds;
+    };
+
+    static char type_tag(ColType type) {
+        switch (type) {
+            case TYPE_INT:
+                return 'i';
+            case TYPE_FLOAT:
+                return 'f';
+            default:
+                return 's';
+        }
+    }
+
+    // 按 lex.l 的规则切分 token，字面量替换为 '?'，token 之间用一个空格分隔
+    static bool normalize(const char *sql, std::string &key, std::vector<Value> &params) {
+        key.clear();
+        params.clear();
+
+        const char *p = sql;
+        while (isspace(static_cast<unsigned char>(*p))) {
+            ++p;
+        }
+        if (strncasecmp(p, "select", 6) != 0 && strncasecmp(p, "update", 6) != 0 &&
+            strncasecmp(p, "delete", 6) != 0) {
+            return false;
+        }
+
+        while (*p != '\0') {
+            auto c = static_cast<unsigned char>(*p);
+            if (isspace(c)) {
+                ++p;
+                continue;
+            }
+            if (c == ';') {
+                // 只缓存单条语句
+                for (++p; *p != '\0'; ++p) {
+                    if (!isspace(static_cast<unsigned char>(*p))) {
+                        return false;
+                    }
+                }
+                key += ';';
+                return true;
+            }
+            if (!key.empty()) {
+                key += ' ';
+            }
+            if (isalpha(c)) {
+                const char *begin = p;
+                while (isalnum(static_cast<unsigned char>(*p)) || *p == '_') {
+                    ++p;
+                }
+                key.append(begin, p - begin);
+            } else if (isdigit(c) || ((c == '+' || c == '-') && isdigit(static_cast<unsigned char>(p[1])))) {
+                // {sign}?{digit}+ 为整数，带小数点的为浮点数
+                const char *begin = p++;
+                while (isdigit(static_cast<unsigned char>(*p))) {
+                    ++p;
+                }
+                Value val;
+                if (*p == '.') {
+                    ++p;
+                    while (isdigit(static_cast<unsigned char>(*p))) {
+                        ++p;
+                    }
+                    val.set_float(static_cast<float>(atof(std::string(begin, p - begin).c_str())));
+                } else {
+                    val.set_int(atoi(std::string(begin, p - begin).c_str()));
+                }
+                params.emplace_back(std::move(val));
+                key += '?';
+            } else if (c == '\'') {
+                const char *begin = ++p;
+                while (*p != '\'' && *p != '\0') {
+                    ++p;
+                }
+                if (*p == '\0') {
+                    return false;
+                }
+                Value val;
+                val.set_str(std::string(begin, p - begin));
+                params.emplace_back(std::move(val));
+                key += '?';
+                ++p;
+            } else if ((c == '>' || c == '<' || c == '!') && p[1] == '=') {
+                key.append(p, 2);
+                p += 2;
+            } else if (c == '<' && p[1] == '>') {
+                key.append(p, 2);
+                p += 2;
+            } else if (c == '-' && p[1] == '-') {
+                // 注释交给完整的解析流程处理
+                return false;
+            } else if (strchr("(),*=<>.+-", c) != nullptr) {
+                key += static_cast<char>(c);
+                ++p;
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool same_params(const std::vector<Value> &lhs, const std::vector<Value> &rhs) {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < lhs.size(); ++i) {
+            if (lhs[i].type != rhs[i].type || lhs[i] != rhs[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 深拷贝计划树，Portal::start 会修改计划，每次执行都需要一份新的；不支持的计划返回 nullptr
+    static std::shared_ptr<Plan> clone_plan(const std::shared_ptr<Plan> &plan) {
+        if (plan == nullptr) {
+            return nullptr;
+        }
+        switch (plan->tag) {
+            case T_SeqScan:
+            case T_IndexScan: {
+                auto x = std::make_shared<ScanPlan>(*std::static_pointer_cast<ScanPlan>(plan));
+                for (auto &cond: x->conds_) {
+                    if (cond.is_subquery) {
+                        return nullptr;
+                    }
+                }
+                return x;
+            }
+            case T_NestLoop:
+            case T_SortMerge:
+            case T_HashJoin:
+            case T_IndexNestLoop: {
+                auto x = std::make_shared<JoinPlan>(*std::static_pointer_cast<JoinPlan>(plan));
+                x->left_ = clone_plan(x->left_);
+                x->right_ = clone_plan(x->right_);
+                return x->left_ && x->right_ ? x : nullptr;
+            }
+            case T_Projection: {
+                auto x = std::make_shared<ProjectionPlan>(*std::static_pointer_cast<ProjectionPlan>(plan));
+                x->subplan_ = clone_plan(x->subplan_);
+                return x->subplan_ ? x : nullptr;
+            }
+            case T_Sort: {
+                auto x = std::make_shared<SortPlan>(*std::static_pointer_cast<SortPlan>(plan));
+                x->subplan_ = clone_plan(x->subplan_);
+                return x->subplan_ ? x : nullptr;
+            }
+            case T_Limit: {
+                auto x = std::make_shared<LimitPlan>(*std::static_pointer_cast<LimitPlan>(plan));
+                x->subplan_ = clone_plan(x->subplan_);
+                return x->subplan_ ? x : nullptr;
+            }
+            case T_Agg: {
+                auto x = std::make_shared<AggPlan>(*std::static_pointer_cast<AggPlan>(plan));
+                x->subplan_ = clone_plan(x->subplan_);
+                return x->subplan_ ? x : nullptr;
+            }
+            case T_Having: {
+                auto x = std::make_shared<HavingPlan>(*std::static_pointer_cast<HavingPlan>(plan));
+                x->subplan_ = clone_plan(x->subplan_);
+                return x->subplan_ ? x : nullptr;
+            }
+            case T_select:
+            case T_Update:
+            case T_Delete: {
+                auto x = std::make_shared<DMLPlan>(*std::static_pointer_cast<DMLPlan>(plan));
+                x->subplan_ = clone_plan(x->subplan_);
+                return x->subplan_ ? x : nullptr;
+            }
+            default:
+                return nullptr;
+        }
+    }
+
+    static void collect_slots(Plan *plan, Slots &slots) {
+        switch (plan->tag) {
+            case T_SeqScan:
+            case T_IndexScan: {
+                for (auto &cond: static_cast<ScanPlan *>(plan)->conds_) {
+                    slots.conds.push_back(&cond);
+                }
+                break;
+            }
+            case T_NestLoop:
+            case T_SortMerge:
+            case T_HashJoin:
+            case T_IndexNestLoop: {
+                auto x = static_cast<JoinPlan *>(plan);
+                for (auto &cond: x->conds_) {
+                    slots.conds.push_back(&cond);
+                }
+                collect_slots(x->left_.get(), slots);
+                collect_slots(x->right_.get(), slots);
+                break;
+            }
+            case T_Projection:
+                collect_slots(static_cast<ProjectionPlan *>(plan)->subplan_.get(), slots);
+                break;
+            case T_Sort:
+                collect_slots(static_cast<SortPlan *>(plan)->subplan_.get(), slots);
+                break;
+            case T_Limit:
+                collect_slots(static_cast<LimitPlan *>(plan)->subplan_.get(), slots);
+                break;
+            case T_Agg:
+                collect_slots(static_cast<AggPlan *>(plan)->subplan_.get(), slots);
+                break;
+            case T_Having: {
+                auto x = static_cast<HavingPlan *>(plan);
+                for (auto &cond: x->having_conds_) {
+                    slots.having_conds.push_back(&cond);
+                }
+                collect_slots(x->subplan_.get(), slots);
+                break;
+            }
+            case T_select:
+            case T_Update:
+            case T_Delete: {
+                auto x = static_cast<DMLPlan *>(plan);
+                for (auto &cond: x->conds_) {
+                    slots.conds.push_back(&cond);
+                }
+                for (auto &set_clause: x->set_clauses_) {
+                    slots.set_clauses.push_back(&set_clause);
+                }
+                collect_slots(x->subplan_.get(), slots);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    // 每个字面量都必须能在计划中找到对应位置，且计划中不能有来源不明的字面量
+    static bool covers_params(const std::shared_ptr<Plan> &plan, size_t num_params) {
+        Slots slots;
+        collect_slots(plan.get(), slots);
+        std::vector<bool> covered(num_params, false);
+        auto cover = [&](int idx) {
+            if (idx < 0 || static_cast<size_t>(idx) >= num_params) {
+                return false;
+            }
+            covered[idx] = true;
+            return true;
+        };
+        for (auto cond: slots.conds) {
+            if (cond->is_rhs_val && !cover(cond->param_idx)) {
+                return false;
+            }
+        }
+        for (auto set_clause: slots.set_clauses) {
+            if (!cover(set_clause->param_idx)) {
+                return false;
+            }
+        }
+        for (auto having_cond: slots.having_conds) {
+            if (!cover(having_cond->param_idx)) {
+                return false;
+            }
+        }
+        for (bool c: covered) {
+            if (!c) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 字面量与列类型不同时 QueryRewriter::fold_constants 会按运算符改写条件，而命中缓存时不再经过改写，
+    // 这样的计划不缓存，每次都走完整的分析流程
+    static bool has_mixed_types(const std::shared_ptr<Plan> &plan, const std::vector<Value> &params) {
+        Slots slots;
+        collect_slots(plan.get(), slots);
+        for (auto cond: slots.conds) {
+            if (cond->is_rhs_val && params[cond->param_idx].type != cond->lhs.type) {
+                return true;
+            }
+        }
+        for (auto set_clause: slots.set_clauses) {
+            if (params[set_clause->param_idx].type != set_clause->lhs->type) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // 与 Analyze 中的类型检查和转换保持一致
+    static void bind_params(const std::shared_ptr<Plan> &plan, const std::vector<Value> &params) {
+        Slots slots;
+        collect_slots(plan.get(), slots);
+        for (auto cond: slots.conds) {
+            if (cond->is_rhs_val) {
+                cond->rhs_val = params[cond->param_idx];
+                Analyze::bind_cond_value(cond->rhs_val, cond->lhs);
+            }
+        }
+        for (auto set_clause: slots.set_clauses) {
+            set_clause->rhs = params[set_clause->param_idx];
+            Analyze::bind_set_value(set_clause->rhs, *set_clause->lhs);
+        }
+        for (auto having_cond: slots.having_conds) {
+            having_cond->rhs_val = params[having_cond->param_idx];
+        }
+    }
+
+    SmManager *sm_manager_;
+
+    mutable std::shared_mutex mutex_;
+    phmap::flat_hash_map<std::string, std::shared_ptr<const Entry>> plans_;
+};
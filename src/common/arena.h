@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// 按语句复用的单调内存池。一条语句执行期间 AST 节点、Query、Plan 和 PortalStmt
+// 通过 make_arena_shared 从当前线程绑定的 Arena 中分配（对象与 shared_ptr 控制块在同一块内存里），
+// 释放是空操作，语句结束后 reset() 把游标拨回第一个块，O(1) 回收全部内存。
+// 长期保存的对象（计划缓存、预编译语句）一律由 PlanCache::clone_plan 复制到堆上，不会引用 Arena。
+class Arena {
+public:
+    static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+    // 当前线程正在执行的语句所用的 Arena，没有时 make_arena_shared 退化为 std::make_shared
+    inline static thread_local Arena *current = nullptr;
+
+    // 语句作用域：绑定到当前线程，析构时解绑并回收
+    class Scope {
+    public:
+        explicit Scope(Arena *arena) : arena_(arena), prev_(current) { current = arena_; }
+
+        ~Scope() {
+            current = prev_;
+            arena_->reset();
+        }
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        Arena *arena_;
+        Arena *prev_;
+    };
+
+    // 一代内存：两次 reset 之间分配的块和大对象。reset 时这一代仍有对象存活（对象逃逸出了语句），
+    // 就整代交给这些对象，最后一个释放时归还；Arena 换一代新的继续使用，计数互不干扰
+    struct Generation {
+        std::vector<std::unique_ptr<char[]>> blocks;
+        std::vector<void *> large;
+        size_t live = 0;
+        bool retired = false;
+
+        ~Generation() {
+            for (auto ptr: large) {
+                free(ptr);
+            }
+        }
+    };
+
+    Arena() : gen_(new Generation()) {}
+
+    ~Arena() { retire(); }
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    // 分配出去的内存属于哪一代，释放时按代计数
+    Generation *generation() const { return gen_; }
+
+    void *allocate(size_t size, size_t align) {
+        ++gen_->live;
+        if (size > BLOCK_SIZE / 4) {
+            // 大对象单独分配，reset 时归还
+            void *ptr = aligned_alloc(align, (size + align - 1) / align * align);
+            gen_->large.push_back(ptr);
+            return ptr;
+        }
+        auto &blocks = gen_->blocks;
+        size_t offset = (offset_ + align - 1) & ~(align - 1);
+        if (block_ == blocks.size() || offset + size > BLOCK_SIZE) {
+            if (block_ < blocks.size()) {
+                ++block_;
+            }
+            if (block_ == blocks.size()) {
+                blocks.emplace_back(new char[BLOCK_SIZE]);
+            }
+            offset = 0;
+        }
+        offset_ = offset + size;
+        return blocks[block_].get() + offset;
+    }
+
+    static void deallocate(Generation *gen) {
+        if (--gen->live == 0 && gen->retired) {
+            delete gen;
+        }
+    }
+
+    void reset() {
+        if (gen_->live != 0) {
+            retire();
+            gen_ = new Generation();
+        } else {
+            for (auto ptr: gen_->large) {
+                free(ptr);
+            }
+            gen_->large.clear();
+        }
+        block_ = 0;
+        offset_ = 0;
+    }
+
+private:
+    void retire() {
+        if (gen_->live == 0) {
+            delete gen_;
+        } else {
+            gen_->retired = true;
+        }
+        gen_ = nullptr;
+    }
+
+    Generation *gen_;
+    size_t block_ = 0;
+    size_t offset_ = 0;
+};
+
+template <class T>
+struct ArenaAllocator {
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena *arena) noexcept : arena_(arena), gen_(arena->generation()) {}
+
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U> &other) noexcept : arena_(other.arena_), gen_(other.gen_) {}
+
+    T *allocate(size_t n) { return static_cast<T *>(arena_->allocate(n * sizeof(T), alignof(T))); }
+
+    void deallocate(T *, size_t) noexcept { Arena::deallocate(gen_); }
+
+    template <class U>
+    bool operator==(const ArenaAllocator<U> &other) const noexcept { return arena_ == other.arena_; }
+
+    template <class U>
+    bool operator!=(const ArenaAllocator<U> &other) const noexcept { return arena_ != other.arena_; }
+
+    Arena *arena_;
+    Arena::Generation *gen_; // 构造时所在的一代，与 allocate 在同一条语句内
+};
+
+template <class T, class... Args>
+std::shared_ptr<T> make_arena_shared(Args &&...args) {
+    if (Arena::current == nullptr) {
+        return std::make_shared<T>(std::forward<Args>(args)...);
+    }
+    return std::allocate_shared<T>(ArenaAllocator<T>(Arena::current), std::forward<Args>(args)...);
+}
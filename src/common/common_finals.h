@@ -87,6 +87,9 @@ struct Condition
     std::shared_ptr<SubQuery> subQuery;
 
     bool join_cond = false;
+
+    // rhs_val 对应 Query::params 中的下标，-1 表示右边不是字面量
+    int param_idx = -1;
 };
 
 struct HavingCond
@@ -94,6 +97,8 @@ struct HavingCond
     TabCol lhs_col; // left-hand side column
     CompOp op;      // comparison operator
     Value rhs_val;  // right-hand side value
+
+    int param_idx = -1;
 };
 
 struct SetClause
@@ -106,6 +111,8 @@ struct SetClause
 
     Value rhs;
 
+    int param_idx = -1;
+
     SetClause(Value rhs_)
     {
         rhs = std::move(rhs_);
@@ -1,21 +1,25 @@
 #pragma once
 
+#include <string>
 #include <utility>
 
+#include "common/send_buffer.h"
 #include "transaction/concurrency/lock_manager_finals.h"
 #include "transaction/transaction_finals.h"
 
 class Context
 {
 public:
-    Context(LockManager *lock_mgr, std::shared_ptr<Transaction> txn, char *data_send, int *offset) : lock_mgr_(lock_mgr), txn_(std::move(txn)), data_send_(data_send), offset_(offset) {}
+    Context(LockManager *lock_mgr, std::shared_ptr<Transaction> txn, SendBuffer *send_buf, std::string *output) : lock_mgr_(lock_mgr), txn_(std::move(txn)), send_buf_(send_buf), output_(output) {}
 
     static int MAX_OFFSET_LENGTH;
 
-    bool data_send_is_full() const { return *offset_ > MAX_OFFSET_LENGTH; }
+    // 只有旧协议连接才截断结果，分帧连接的结果按块流式发送
+    bool data_send_is_full() const { return !send_buf_->framed() && static_cast<int>(send_buf_->payload_size()) > MAX_OFFSET_LENGTH; }
 
     LockManager *lock_mgr_;
     std::shared_ptr<Transaction> txn_;
-    char *data_send_;
-    int *offset_;
+    SendBuffer *send_buf_;
+    std::string *output_; // 本条语句写入 output.txt 的内容，语句结束时统一提交给 OutputLog
+    int parallel_degree_ = 1; // 会话的扫描并行度，语句开始时从连接取出，SET 修改后写回
 };
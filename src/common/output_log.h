@@ -0,0 +1,156 @@
+#pragma once
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// output.txt 的异步写入：每条语句的输出先攒在连接自己的缓冲区里，语句结束时整块提交。
+// 提交走无锁的 MPSC 栈（CAS 压入，后台线程一次 exchange 取走全部并反转成 FIFO），
+// CAS 成功的先后就是语句完成的先后，文件内容保持这个顺序。
+// 后台线程把取到的所有块拼成一次 write，同一个刷新周期内至多 fdatasync 一次。
+class OutputLog {
+public:
+    static constexpr auto FLUSH_INTERVAL = std::chrono::milliseconds(50);
+    static constexpr size_t INITIAL_BATCH_CAPACITY = 1 << 20;
+
+    OutputLog() = default;
+
+    ~OutputLog() { close(); }
+
+    OutputLog(const OutputLog &) = delete;
+    OutputLog &operator=(const OutputLog &) = delete;
+
+    // 在 open_db 切换到数据库目录之后调用
+    bool open(const char *path) {
+        fd_ = ::open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+        if (fd_ < 0) {
+            return false;
+        }
+        batch_.reserve(INITIAL_BATCH_CAPACITY);
+        writer_ = std::thread([this] { run(); });
+        return true;
+    }
+
+    // 写出所有已提交的内容后结束后台线程
+    void close() {
+        if (!writer_.joinable()) {
+            return;
+        }
+        {
+            std::lock_guard lk(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_one();
+        writer_.join();
+        ::close(fd_);
+        fd_ = -1;
+    }
+
+    // 提交一条语句的全部输出，调用方应在把结果发回客户端之前提交
+    void append(std::string text) {
+        if (text.empty()) {
+            return;
+        }
+        auto node = new Node{std::move(text), head_.load(std::memory_order_relaxed)};
+        while (!head_.compare_exchange_weak(node->next, node, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        }
+        if (sleeping_.load(std::memory_order_seq_cst)) {
+            std::lock_guard lk(mutex_);
+            cv_.notify_one();
+        }
+    }
+
+private:
+    struct Node {
+        std::string text;
+        Node *next;
+    };
+
+    void run() {
+        auto last_sync = std::chrono::steady_clock::now();
+        bool dirty = false;
+        while (true) {
+            if (drain()) {
+                write_all(batch_.data(), batch_.size());
+                batch_.clear();
+                dirty = true;
+            }
+
+            auto now = std::chrono::steady_clock::now();
+            if (dirty && now - last_sync >= FLUSH_INTERVAL) {
+                fdatasync(fd_);
+                last_sync = now;
+                dirty = false;
+            }
+
+            std::unique_lock lk(mutex_);
+            if (stop_ && head_.load() == nullptr) {
+                break;
+            }
+            sleeping_.store(true, std::memory_order_seq_cst);
+            auto ready = [this] { return stop_ || head_.load(std::memory_order_seq_cst) != nullptr; };
+            if (dirty) {
+                cv_.wait_until(lk, last_sync + FLUSH_INTERVAL, ready);
+            } else {
+                cv_.wait(lk, ready);
+            }
+            sleeping_.store(false, std::memory_order_relaxed);
+        }
+        if (dirty) {
+            fdatasync(fd_);
+        }
+    }
+
+    // 取走当前所有已提交的块，按提交顺序拼到 batch_ 中
+    bool drain() {
+        Node *node = head_.exchange(nullptr, std::memory_order_acquire);
+        if (node == nullptr) {
+            return false;
+        }
+        Node *fifo = nullptr;
+        while (node != nullptr) {
+            Node *next = node->next;
+            node->next = fifo;
+            fifo = node;
+            node = next;
+        }
+        while (fifo != nullptr) {
+            Node *next = fifo->next;
+            batch_.append(fifo->text);
+            delete fifo;
+            fifo = next;
+        }
+        return true;
+    }
+
+    void write_all(const char *src, size_t n) {
+        while (n > 0) {
+            auto written = ::write(fd_, src, n);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return;
+            }
+            src += written;
+            n -= written;
+        }
+    }
+
+    int fd_ = -1;
+    std::atomic<Node *> head_{nullptr};
+    std::string batch_;
+
+    std::thread writer_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::atomic<bool> sleeping_{false};
+    bool stop_ = false;
+};
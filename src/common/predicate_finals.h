@@ -0,0 +1,225 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "common/common_finals.h"
+#include "errors_finals.h"
+
+// 编译后的谓词：构造时把一组比较条件翻译成扁平的指令数组，每条指令记下两边操作数的位置和长度，
+// 以及按 (左类型, 右类型, 运算符) 特化好的比较函数。执行时依次调用，遇到不满足的立即返回，
+// 不再逐行判断类型、查找列或构造 std::string。
+// 操作数按段定位：单表记录只有一段；连接时左记录的各段之后接右记录，与连接输出的分段布局一致
+class Predicate
+{
+public:
+    // 一个列操作数：第 seg 段内偏移 offset 处
+    struct Operand
+    {
+        int seg;
+        int offset;
+        int len;
+        ColType type;
+    };
+
+    // 追加 lhs op rhs，两边都是列
+    void add(const Operand &lhs, CompOp op, const Operand &rhs)
+    {
+        code_.push_back({kernel(lhs.type, rhs.type, op), lhs.seg, lhs.offset, lhs.len, rhs.seg, rhs.offset, rhs.len});
+    }
+
+    // 追加 lhs op value，INT 与 FLOAT 可以互相比较
+    void add(const Operand &lhs, CompOp op, const Value &value)
+    {
+        switch (value.type)
+        {
+        case TYPE_INT:
+            add_const(lhs, op, reinterpret_cast<const char *>(&value.int_val), sizeof(int), TYPE_INT);
+            break;
+        case TYPE_FLOAT:
+            add_const(lhs, op, reinterpret_cast<const char *>(&value.float_val), sizeof(float), TYPE_FLOAT);
+            break;
+        case TYPE_STRING:
+            add_const(lhs, op, value.str_val.data(), static_cast<int>(value.str_val.size()), TYPE_STRING);
+            break;
+        default:
+            throw RMDBError();
+        }
+    }
+
+    // 追加 lhs op 常量，常量是与 lhs 同类型、同长度的原始字节
+    void add(const Operand &lhs, CompOp op, const char *raw) { add_const(lhs, op, raw, lhs.len, lhs.type); }
+
+    // 按 Condition 追加：右边是常量时取 rhs_val，否则取 rhs
+    void add(const Operand &lhs, const Condition &cond, const Operand &rhs)
+    {
+        if (cond.is_rhs_val)
+        {
+            add(lhs, cond.op, cond.rhs_val);
+        }
+        else
+        {
+            add(lhs, cond.op, rhs);
+        }
+    }
+
+    bool empty() const { return code_.empty(); }
+
+    bool eval(const char *const *segs) const
+    {
+        for (auto &ins : code_)
+        {
+            const char *a = segs[ins.a_seg] + ins.a_offset;
+            const char *b = ins.b_seg == CONST ? consts_.data() + ins.b_offset : segs[ins.b_seg] + ins.b_offset;
+            if (!ins.kernel(a, b, ins.a_len, ins.b_len))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 只有一段的记录
+    bool eval(const char *record) const { return eval(&record); }
+
+private:
+    using Kernel = bool (*)(const char *, const char *, int, int);
+
+    struct Instr
+    {
+        Kernel kernel;
+        int a_seg;
+        int a_offset;
+        int a_len;
+        int b_seg; // CONST 表示 b 在常量区
+        int b_offset;
+        int b_len;
+    };
+
+    static constexpr int CONST = -1;
+
+    std::vector<Instr> code_;
+    std::vector<char> consts_;
+
+    void add_const(const Operand &lhs, CompOp op, const char *data, int len, ColType type)
+    {
+        int offset = static_cast<int>(consts_.size());
+        consts_.insert(consts_.end(), data, data + len);
+        code_.push_back({kernel(lhs.type, type, op), lhs.seg, lhs.offset, lhs.len, CONST, offset, len});
+    }
+
+    template <CompOp OP, typename T>
+    static bool test(const T &a, const T &b)
+    {
+        switch (OP)
+        {
+        case OP_EQ:
+            return a == b;
+        case OP_LT:
+            return a < b;
+        case OP_GT:
+            return a > b;
+        case OP_LE:
+            return a <= b;
+        case OP_GE:
+            return a >= b;
+        }
+        return false;
+    }
+
+    // 数值比较，两边类型不同时按 double 比较
+    template <typename A, typename B, CompOp OP>
+    static bool compare_num(const char *a, const char *b, int, int)
+    {
+        A x;
+        B y;
+        std::memcpy(&x, a, sizeof(A));
+        std::memcpy(&y, b, sizeof(B));
+        if constexpr (std::is_same_v<A, B>)
+        {
+            return test<OP>(x, y);
+        }
+        else
+        {
+            return test<OP>(static_cast<double>(x), static_cast<double>(y));
+        }
+    }
+
+    // 定长 CHAR 按有效长度比较，与补零后逐字节比较的结果一致
+    template <CompOp OP>
+    static bool compare_str(const char *a, const char *b, int a_len, int b_len)
+    {
+        size_t la = strnlen(a, a_len);
+        size_t lb = strnlen(b, b_len);
+        int cmp = std::memcmp(a, b, std::min(la, lb));
+        if (cmp == 0)
+        {
+            cmp = la < lb ? -1 : (la > lb ? 1 : 0);
+        }
+        return test<OP>(cmp, 0);
+    }
+
+    template <typename A, typename B>
+    static Kernel num_kernel(CompOp op)
+    {
+        switch (op)
+        {
+        case OP_EQ:
+            return &compare_num<A, B, OP_EQ>;
+        case OP_LT:
+            return &compare_num<A, B, OP_LT>;
+        case OP_GT:
+            return &compare_num<A, B, OP_GT>;
+        case OP_LE:
+            return &compare_num<A, B, OP_LE>;
+        case OP_GE:
+            return &compare_num<A, B, OP_GE>;
+        }
+        throw RMDBError();
+    }
+
+    static Kernel str_kernel(CompOp op)
+    {
+        switch (op)
+        {
+        case OP_EQ:
+            return &compare_str<OP_EQ>;
+        case OP_LT:
+            return &compare_str<OP_LT>;
+        case OP_GT:
+            return &compare_str<OP_GT>;
+        case OP_LE:
+            return &compare_str<OP_LE>;
+        case OP_GE:
+            return &compare_str<OP_GE>;
+        }
+        throw RMDBError();
+    }
+
+    static Kernel kernel(ColType a, ColType b, CompOp op)
+    {
+        if (a == TYPE_STRING && b == TYPE_STRING)
+        {
+            return str_kernel(op);
+        }
+        if (a == TYPE_INT && b == TYPE_INT)
+        {
+            return num_kernel<int, int>(op);
+        }
+        if (a == TYPE_FLOAT && b == TYPE_FLOAT)
+        {
+            return num_kernel<float, float>(op);
+        }
+        if (a == TYPE_INT && b == TYPE_FLOAT)
+        {
+            return num_kernel<int, float>(op);
+        }
+        if (a == TYPE_FLOAT && b == TYPE_INT)
+        {
+            return num_kernel<float, int>(op);
+        }
+        throw RMDBError();
+    }
+};
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include "network/protocol.h"
+#include "network/shm_channel.h"
+
+// 每个连接一个、可增长的发送缓冲区，替代原先栈上定长 2KB 的 data_send。
+// 分帧连接下缓冲区头部预留一个帧头，结果超过 RESULT_CHUNK_SIZE 就作为一个数据帧发出，
+// 语句结束时剩余数据与结束帧合并为一次 write；旧协议连接保持原来“一条语句一次 write、
+// 以 '\0' 结尾”的行为。共享内存连接的帧写入结果环形缓冲区，套接字只用来发门铃。
+class SendBuffer {
+public:
+    SendBuffer() = default;
+
+    ~SendBuffer() { free(data_); }
+
+    SendBuffer(const SendBuffer &) = delete;
+    SendBuffer &operator=(const SendBuffer &) = delete;
+
+    // 每条语句开始前调用，ring 非空时结果写入共享内存
+    void reset(int fd, bool framed, shm::Ring *ring = nullptr) {
+        fd_ = fd;
+        framed_ = framed;
+        ring_ = ring;
+        broken_ = false;
+        head_ = framed_ ? protocol::FRAME_HEADER_SIZE : 0;
+        size_ = head_;
+        ensure(head_);
+    }
+
+    bool framed() const { return framed_; }
+
+    // 当前尚未发送的结果字节数
+    size_t payload_size() const { return size_ - head_; }
+
+    // 返回可写入 n 字节的位置，写完后调用 commit(n)
+    char *reserve(size_t n) {
+        ensure(size_ + n);
+        return data_ + size_;
+    }
+
+    void commit(size_t n) { size_ += n; }
+
+    void append(const char *src, size_t n) {
+        memcpy(reserve(n), src, n);
+        commit(n);
+    }
+
+    // 丢弃尚未发送的结果（出错时用错误信息替换结果）
+    void discard() { size_ = head_; }
+
+    // 分帧连接下缓冲区足够大时发出一个数据帧
+    void maybe_flush() {
+        if (framed_ && payload_size() >= protocol::RESULT_CHUNK_SIZE) {
+            flush_chunk();
+        }
+    }
+
+    // 语句结束：发送剩余结果和结束帧，返回 false 表示连接已断开
+    bool finish(char status) {
+        if (!framed_) {
+            append("\0", 1);
+            return write_all(data_, size_);
+        }
+        const char *begin = data_;
+        if (payload_size() == 0) {
+            begin += head_;
+        } else {
+            protocol::encode_header(data_, protocol::FRAME_DATA, static_cast<uint32_t>(payload_size()));
+        }
+        char *end = reserve(protocol::FRAME_HEADER_SIZE + 1);
+        protocol::encode_header(end, protocol::FRAME_END, 1);
+        end[protocol::FRAME_HEADER_SIZE] = status;
+        commit(protocol::FRAME_HEADER_SIZE + 1);
+        bool ok = write_all(begin, data_ + size_ - begin);
+        size_ = head_;
+        return ok;
+    }
+
+private:
+    void flush_chunk() {
+        protocol::encode_header(data_, protocol::FRAME_DATA, static_cast<uint32_t>(payload_size()));
+        write_all(data_, size_);
+        size_ = head_;
+    }
+
+    bool write_all(const char *src, size_t n) {
+        if (ring_ != nullptr) {
+            return write_ring(src, n);
+        }
+        while (!broken_ && n > 0) {
+            auto written = send(fd_, src, n, MSG_NOSIGNAL);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                broken_ = true;
+                break;
+            }
+            src += written;
+            n -= written;
+        }
+        return !broken_;
+    }
+
+    bool write_ring(const char *src, size_t n) {
+        while (!broken_ && n > 0) {
+            size_t written = ring_->write_some(src, n);
+            if (written == 0) {
+                // 结果比环形缓冲区大，先叫醒客户端消费
+                if (ring_->consumer_waiting()) {
+                    shm::ring_doorbell(fd_);
+                }
+                broken_ = !shm::wait_for_space(fd_);
+                continue;
+            }
+            src += written;
+            n -= written;
+        }
+        if (!broken_ && ring_->consumer_waiting()) {
+            broken_ = !shm::ring_doorbell(fd_);
+        }
+        return !broken_;
+    }
+
+    void ensure(size_t n) {
+        if (n <= cap_) {
+            return;
+        }
+        size_t cap = cap_ == 0 ? INITIAL_CAPACITY : cap_;
+        while (cap < n) {
+            cap <<= 1;
+        }
+        data_ = static_cast<char *>(realloc(data_, cap));
+        cap_ = cap;
+    }
+
+    static constexpr size_t INITIAL_CAPACITY = 4096;
+
+    char *data_ = nullptr;
+    size_t size_ = 0;
+    size_t cap_ = 0;
+    size_t head_ = 0;
+
+    int fd_ = -1;
+    shm::Ring *ring_ = nullptr;
+    bool framed_ = false;
+    bool broken_ = false;
+};
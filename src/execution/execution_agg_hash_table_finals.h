@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// 聚合用的哈希表。分组列都是定长的，键就是各分组列首尾相接的 key_len 字节，按字节比较。
+// 每个组占一行 [键][聚合状态]，行按首次出现的顺序连续存放在 rows_ 中；槽只记 (hash, 行号)，线性探测，装载率不超过 1/2。
+// rows_ 扩容后行指针会失效，调用方应保存行号
+class AggHashTable {
+public:
+    static constexpr uint32_t EMPTY = UINT32_MAX;
+
+    AggHashTable(size_t key_len, size_t row_len) : key_len_(key_len), row_len_(row_len) {
+        slots_.assign(16, Slot{0, EMPTY});
+        mask_ = slots_.size() - 1;
+    }
+
+    size_t size() const { return size_; }
+
+    size_t key_len() const { return key_len_; }
+
+    char *row(uint32_t idx) { return rows_.data() + static_cast<size_t>(idx) * row_len_; }
+
+    const char *row(uint32_t idx) const { return rows_.data() + static_cast<size_t>(idx) * row_len_; }
+
+    // 查找键所在的行，没有时新建一行并写入键，is_new 为 true，状态部分由调用方初始化
+    uint32_t find_or_insert(const char *key, uint64_t h, bool &is_new) {
+        for (uint64_t pos = h & mask_;; pos = (pos + 1) & mask_) {
+            auto &slot = slots_[pos];
+            if (slot.idx == EMPTY) {
+                is_new = true;
+                slot = Slot{h, static_cast<uint32_t>(size_)};
+                rows_.resize((size_ + 1) * row_len_);
+                std::memcpy(row(slot.idx), key, key_len_);
+                size_++;
+                if (size_ * 2 > slots_.size()) {
+                    grow();
+                }
+                return static_cast<uint32_t>(size_ - 1);
+            }
+            if (slot.hash == h && std::memcmp(row(slot.idx), key, key_len_) == 0) {
+                is_new = false;
+                return slot.idx;
+            }
+        }
+    }
+
+    // 按 8 字节一组混合，定长键没有逐字节的循环
+    static uint64_t hash(const char *key, size_t len) {
+        uint64_t h = 0x9e3779b97f4a7c15ULL ^ len;
+        while (len >= 8) {
+            uint64_t w;
+            std::memcpy(&w, key, 8);
+            h = mix(h ^ w);
+            key += 8;
+            len -= 8;
+        }
+        if (len > 0) {
+            uint64_t w = 0;
+            std::memcpy(&w, key, len);
+            h = mix(h ^ w);
+        }
+        return h ^ (h >> 29);
+    }
+
+private:
+    struct Slot {
+        uint64_t hash;
+        uint32_t idx; // 行号，EMPTY 表示空槽
+    };
+
+    size_t key_len_;
+    size_t row_len_;
+    size_t size_ = 0;
+    std::vector<char> rows_;
+    std::vector<Slot> slots_;
+    uint64_t mask_;
+
+    static uint64_t mix(uint64_t h) {
+        h *= 0xff51afd7ed558ccdULL;
+        return h ^ (h >> 32);
+    }
+
+    void grow() {
+        std::vector<Slot> old(slots_.size() * 2, Slot{0, EMPTY});
+        old.swap(slots_);
+        mask_ = slots_.size() - 1;
+        for (auto &slot: old) {
+            if (slot.idx == EMPTY) {
+                continue;
+            }
+            uint64_t pos = slot.hash & mask_;
+            while (slots_[pos].idx != EMPTY) {
+                pos = (pos + 1) & mask_;
+            }
+            slots_[pos] = slot;
+        }
+    }
+};
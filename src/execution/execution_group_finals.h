@@ -4,28 +4,62 @@
 // agg_plan_executor.h
 #pragma once
 
-#include <cfloat>
-#include <climits>
-#include <unordered_map>
+#include <array>
+#include <memory>
 
+#include "execution_agg_hash_table_finals.h"
+#include "execution_parallel_finals.h"
 #include "executor_abstract_finals.h"
+#include "executor_seq_scan_finals.h"
 
+// 分组聚合：每批记录先逐条拼出分组键、在 AggHashTable 中找到组行，再对每个聚合列调用按 (函数, 类型) 特化的更新函数，
+// 一次处理整批，不再逐行逐列构造 Value。串行时组按首次出现的顺序输出。
+// 子算子是可以并行的顺序扫描时，各线程按 morsel 扫描并聚合到线程局部的表中，局部表按哈希高位分区，
+// 之后各分区并行合并，结果按分区依次输出
 class AggPlanExecutor : public AbstractExecutor {
 private:
+    // 一个输出列：状态在组行内的位置和特化好的初始化、更新、输出函数
+    struct Agg {
+        FieldRef value;   // 参与聚合的列，COUNT 不用
+        int len;          // 输出列的长度，除 COUNT 外也是参与聚合的列的长度
+        int state_offset; // 状态在组行内的偏移
+        void (*init)(char *state, const char *value, int len);                    // 组的第一条记录
+        void (*update)(const Agg &agg, char *const *groups, const TupleBatch &batch); // 为空表示不需要更新
+        void (*merge)(char *state, const char *other, int len);                    // 合并同一组的两份状态，为空表示保留 state
+        void (*output)(char *dst, const char *state, int len);
+    };
+
+    // 一个线程的聚合状态：按哈希高 shift 位以外的位分区的若干张表，以及处理一批记录用的缓冲
+    struct Local {
+        std::vector<AggHashTable> parts;
+        int shift = 64;
+        std::vector<char> key;
+        std::array<uint32_t, TupleBatch::CAPACITY> part_idx;
+        std::array<uint32_t, TupleBatch::CAPACITY> group_idx;
+        std::array<char *, TupleBatch::CAPACITY> groups;
+    };
+
+    // 一个分组列
+    struct KeyCol {
+        FieldRef value;
+        int len;
+    };
+
     std::vector<TabCol> sel_cols_;
     std::vector<TabCol> group_by_cols_;
 
-    std::vector<std::vector<ColMeta>::const_iterator> group_by_col_metas_;
-    std::vector<std::vector<ColMeta>::const_iterator> sel_col_metas_;
-
     std::unique_ptr<AbstractExecutor> child_executor_;
     std::vector<ColMeta> output_cols_; // 输出列的元数据
 
-    std::vector<std::string> insert_order_; // 保证顺序的一致性
-    std::unordered_map<std::string, std::vector<Value> > group_map_;
+    std::vector<KeyCol> keys_;
+    std::vector<Agg> aggs_;
+    size_t key_len_ = 0;
+    size_t row_len_ = 0;
+    std::vector<AggHashTable> tables_; // 聚合结果，并行时每个分区一张
 
-    std::vector<RmRecord> results_;
-    std::vector<RmRecord>::iterator result_it_;
+    std::vector<char> results_; // 结果记录，每条 TupleLen 字节
+    size_t result_cnt_ = 0;
+    size_t result_pos_ = 0;
     int TupleLen;
     Context *context_;
 
@@ -43,45 +77,59 @@ public:
     const std::vector<ColMeta> &cols() const override { return output_cols_; }
 
     void beginTuple() override {
-        child_executor_->beginTuple();
         performAggregation();
-        result_it_ = results_.begin();
+        result_pos_ = 0;
     }
 
     void nextTuple() override {
-        if (result_it_ != results_.end()) {
-            ++result_it_;
+        if (result_pos_ < result_cnt_) {
+            ++result_pos_;
         }
     }
 
     std::unique_ptr<RmRecord> Next() override {
-        if (result_it_ == results_.end()) {
+        if (result_pos_ == result_cnt_) {
             return nullptr;
         }
-        auto record = std::make_unique<RmRecord>(*result_it_);
-        return record;
+        return std::make_unique<RmRecord>(result(result_pos_), TupleLen);
     }
 
-    bool is_end() const override { return result_it_ == results_.end(); }
+    bool is_end() const override { return result_pos_ == result_cnt_; }
+
+    size_t NextBatch(TupleBatch &batch) override {
+        batch.clear();
+        for (; !batch.full() && result_pos_ < result_cnt_; ++result_pos_) {
+            batch.append(result(result_pos_));
+        }
+        return batch.sel_size;
+    }
 
 private:
     void initialize() {
+        SegLayout layout(child_executor_->seg_lens());
+        for (const auto &col: group_by_cols_) {
+            auto col_meta = get_col(child_executor_->cols(), col);
+            keys_.push_back({layout.locate(col_meta->offset), col_meta->len});
+            key_len_ += col_meta->len;
+        }
+
         // Initialize output columns
         TupleLen = 0;
+        row_len_ = key_len_;
         for (const auto &col: sel_cols_) {
+            Agg agg{};
+            ColType type = TYPE_INT;
             if (col.aggFuncType == ast::COUNT) {
                 ColMeta col_meta(col.tab_name, col.col_name, TYPE_INT, col.aggFuncType, sizeof(int), TupleLen, false);
                 TupleLen += col_meta.len;
                 output_cols_.push_back(col_meta);
-                // 往sel_col_metas_随便push一个
-                sel_col_metas_.emplace_back(output_cols_.begin());
             } else {
                 if (col.col_name == "*") {
                     throw RMDBError();
                 }
                 auto temp = get_col(child_executor_->cols(), col);
-                // Initialize selected columns
-                sel_col_metas_.push_back(temp);
+                agg.value = layout.locate(temp->offset);
+                type = temp->type;
 
                 auto col_meta = *temp;
                 col_meta.offset = TupleLen;
@@ -93,254 +141,319 @@ private:
 
                 output_cols_.push_back(col_meta);
             }
-        }
-        // Initialize group by columns
-        for (const auto &col: group_by_cols_) {
-            auto col_meta = get_col(child_executor_->cols(), col);
-            group_by_col_metas_.push_back(col_meta);
+            agg.len = output_cols_.back().len;
+            agg.state_offset = static_cast<int>(row_len_);
+            row_len_ += bind(agg, col.aggFuncType, type);
+            aggs_.push_back(agg);
         }
     }
 
+    char *result(size_t i) { return results_.data() + i * TupleLen; }
+
     // Perform aggregation on the child executor
     void performAggregation() {
-        // if (output_cols_[0].name=="no_o_id"&&output_cols_[0].agg_func_type==ast::MIN&&output_cols_.size()==1) {
-        //     std::unique_ptr<RmRecord> nex_record = child_executor_->Next();
-        //     RmRecord record(TupleLen);
-        //     memcpy(record.data, nex_record->data, 4);
-        //     results_.push_back(record);
-        //     return;
-        // }
-        while (!child_executor_->is_end()) {
-            std::unique_ptr<RmRecord> record = child_executor_->Next();
-            child_executor_->nextTuple();
-            if (record == nullptr) {
-                break;
+        auto *scan = dynamic_cast<SeqScanExecutor *>(child_executor_.get());
+        auto morsels = scan == nullptr ? nullptr : scan->morsel_scan();
+        if (morsels != nullptr) {
+            parallelAggregation(*morsels, static_cast<size_t>(scan->parallel_degree()));
+        } else {
+            child_executor_->beginBatch();
+            Local local = make_local(1);
+            TupleBatch batch;
+            while (child_executor_->NextBatch(batch) != 0) {
+                aggregate(local, batch);
             }
-
-            std::string key = generateGroupByKey(*record);
-            aggregateValues(key, *record);
+            tables_ = std::move(local.parts);
         }
         generateResults();
     }
 
-    inline std::string generateGroupByKey(const RmRecord &record) {
-        if (group_by_cols_.empty()) {
-            return "__no_group_by__";
+    void parallelAggregation(const MorselScan &morsels, size_t dop) {
+        size_t parts = 1;
+        while (parts < dop) {
+            parts <<= 1;
         }
-
-        std::string key;
-        for (const auto &col_meta: group_by_col_metas_) {
-            key.append(record.data + col_meta->offset, col_meta->len);
+        std::vector<Local> locals;
+        for (size_t i = 0; i < dop; i++) {
+            locals.push_back(make_local(parts));
         }
-        return key;
+        std::vector<TupleBatch> batches(dop);
+        WorkerPool::run(dop, morsels.morsels(), [&](size_t worker, size_t m) {
+            morsels.scan(m, batches[worker], [&](const TupleBatch &batch) { aggregate(locals[worker], batch); });
+        });
+        // 同一个组只会落在各线程的同号分区中，分区之间互不相干
+        tables_.assign(parts, AggHashTable(key_len_, row_len_));
+        WorkerPool::run(dop, parts, [&](size_t, size_t p) {
+            for (const auto &local: locals) {
+                merge(tables_[p], local.parts[p]);
+            }
+        });
     }
 
-    void aggregateValues(const std::string &key, const RmRecord &record) {
-        auto &agg_values = group_map_[key];
-        if (agg_values.empty()) {
-            init_map(key, record);
+    Local make_local(size_t parts) const {
+        Local local;
+        local.parts.assign(parts, AggHashTable(key_len_, row_len_));
+        while ((size_t{1} << (64 - local.shift)) < parts) {
+            local.shift--;
         }
+        local.key.resize(key_len_);
+        return local;
+    }
 
-        for (size_t i = 0; i < sel_col_metas_.size(); ++i) {
-            const auto &sel_col = sel_cols_[i];
-            if (sel_col.aggFuncType == ast::COUNT) {
-                agg_values[i].int_val += 1;
-                continue;
+    void aggregate(Local &local, const TupleBatch &batch) const {
+        // 先给整批记录找到组，新组用它的第一条记录初始化状态
+        for (size_t i = 0; i < batch.sel_size; i++) {
+            auto row = batch.row(i);
+            char *key = local.key.data();
+            for (const auto &col: keys_) {
+                std::memcpy(key, col.value.in(row), col.len);
+                key += col.len;
             }
-            const auto &col_meta = sel_col_metas_[i];
-            Value value;
-
-            // 直接访问数据类型并赋值
-            if (col_meta->type == TYPE_INT) {
-                value.set_int(*reinterpret_cast<int *>(record.data + col_meta->offset));
-            } else if (col_meta->type == TYPE_FLOAT) {
-                value.set_float(*reinterpret_cast<float *>(record.data + col_meta->offset));
-            } else if (col_meta->type == TYPE_STRING) {
-                value.set_str(std::string(record.data + col_meta->offset, col_meta->len));
+            uint64_t h = AggHashTable::hash(local.key.data(), key_len_);
+            uint32_t p = local.shift == 64 ? 0 : static_cast<uint32_t>(h >> local.shift);
+            bool is_new;
+            auto &table = local.parts[p];
+            local.part_idx[i] = p;
+            local.group_idx[i] = table.find_or_insert(local.key.data(), h, is_new);
+            if (is_new) {
+                char *group = table.row(local.group_idx[i]);
+                for (const auto &agg: aggs_) {
+                    agg.init(group + agg.state_offset, agg.value.in(row), agg.len);
+                }
             }
-
-            switch (sel_col.aggFuncType) {
-                case ast::SUM:
-                    if (value.type == TYPE_INT) {
-                        agg_values[i].int_val += value.int_val;
-                    } else if (value.type == TYPE_FLOAT) {
-                        agg_values[i].float_val += value.float_val;
-                    }
-                    break;
-                case ast::AVG:
-                    // AVG需要特殊处理，这里简化为直接计算平均值
-                    if (value.type == TYPE_INT) {
-                        agg_values[i].sum_value += value.int_val;
-                    } else if (value.type == TYPE_FLOAT) {
-                        agg_values[i].sum_value += value.float_val;
-                    }
-                    agg_values[i].count_value += 1; // 计数
-                    agg_values[i].float_val = agg_values[i].sum_value / agg_values[i].count_value;
-                    break;
-                case ast::MAX:
-                    if (value.type == TYPE_INT && agg_values[i].int_val < value.int_val) {
-                        agg_values[i].int_val = value.int_val;
-                    } else if (value.type == TYPE_FLOAT && agg_values[i].float_val < value.float_val) {
-                        agg_values[i].float_val = value.float_val;
-                    } else if (value.type == TYPE_STRING && agg_values[i].str_val < value.str_val) {
-                        agg_values[i].set_str(value.str_val);
-                    }
-                    break;
-                case ast::MIN:
-                    if (value.type == TYPE_INT && agg_values[i].int_val > value.int_val) {
-                        agg_values[i].int_val = value.int_val;
-                    } else if (value.type == TYPE_FLOAT && agg_values[i].float_val > value.float_val) {
-                        agg_values[i].float_val = value.float_val;
-                    } else if (value.type == TYPE_STRING && agg_values[i].str_val > value.str_val) {
-                        agg_values[i].set_str(value.str_val);
-                    }
-                    break;
-
-                case ast::default_type:
-                    break;
-                default:
-                    throw RMDBError();
+        }
+        // 插入新组可能使行指针失效，整批找完后再取
+        for (size_t i = 0; i < batch.sel_size; i++) {
+            local.groups[i] = local.parts[local.part_idx[i]].row(local.group_idx[i]);
+        }
+        for (const auto &agg: aggs_) {
+            if (agg.update != nullptr) {
+                agg.update(agg, local.groups.data(), batch);
             }
         }
     }
 
-    void init_map(const std::string &key, const RmRecord &record) {
-        insert_order_.push_back(key);
-        auto &agg_values = group_map_[key];
-        agg_values.resize(sel_cols_.size());
-
-        // Initialize the default values for each aggregation function
-        for (size_t i = 0; i < sel_cols_.size(); ++i) {
-            auto agg_type = sel_cols_[i].aggFuncType;
-
-            if (agg_type == ast::COUNT) {
-                agg_values[i].set_int(0);
-            } else if (agg_type == ast::SUM || agg_type == ast::MAX || agg_type == ast::MIN) {
-                auto col = get_col(child_executor_->cols(), {sel_cols_[i].tab_name, sel_cols_[i].col_name});
-                switch (col->type) {
-                    case TYPE_INT:
-                        if (agg_type == ast::MIN)
-                            agg_values[i].set_int(std::numeric_limits<int>::max());
-                        else if (agg_type == ast::MAX)
-                            agg_values[i].set_int(std::numeric_limits<int>::min());
-                        else
-                            agg_values[i].set_int(0);
-                        break;
-
-                    case TYPE_FLOAT:
-                        if (agg_type == ast::MIN)
-                            agg_values[i].set_float(std::numeric_limits<float>::max());
-                        else if (agg_type == ast::MAX)
-                            agg_values[i].set_float(std::numeric_limits<float>::lowest());
-                        else
-                            agg_values[i].set_float(0.0f);
-                        break;
-                    case TYPE_STRING:
-                        if (agg_type == ast::MIN) {
-                            auto str_len = col->len;
-                            std::string max_str(str_len, '~');
-                            agg_values[i].set_str(max_str);
-                        } else if (agg_type == ast::MAX) {
-                            // Initialize with a low string value for MAX
-                            agg_values[i].set_str("");
-                        } else {
-                            throw RMDBError();
-                        }
-                        break;
-                    default:
-                        throw RMDBError();
-                }
-            } else if (agg_type == ast::AVG) {
-                agg_values[i].count_value = 0;
-                agg_values[i].set_float(0.0f);
-                agg_values[i].sum_value = 0;
-            } else {
-                // 被group by的列,非聚合函数
-                auto col = get_col(child_executor_->cols(), {sel_cols_[i].tab_name, sel_cols_[i].col_name});
-                if (col->type == TYPE_INT) {
-                    agg_values[i].set_int(*reinterpret_cast<int *>(record.data + col->offset));
-                } else if (col->type == TYPE_FLOAT) {
-                    agg_values[i].set_float(*reinterpret_cast<float *>(record.data + col->offset));
-                } else if (col->type == TYPE_STRING) {
-                    agg_values[i].set_str(std::string(record.data + col->offset, col->len));
+    // 把 src 中的各组合并到 dst
+    void merge(AggHashTable &dst, const AggHashTable &src) const {
+        for (size_t i = 0; i < src.size(); i++) {
+            const char *row = src.row(static_cast<uint32_t>(i));
+            bool is_new;
+            char *group = dst.row(dst.find_or_insert(row, AggHashTable::hash(row, key_len_), is_new));
+            if (is_new) {
+                std::memcpy(group + key_len_, row + key_len_, row_len_ - key_len_);
+                continue;
+            }
+            for (const auto &agg: aggs_) {
+                if (agg.merge != nullptr) {
+                    agg.merge(group + agg.state_offset, row + agg.state_offset, agg.len);
                 }
             }
         }
     }
 
     void generateResults() {
-        if (group_map_.empty()) {
-            // 处理没有数据聚合但需要返回 COUNT() 结果的情况
-            RmRecord record(TupleLen);
-            char *data_ptr = record.data;
-
-            bool has_count = false;
-
-            // 初始化聚合值到默认空值
-            for (size_t i = 0; i < sel_cols_.size(); ++i) {
-                const auto &col_meta = sel_col_metas_[i];
-                if (sel_cols_[i].aggFuncType == ast::COUNT) {
-                    int count_value = 0;
-                    has_count = true;
-                    std::memcpy(data_ptr, &count_value, sizeof(count_value));
-                    data_ptr += sizeof(count_value);
-                } else {
-                    switch (col_meta->type) {
-                        case TYPE_INT: {
-                            int default_value = INT_MAX;
-                            std::memcpy(data_ptr, &default_value, sizeof(default_value));
-                            data_ptr += sizeof(default_value);
-                            break;
-                        }
-                        case TYPE_FLOAT: {
-                            float default_value = FLT_MAX;
-                            std::memcpy(data_ptr, &default_value, sizeof(default_value));
-                            data_ptr += sizeof(default_value);
-                            break;
-                        }
-                        case TYPE_STRING: {
-                            std::string default_value(col_meta->len, '\0');
-                            std::memcpy(data_ptr, default_value.c_str(), col_meta->len);
-                            data_ptr += col_meta->len;
-                            break;
-                        }
-                        default:
-                            throw RMDBError();
-                    }
+        result_cnt_ = 0;
+        for (const auto &table: tables_) {
+            result_cnt_ += table.size();
+        }
+        // 没有数据时只有不分组的单个 COUNT 返回 0
+        if (result_cnt_ == 0 && group_by_cols_.empty() && sel_cols_.size() == 1 &&
+            sel_cols_[0].aggFuncType == ast::COUNT) {
+            results_.assign(TupleLen, 0);
+            result_cnt_ = 1;
+            return;
+        }
+        results_.resize(result_cnt_ * TupleLen);
+        char *data_ptr = results_.data();
+        for (const auto &table: tables_) {
+            for (size_t i = 0; i < table.size(); i++) {
+                const char *group = table.row(static_cast<uint32_t>(i));
+                for (const auto &agg: aggs_) {
+                    agg.output(data_ptr, group + agg.state_offset, agg.len);
+                    data_ptr += agg.len;
                 }
             }
-            if (has_count && sel_cols_.size() == 1 && group_by_cols_.empty()) {
-                results_.push_back(std::move(record));
-            }
-        } else {
-            // 正常处理聚合数据
-            for (const auto &entry: insert_order_) {
-                RmRecord record(TupleLen);
-                char *data_ptr = record.data;
-
-                // 将聚合值复制到结果记录中
-                for (const auto &val: group_map_[entry]) {
-                    switch (val.type) {
-                        case TYPE_INT:
-                            std::memcpy(data_ptr, &val.int_val, sizeof(val.int_val));
-                            data_ptr += sizeof(val.int_val);
-                            break;
-                        case TYPE_FLOAT:
-                            std::memcpy(data_ptr, &val.float_val, sizeof(val.float_val));
-                            data_ptr += sizeof(val.float_val);
-                            break;
-                        case TYPE_STRING:
-                            std::memcpy(data_ptr, val.str_val.c_str(), val.str_val.size());
-                            data_ptr += val.str_val.size();
-                            break;
-                        default:
-                            throw RMDBError();
-                    }
+        }
+    }
+
+    template<typename T>
+    static T load(const char *p) {
+        T v;
+        std::memcpy(&v, p, sizeof(T));
+        return v;
+    }
+
+    template<typename T>
+    static void store(char *p, T v) { std::memcpy(p, &v, sizeof(T)); }
+
+    // 按聚合函数和列类型选出特化的函数，返回状态的字节数
+    static int bind(Agg &agg, ast::AggFuncType func, ColType type) {
+        switch (func) {
+            case ast::COUNT:
+                agg.init = &init_zero<int>;
+                agg.update = &update_count;
+                agg.merge = &merge_sum<int>;
+                agg.output = &output_copy;
+                return sizeof(int);
+            case ast::SUM:
+                if (type == TYPE_INT) {
+                    return bind_sum<int>(agg);
+                } else if (type == TYPE_FLOAT) {
+                    return bind_sum<float>(agg);
+                }
+                throw RMDBError();
+            case ast::AVG:
+                if (type == TYPE_INT) {
+                    return bind_avg<int>(agg);
+                } else if (type == TYPE_FLOAT) {
+                    return bind_avg<float>(agg);
                 }
-                results_.push_back(std::move(record));
+                throw RMDBError();
+            case ast::MAX:
+                return bind_extreme<true>(agg, type);
+            case ast::MIN:
+                return bind_extreme<false>(agg, type);
+            case ast::default_type:
+                // 非聚合列取组内第一条记录的值
+                agg.init = &init_copy;
+                agg.update = nullptr;
+                agg.merge = nullptr;
+                agg.output = &output_copy;
+                return agg.len;
+            default:
+                throw RMDBError();
+        }
+    }
+
+    template<typename T>
+    static int bind_sum(Agg &agg) {
+        agg.init = &init_zero<T>;
+        agg.update = &update_sum<T>;
+        agg.merge = &merge_sum<T>;
+        agg.output = &output_copy;
+        return sizeof(T);
+    }
+
+    // AVG 的状态为 float 累加和与 int 计数
+    template<typename T>
+    static int bind_avg(Agg &agg) {
+        agg.init = &init_avg;
+        agg.update = &update_avg<T>;
+        agg.merge = &merge_avg;
+        agg.output = &output_avg;
+        return sizeof(float) + sizeof(int);
+    }
+
+    template<bool MAX>
+    static int bind_extreme(Agg &agg, ColType type) {
+        agg.init = &init_copy;
+        agg.output = &output_copy;
+        switch (type) {
+            case TYPE_INT:
+                agg.update = &update_extreme<int, MAX>;
+                agg.merge = &merge_extreme<int, MAX>;
+                break;
+            case TYPE_FLOAT:
+                agg.update = &update_extreme<float, MAX>;
+                agg.merge = &merge_extreme<float, MAX>;
+                break;
+            case TYPE_STRING:
+                agg.update = &update_extreme_str<MAX>;
+                agg.merge = &merge_extreme_str<MAX>;
+                break;
+            default:
+                throw RMDBError();
+        }
+        return agg.len;
+    }
+
+    template<typename T>
+    static void init_zero(char *state, const char *, int) { store<T>(state, T{}); }
+
+    static void init_copy(char *state, const char *value, int len) { std::memcpy(state, value, len); }
+
+    static void init_avg(char *state, const char *, int) {
+        store<float>(state, 0.0f);
+        store<int>(state + sizeof(float), 0);
+    }
+
+    static void update_count(const Agg &agg, char *const *groups, const TupleBatch &batch) {
+        for (size_t i = 0; i < batch.sel_size; i++) {
+            char *state = groups[i] + agg.state_offset;
+            store<int>(state, load<int>(state) + 1);
+        }
+    }
+
+    template<typename T>
+    static void update_sum(const Agg &agg, char *const *groups, const TupleBatch &batch) {
+        for (size_t i = 0; i < batch.sel_size; i++) {
+            char *state = groups[i] + agg.state_offset;
+            store<T>(state, load<T>(state) + load<T>(agg.value.in(batch.row(i))));
+        }
+    }
+
+    template<typename T>
+    static void update_avg(const Agg &agg, char *const *groups, const TupleBatch &batch) {
+        for (size_t i = 0; i < batch.sel_size; i++) {
+            char *state = groups[i] + agg.state_offset;
+            store<float>(state, load<float>(state) + load<T>(agg.value.in(batch.row(i))));
+            store<int>(state + sizeof(float), load<int>(state + sizeof(float)) + 1);
+        }
+    }
+
+    template<typename T, bool MAX>
+    static void update_extreme(const Agg &agg, char *const *groups, const TupleBatch &batch) {
+        for (size_t i = 0; i < batch.sel_size; i++) {
+            char *state = groups[i] + agg.state_offset;
+            T v = load<T>(agg.value.in(batch.row(i)));
+            if (MAX ? load<T>(state) < v : v < load<T>(state)) {
+                store<T>(state, v);
+            }
+        }
+    }
+
+    // 定长 CHAR 按全部字节比较
+    template<bool MAX>
+    static void update_extreme_str(const Agg &agg, char *const *groups, const TupleBatch &batch) {
+        for (size_t i = 0; i < batch.sel_size; i++) {
+            char *state = groups[i] + agg.state_offset;
+            const char *v = agg.value.in(batch.row(i));
+            int cmp = std::memcmp(state, v, agg.len);
+            if (MAX ? cmp < 0 : cmp > 0) {
+                std::memcpy(state, v, agg.len);
             }
         }
     }
+
+    template<typename T>
+    static void merge_sum(char *state, const char *other, int) { store<T>(state, load<T>(state) + load<T>(other)); }
+
+    static void merge_avg(char *state, const char *other, int) {
+        merge_sum<float>(state, other, 0);
+        merge_sum<int>(state + sizeof(float), other + sizeof(float), 0);
+    }
+
+    template<typename T, bool MAX>
+    static void merge_extreme(char *state, const char *other, int) {
+        T v = load<T>(other);
+        if (MAX ? load<T>(state) < v : v < load<T>(state)) {
+            store<T>(state, v);
+        }
+    }
+
+    template<bool MAX>
+    static void merge_extreme_str(char *state, const char *other, int len) {
+        int cmp = std::memcmp(state, other, len);
+        if (MAX ? cmp < 0 : cmp > 0) {
+            std::memcpy(state, other, len);
+        }
+    }
+
+    static void output_copy(char *dst, const char *state, int len) { std::memcpy(dst, state, len); }
+
+    static void output_avg(char *dst, const char *state, int) {
+        store<float>(dst, load<float>(state) / load<int>(state + sizeof(float)));
+    }
 };
 
 class HavingPlanExecutor : public AbstractExecutor {
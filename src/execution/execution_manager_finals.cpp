@@ -24,6 +24,7 @@ const char *help_info =
         "  DELETE FROM table_name [WHERE where_clause]\n"
         "  UPDATE table_name SET column_name = value [, column_name = value ...] [WHERE where_clause]\n"
         "  SELECT selector FROM table_name [WHERE where_clause]\n"
+        "  ANALYZE [table_name]\n"
         "type:\n"
         "  {INT | FLOAT | CHAR(n)}\n"
         "where_clause:\n"
@@ -68,8 +69,7 @@ void QlManager::run_cmd_utility(const std::shared_ptr<Plan> &plan, txn_id_t *txn
     if (auto x = std::dynamic_pointer_cast<OtherPlan>(plan)) {
         switch (x->tag) {
             case T_Help: {
-                std::memcpy(context->data_send_ + *(context->offset_), help_info, strlen(help_info));
-                *(context->offset_) = strlen(help_info);
+                context->send_buf_->append(help_info, strlen(help_info));
                 break;
             }
             case T_ShowTable: {
@@ -128,11 +128,23 @@ void QlManager::run_cmd_utility(const std::shared_ptr<Plan> &plan, txn_id_t *txn
                 sm_manager_->io_enabled_ = x->io_enable_;
                 break;
             }
+            case T_Analyze: {
+                sm_manager_->analyze(x->tab_name_);
+                break;
+            }
             default:
                 throw RMDBError();
         }
     } else if (auto x = std::dynamic_pointer_cast<SetKnobPlan>(plan)) {
         switch (x->set_knob_type_) {
+            case ast::SetKnobType::ParallelDegree: {
+                // 会话级设置，只影响之后构造的执行器，不改变计划
+                if (x->int_value_ < 1) {
+                    throw RMDBError();
+                }
+                context->parallel_degree_ = x->int_value_;
+                return;
+            }
             case ast::SetKnobType::EnableNestLoop: {
                 planner_->set_enable_nestedloop_join(x->bool_value_);
                 break;
@@ -141,10 +153,16 @@ void QlManager::run_cmd_utility(const std::shared_ptr<Plan> &plan, txn_id_t *txn
                 planner_->set_enable_sortmerge_join(x->bool_value_);
                 break;
             }
+            case ast::SetKnobType::EnableHashJoin: {
+                planner_->set_enable_hash_join(x->bool_value_);
+                break;
+            }
             default: {
                 throw RMDBError();
             }
         }
+        // 连接算法的开关会改变计划，已缓存的计划作废
+        sm_manager_->schema_version_++;
     }
 }
 
@@ -188,60 +206,72 @@ void QlManager::select_from(std::unique_ptr<AbstractExecutor> executorTreeRoot,
     rec_printer.print_record(captions, context);
     rec_printer.print_separator(context);
     // print header into file
-    std::fstream outfile;
+    auto &output = *context->output_;
     if (sm_manager_->io_enabled_) {
-        outfile.open("output.txt", std::ios::out | std::ios::app);
-        outfile << "|";
+        output += "|";
         for (const auto &caption: captions) {
-            outfile << " " << caption << " |";
+            output += " ";
+            output += caption;
+            output += " |";
         }
-        outfile << "\n";
+        output += "\n";
     }
 
     // Print records
     size_t num_rec = 0;
-    // 执行query_plan
-    for (executorTreeRoot->beginTuple(); !executorTreeRoot->is_end(); executorTreeRoot->nextTuple()) {
-        if (!sm_manager_->io_enabled_ && context->data_send_is_full()) {
-            break;
-        }
-        auto Tuple = executorTreeRoot->Next();
-        std::vector<std::string> columns;
-        for (auto &col: executorTreeRoot->cols()) {
-            std::string col_str;
-            char *rec_buf = Tuple->data + col.offset;
-            if (col.type == TYPE_INT) {
-                auto val = *(int *) rec_buf;
-                if (val == INT_MAX)
-                    col_str = "";
-                else
-                    col_str = std::to_string(*(int *) rec_buf);
-            } else if (col.type == TYPE_FLOAT) {
-                auto val = *(float *) rec_buf;
-                if (val == FLT_MAX)
-                    col_str = "";
-                else
-                    col_str = std::to_string(*(float *) rec_buf);
-            } else if (col.type == TYPE_STRING) {
-                col_str = std::string((char *) rec_buf, col.len);
-                col_str.resize(strlen(col_str.c_str()));
+    // 执行query_plan，按批取结果。连接输出的是分段记录，每列先定位到所在的段
+    std::vector<FieldRef> fields;
+    SegLayout layout(executorTreeRoot->seg_lens());
+    for (auto &col: executorTreeRoot->cols()) {
+        fields.push_back(layout.locate(col.offset));
+    }
+    executorTreeRoot->beginBatch();
+    TupleBatch batch;
+    bool send_full = false;
+    while (!send_full && executorTreeRoot->NextBatch(batch) > 0) {
+        for (size_t i = 0; i < batch.sel_size; i++) {
+            if (!sm_manager_->io_enabled_ && context->data_send_is_full()) {
+                send_full = true;
+                break;
             }
-            columns.push_back(col_str);
-        }
-        // print record into buffer
-        rec_printer.print_record(columns, context);
-        // print record into file
-        if (sm_manager_->io_enabled_) {
-            outfile << "|";
-            for (const auto &column: columns) {
-                outfile << " " << column << " |";
+            std::vector<std::string> columns;
+            auto segs = batch.row(i);
+            auto field = fields.begin();
+            for (auto &col: executorTreeRoot->cols()) {
+                std::string col_str;
+                const char *rec_buf = (field++)->in(segs);
+                if (col.type == TYPE_INT) {
+                    auto val = *(int *) rec_buf;
+                    if (val == INT_MAX)
+                        col_str = "";
+                    else
+                        col_str = std::to_string(*(int *) rec_buf);
+                } else if (col.type == TYPE_FLOAT) {
+                    auto val = *(float *) rec_buf;
+                    if (val == FLT_MAX)
+                        col_str = "";
+                    else
+                        col_str = std::to_string(*(float *) rec_buf);
+                } else if (col.type == TYPE_STRING) {
+                    col_str = std::string((char *) rec_buf, col.len);
+                    col_str.resize(strlen(col_str.c_str()));
+                }
+                columns.push_back(col_str);
+            }
+            // print record into buffer
+            rec_printer.print_record(columns, context);
+            // print record into file
+            if (sm_manager_->io_enabled_) {
+                output += "|";
+                for (const auto &column: columns) {
+                    output += " ";
+                    output += column;
+                    output += " |";
+                }
+                output += "\n";
             }
-            outfile << "\n";
+            num_rec++;
         }
-        num_rec++;
-    }
-    if (sm_manager_->io_enabled_) {
-        outfile.close();
     }
     // Print footer into buffer
     rec_printer.print_separator(context);
@@ -263,39 +293,43 @@ std::unordered_set<Value> QlManager::sub_select_from(std::unique_ptr<AbstractExe
     const auto &col = executorTreeRoot->cols()[0];
 
     // 执行query_plan
-    for (executorTreeRoot->beginTuple(); !executorTreeRoot->is_end(); executorTreeRoot->nextTuple()) {
-        auto Tuple = executorTreeRoot->Next();
-        char *rec_buf = Tuple->data + col.offset;
-        Value value;
-        switch (col.type) {
-            case TYPE_INT: {
-                auto val = *reinterpret_cast<int *>(rec_buf);
-                if (val != INT_MAX) {
-                    if (!converse_to_float)
-                        value.set_int(val);
-                    else
-                        value.set_float(static_cast<float>(val));
+    auto field = SegLayout(executorTreeRoot->seg_lens()).locate(col.offset);
+    executorTreeRoot->beginBatch();
+    TupleBatch batch;
+    while (executorTreeRoot->NextBatch(batch) > 0) {
+        for (size_t i = 0; i < batch.sel_size; i++) {
+            const char *rec_buf = field.in(batch.row(i));
+            Value value;
+            switch (col.type) {
+                case TYPE_INT: {
+                    auto val = *reinterpret_cast<const int *>(rec_buf);
+                    if (val != INT_MAX) {
+                        if (!converse_to_float)
+                            value.set_int(val);
+                        else
+                            value.set_float(static_cast<float>(val));
+                    }
+                    break;
                 }
-                break;
-            }
-            case TYPE_FLOAT: {
-                auto val = *reinterpret_cast<float *>(rec_buf);
-                if (val != FLT_MAX) {
-                    value.set_float(val);
+                case TYPE_FLOAT: {
+                    auto val = *reinterpret_cast<const float *>(rec_buf);
+                    if (val != FLT_MAX) {
+                        value.set_float(val);
+                    }
+                    break;
+                }
+                case TYPE_STRING: {
+                    std::string col_str(reinterpret_cast<const char *>(rec_buf), col.len);
+                    col_str.resize(strlen(col_str.c_str()));
+                    value.set_str(col_str);
+                    break;
+                }
+                default: {
+                    throw RMDBError();
                 }
-                break;
-            }
-            case TYPE_STRING: {
-                std::string col_str(reinterpret_cast<char *>(rec_buf), col.len);
-                col_str.resize(strlen(col_str.c_str()));
-                value.set_str(col_str);
-                break;
-            }
-            default: {
-                throw RMDBError();
             }
+            results.insert(value);
         }
-        results.insert(value);
     }
 
     return results;
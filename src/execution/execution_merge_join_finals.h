@@ -3,6 +3,8 @@
 #include <fstream>
 #include <utility>
 
+#include "common/predicate_finals.h"
+
 //
 // Created by root on 24-6-12.
 //
@@ -21,6 +23,7 @@ private:
     std::vector<std::string> tables;
 
     std::vector<Condition> join_conds_; // 连接条件
+    Predicate conds_pred_;              // 编译后的连接条件，第 0 段为左记录，第 1 段为右记录
 
     // 等值连接左列属性
     std::vector<ColMeta>::const_iterator left_join_col;
@@ -31,6 +34,7 @@ private:
     std::unique_ptr<RmRecord> right_record_;
     bool left_end_;
     bool right_end_;
+    std::vector<char> join_buf_; // Next 返回的记录，在下一次调用 Next 前有效
 
 public:
     MergeJoinExecutor(std::unique_ptr<AbstractExecutor> left, std::unique_ptr<AbstractExecutor> right, std::vector<Condition> conds, const TabCol &left_col, const TabCol &right_col, std::vector<std::string> tables_) : left_executor_(std::move(left)), right_executor_(std::move(right)), tables(std::move(tables_)), join_conds_(std::move(conds))
@@ -43,6 +47,15 @@ public:
             col.offset += left_executor_->tupleLen();
         }
         columns_.insert(columns_.end(), right_columns.begin(), right_columns.end());
+        join_buf_.resize(tuple_length_);
+
+        int left_len = static_cast<int>(left_executor_->tupleLen());
+        for (auto &cond : join_conds_)
+        {
+            auto lhs = get_col(columns_, cond.lhs_col);
+            auto rhs = get_col(columns_, cond.rhs_col);
+            conds_pred_.add({0, lhs->offset, lhs->len, lhs->type}, cond.op, {1, rhs->offset - left_len, rhs->len, rhs->type});
+        }
 
         left_join_col = get_col(left_executor_->cols(), left_col);
         right_join_col = get_col(right_executor_->cols(), right_col);
@@ -75,11 +88,10 @@ public:
     std::unique_ptr<RmRecord> Next() override
     {
         // assert(!is_end());
-        auto join_record = std::make_unique<RmRecord>(tuple_length_);
-        memcpy(join_record->data, left_record_->data, left_executor_->tupleLen());
-        memcpy(join_record->data + left_executor_->tupleLen(), right_record_->data, right_executor_->tupleLen());
+        memcpy(join_buf_.data(), left_record_->data, left_executor_->tupleLen());
+        memcpy(join_buf_.data() + left_executor_->tupleLen(), right_record_->data, right_executor_->tupleLen());
 
-        return join_record;
+        return std::make_unique<RmRecord>(join_buf_.data(), static_cast<int>(tuple_length_));
     }
 
     size_t tupleLen() const override { return tuple_length_; }
@@ -121,39 +133,10 @@ private:
         }
     }
 
-    bool evaluateCondition(const RmRecord *left_record, const RmRecord *right_record, const Condition &cond)
-    {
-        auto lhs_column_meta = get_col(columns_, cond.lhs_col);
-        auto rhs_column_meta = get_col(columns_, cond.rhs_col);
-        auto lhs_data = left_record->data + lhs_column_meta->offset;
-        auto rhs_data = right_record->data + rhs_column_meta->offset - left_executor_->tupleLen();
-        ColType rhs_type = rhs_column_meta->type;
-        if (lhs_column_meta->type != rhs_type)
-        {
-            return false;
-        }
-        int comparison_result = compareValues(lhs_data, rhs_data, lhs_column_meta->len, rhs_type);
-        switch (cond.op)
-        {
-        case OP_EQ:
-            return comparison_result == 0;
-        case OP_LT:
-            return comparison_result < 0;
-        case OP_GT:
-            return comparison_result > 0;
-        case OP_LE:
-            return comparison_result <= 0;
-        case OP_GE:
-            return comparison_result >= 0;
-        default:
-            throw RMDBError();
-        }
-    }
-
     bool evaluateConditions(const RmRecord *left_record, const RmRecord *right_record)
     {
-        return std::all_of(join_conds_.begin(), join_conds_.end(), [&](const Condition &cond)
-                           { return evaluateCondition(left_record, right_record, cond); });
+        const char *segs[2] = {left_record->data, right_record->data};
+        return conds_pred_.eval(segs);
     }
 
     static int compareValues(const char *a, const char *b, int column_length, ColType column_type)
@@ -168,8 +151,8 @@ private:
         }
         case TYPE_FLOAT:
         {
-            double af = *(double *)a;
-            double bf = *(double *)b;
+            float af = *(float *)a;
+            float bf = *(float *)b;
             return af > bf ? 1 : (af < bf ? -1 : 0);
         }
         case TYPE_STRING:
@@ -0,0 +1,291 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "executor_abstract_finals.h"
+#include "record/rm_file_handle_finals.h"
+#include "transaction/concurrency/lock_manager_finals.h"
+
+// 查询内并行用的工作线程池，线程数等于核数，所有会话共用。
+// 提交的任务不能阻塞等待别的任务，否则线程被占满时会互相等待
+class WorkerPool
+{
+public:
+    static WorkerPool &instance()
+    {
+        static WorkerPool pool(std::max(1u, std::thread::hardware_concurrency()));
+        return pool;
+    }
+
+    ~WorkerPool()
+    {
+        {
+            std::lock_guard lk(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto &worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    void submit(std::function<void()> task)
+    {
+        {
+            std::lock_guard lk(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        cv_.notify_one();
+    }
+
+    // 用 dop 个线程（调用线程加 dop - 1 个池中线程）执行 fn(worker, i)，i 取遍 [0, n)，worker 在 [0, dop) 内，
+    // 同一个 worker 的调用不会并发。调用线程也领取任务，池中线程迟迟不开始时不会卡住，返回前等它们全部退出
+    template <typename Fn>
+    static void run(size_t dop, size_t n, Fn &&fn)
+    {
+        struct Shared
+        {
+            std::atomic<size_t> next{0};
+            std::mutex mutex;
+            std::condition_variable cv;
+            size_t pending = 0;
+        } shared;
+        auto loop = [&](size_t worker)
+        {
+            for (size_t i = shared.next.fetch_add(1); i < n; i = shared.next.fetch_add(1))
+            {
+                fn(worker, i);
+            }
+        };
+        size_t helpers = std::min(dop, n) > 0 ? std::min(dop, n) - 1 : 0;
+        shared.pending = helpers;
+        for (size_t w = 1; w <= helpers; w++)
+        {
+            instance().submit([&shared, &loop, w]
+                              {
+                                  loop(w);
+                                  std::lock_guard lk(shared.mutex);
+                                  shared.pending--;
+                                  shared.cv.notify_all();
+                              });
+        }
+        loop(0);
+        std::unique_lock lk(shared.mutex);
+        shared.cv.wait(lk, [&shared] { return shared.pending == 0; });
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::thread> workers_;
+    bool stop_ = false;
+
+    explicit WorkerPool(size_t num_workers)
+    {
+        for (size_t i = 0; i < num_workers; i++)
+        {
+            workers_.emplace_back([this] { worker_loop(); });
+        }
+    }
+
+    void worker_loop()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock lk(mutex_);
+                cv_.wait(lk, [this] { return stop_ || !tasks_.empty(); });
+                if (stop_ && tasks_.empty())
+                {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+};
+
+// 表的哈希集按桶切成的 morsel，各 morsel 可以在不同线程中同时扫描
+class MorselScan
+{
+public:
+    static constexpr size_t MORSEL_BUCKETS = 16384;
+
+    MorselScan(const RmFileHandle *fh, const Gap *gap) : fh_(fh), gap_(gap)
+    {
+        buckets_ = fh_->records_.bucket_count();
+    }
+
+    // 表足够大时才值得并行
+    static bool worth(const RmFileHandle *fh, int dop) { return dop > 1 && fh->records_.bucket_count() >= 2 * MORSEL_BUCKETS; }
+
+    size_t morsels() const { return (buckets_ + MORSEL_BUCKETS - 1) / MORSEL_BUCKETS; }
+
+    // 扫描第 m 个 morsel，用 Gap 过滤后按批写入 batch 交给 emit，每批都不为空
+    template <typename Emit>
+    void scan(size_t m, TupleBatch &batch, Emit &&emit) const
+    {
+        const auto &records = fh_->records_;
+        size_t end = std::min(buckets_, (m + 1) * MORSEL_BUCKETS);
+        batch.clear();
+        for (size_t b = m * MORSEL_BUCKETS; b < end; b++)
+        {
+            for (auto it = records.begin(b); it != records.end(b); ++it)
+            {
+                if (gap_->overlap(*it))
+                {
+                    batch.append(*it);
+                    if (batch.full())
+                    {
+                        emit(batch);
+                        batch.clear();
+                    }
+                }
+            }
+        }
+        if (batch.sel_size > 0)
+        {
+            emit(batch);
+        }
+    }
+
+private:
+    const RmFileHandle *fh_;
+    const Gap *gap_;
+    size_t buckets_;
+};
+
+// 并行顺序扫描的交换算子。工作线程每次领取一个 morsel，选中的记录指针按批放进队列，
+// 由父算子所在的线程通过 next 取走。
+// 队列积压到 dop 批时工作线程做完手上的 morsel 就退出，取走结果后再重新派发，工作线程从不阻塞；
+// 队列为空时取结果的线程自己领取 morsel 扫描，线程池被其他查询占满时也能继续推进
+class ScanExchange
+{
+public:
+    ScanExchange(const RmFileHandle *fh, const Gap *gap, int dop) : scan_(fh, gap), dop_(static_cast<size_t>(dop))
+    {
+        morsels_ = scan_.morsels();
+        std::lock_guard lk(mutex_);
+        dispatch();
+    }
+
+    // 等所有派发出去的任务退出，之后它们不会再访问表和 Gap
+    ~ScanExchange()
+    {
+        std::unique_lock lk(mutex_);
+        stop_ = true;
+        cv_.wait(lk, [this] { return workers_ == 0; });
+    }
+
+    ScanExchange(const ScanExchange &) = delete;
+    ScanExchange &operator=(const ScanExchange &) = delete;
+
+    size_t next(TupleBatch &batch)
+    {
+        batch.clear();
+        std::vector<char *> chunk;
+        {
+            std::unique_lock lk(mutex_);
+            while (ready_.empty())
+            {
+                if (finished_ == morsels_)
+                {
+                    return 0;
+                }
+                lk.unlock();
+                size_t m = next_morsel_.fetch_add(1);
+                if (m < morsels_)
+                {
+                    scan_morsel(m);
+                    lk.lock();
+                    continue;
+                }
+                lk.lock();
+                cv_.wait(lk, [this] { return !ready_.empty() || finished_ == morsels_; });
+            }
+            chunk = std::move(ready_.front());
+            ready_.pop_front();
+            dispatch();
+        }
+        for (char *rid : chunk)
+        {
+            batch.append(rid);
+        }
+        return batch.sel_size;
+    }
+
+private:
+    MorselScan scan_;
+    size_t dop_;
+    size_t morsels_;
+    std::atomic<size_t> next_morsel_{0};
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::vector<char *>> ready_; // 已过滤好的记录，每批不超过 TupleBatch::CAPACITY 条
+    size_t finished_ = 0;                   // 扫描完的 morsel 数
+    size_t workers_ = 0;                    // 已派发还没退出的任务数
+    bool stop_ = false;
+
+    // 调用方持有 mutex_。取结果的线程也算一个，工作线程最多 dop - 1 个
+    void dispatch()
+    {
+        while (!stop_ && workers_ + 1 < dop_ && ready_.size() < dop_ && next_morsel_.load() < morsels_)
+        {
+            workers_++;
+            WorkerPool::instance().submit([this] { work(); });
+        }
+    }
+
+    void work()
+    {
+        while (true)
+        {
+            {
+                std::lock_guard lk(mutex_);
+                if (stop_ || ready_.size() >= dop_)
+                {
+                    break;
+                }
+            }
+            size_t m = next_morsel_.fetch_add(1);
+            if (m >= morsels_)
+            {
+                break;
+            }
+            scan_morsel(m);
+        }
+        std::lock_guard lk(mutex_);
+        workers_--;
+        cv_.notify_all();
+    }
+
+    void scan_morsel(size_t m)
+    {
+        TupleBatch batch;
+        scan_.scan(m, batch, [this](const TupleBatch &b)
+                   {
+                       std::lock_guard lk(mutex_);
+                       ready_.emplace_back(b.segs.begin(), b.segs.begin() + b.size);
+                       cv_.notify_all();
+                   });
+        std::lock_guard lk(mutex_);
+        finished_++;
+        cv_.notify_all();
+    }
+};
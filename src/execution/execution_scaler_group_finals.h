@@ -5,23 +5,66 @@
 #ifndef RMDB_EXECUTION_SCALER_GROUP_FINALS_H
 #define RMDB_EXECUTION_SCALER_GROUP_FINALS_H
 
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
 #include "executor_abstract_finals.h"
 #include "executor_index_scan_finals.h"
 
-
+// 从索引两端取 MIN/MAX 的标量聚合，由规划器在 choose_minmax_index 中选定索引。
+// 条件把索引前缀各列固定为常量，聚合列紧跟其后，满足条件的记录在索引上是连续的一段且按聚合列有序：
+// MIN 是这一段的第一条，MAX 是最后一条，各用一次 lower_bound / upper_bound 定位，不扫描记录。
+// 没有满足条件的记录时与 AggPlanExecutor 一致，不输出结果
 class ScalerAggPlanExecutor : public AbstractExecutor {
 private:
-    TabCol sel_col_;
-    std::unique_ptr<AbstractExecutor> child_executor_;
+    RmFileHandle *fh_;
+    IxIndexHandle *ih_;
+    PoolManager *memory_pool_manager_;
+    std::vector<TabCol> sel_cols_;
     std::vector<ColMeta> output_cols_;
-    Value result_;
-    bool computed_;
-    size_t len_;
+    ColMeta agg_col_;            // 聚合列在表记录中的位置
+    char *lower_key_;            // 索引前缀取条件中的值，其余列取类型最小值
+    char *upper_key_;            // 同上，其余列取类型最大值
+    std::vector<char> result_;   // 唯一的一条结果记录
+    size_t len_ = 0;
+    bool is_end_ = true;
 
 public:
-    ScalerAggPlanExecutor(std::unique_ptr<AbstractExecutor> child_executor, TabCol tc,
-                          Context *context) : sel_col_(std::move(tc)), child_executor_(std::move(child_executor)), computed_(false) {
-        initialize();
+    ScalerAggPlanExecutor(SmManager *sm_manager, const std::string &tab_name, const std::vector<Condition> &conds,
+                          const IndexMeta &index_meta, std::vector<TabCol> sel_cols, Context *context)
+            : sel_cols_(std::move(sel_cols)) {
+        auto tab = sm_manager->db_.get_table(tab_name);
+        fh_ = sm_manager->fhs_[tab->fd_].get();
+        ih_ = sm_manager->ihs_[index_meta.fd_].get();
+        memory_pool_manager_ = sm_manager->memory_pool_manager_;
+        agg_col_ = tab->get_col(sel_cols_.front().col_name);
+
+        for (const auto &col: sel_cols_) {
+            auto col_meta = agg_col_;
+            col_meta.offset = static_cast<int>(len_);
+            col_meta.agg_func_type = col.aggFuncType;
+            len_ += col_meta.len;
+            output_cols_.push_back(col_meta);
+        }
+        result_.resize(len_);
+
+        lower_key_ = memory_pool_manager_->allocate(fh_->record_size);
+        upper_key_ = memory_pool_manager_->allocate(fh_->record_size);
+        for (const auto &col: index_meta.cols_) {
+            set_min_max(col);
+        }
+        for (const auto &cond: conds) {
+            const auto &col = tab->get_col(cond.lhs_col.col_name);
+            memcpy(lower_key_ + col.offset, cond.rhs_val.raw->data, col.len);
+            memcpy(upper_key_ + col.offset, cond.rhs_val.raw->data, col.len);
+        }
+    }
+
+    ~ScalerAggPlanExecutor() override {
+        memory_pool_manager_->deallocate(lower_key_, fh_->record_size);
+        memory_pool_manager_->deallocate(upper_key_, fh_->record_size);
     }
 
     size_t tupleLen() const override { return len_; }
@@ -29,171 +72,52 @@ public:
     const std::vector<ColMeta> &cols() const override { return output_cols_; }
 
     void beginTuple() override {
-        if (!computed_) {
-            performAggregation();
-            computed_ = true;
+        auto first = ih_->lower_bound(lower_key_);
+        auto end = ih_->upper_bound(upper_key_);
+        is_end_ = first == end;
+        if (is_end_) {
+            return;
+        }
+        auto last = end;
+        --last;
+        for (size_t i = 0; i < sel_cols_.size(); i++) {
+            const char *rid = sel_cols_[i].aggFuncType == ast::MIN ? *first : *last;
+            memcpy(result_.data() + output_cols_[i].offset, rid + agg_col_.offset, agg_col_.len);
         }
     }
 
-    void nextTuple() override {
-        // 标量聚合只有一个结果，调用nextTuple后就结束
-        computed_ = true;
-    }
+    void nextTuple() override { is_end_ = true; }
 
     std::unique_ptr<RmRecord> Next() override {
-        if (computed_) {
+        if (is_end_) {
             return nullptr;
         }
-        
-        auto record = std::make_unique<RmRecord>(len_);
-        
-        // 将聚合结果写入记录
-        switch (result_.type) {
-            case TYPE_INT:
-                memcpy(record->data, &result_.int_val, sizeof(int));
-                break;
-            case TYPE_FLOAT:
-                memcpy(record->data, &result_.float_val, sizeof(float));
-                break;
-            case TYPE_STRING:
-                memcpy(record->data, result_.str_val.c_str(), result_.str_val.length());
-                break;
-        }
-        
-        return record;
+        return std::make_unique<RmRecord>(result_.data(), static_cast<int>(len_));
     }
 
-    bool is_end() const override { return computed_; }
+    bool is_end() const override { return is_end_; }
 
 private:
-    void can_fetch_from_index() {
-        if (child_executor_) {
-            // 修复：使用 dynamic_cast 而不是 dynamic_pointer_cast
-            if (auto child = dynamic_cast<IndexScanExecutor*>(child_executor_.get())) {
-                // if ()
-                return;
-            }
-
-        }
-    }
-
-    void initialize() {
-        // 初始化输出列
-        ColMeta col_meta;
-        col_meta.tab_name = sel_col_.tab_name;
-        col_meta.name = sel_col_.col_name;
-        col_meta.agg_func_type = sel_col_.aggFuncType;
-        col_meta.offset = 0;
-        
-        // 根据聚合函数类型设置数据类型和长度
-        switch (sel_col_.aggFuncType) {
-            case ast::COUNT:
-                col_meta.type = TYPE_INT;
-                col_meta.len = sizeof(int);
+    void set_min_max(const ColMeta &col) {
+        switch (col.type) {
+            case TYPE_INT: {
+                int min_int = std::numeric_limits<int>::min();
+                int max_int = std::numeric_limits<int>::max();
+                memcpy(lower_key_ + col.offset, &min_int, sizeof(int));
+                memcpy(upper_key_ + col.offset, &max_int, sizeof(int));
                 break;
-            case ast::AVG:
-                col_meta.type = TYPE_FLOAT;
-                col_meta.len = sizeof(float);
-                break;
-            default: {
-                // 对于SUM、MAX、MIN，类型与原列相同
-                auto child_col = get_col(child_executor_->cols(), sel_col_);
-                col_meta.type = child_col->type;
-                col_meta.len = child_col->len;
-                break;
-            }
-        }
-        
-        len_ = col_meta.len;
-        output_cols_.push_back(col_meta);
-    }
-
-    void performAggregation() {
-        child_executor_->beginTuple();
-        
-        // 初始化聚合值
-        bool first = true;
-        int count = 0;
-        float sum = 0.0f;
-        
-        for (; !child_executor_->is_end(); child_executor_->nextTuple()) {
-            auto record = child_executor_->Next();
-            
-            if (sel_col_.aggFuncType == ast::COUNT) {
-                count++;
-                continue;
-            }
-            
-            // 获取列值
-            auto col_meta = get_col(child_executor_->cols(), sel_col_);
-            Value value;
-            
-            switch (col_meta->type) {
-                case TYPE_INT:
-                    value.set_int(*reinterpret_cast<int*>(record->data + col_meta->offset));
-                    break;
-                case TYPE_FLOAT:
-                    value.set_float(*reinterpret_cast<float*>(record->data + col_meta->offset));
-                    break;
-                case TYPE_STRING:
-                    value.set_str(std::string(record->data + col_meta->offset, col_meta->len));
-                    break;
             }
-            
-            // 执行聚合操作
-            switch (sel_col_.aggFuncType) {
-                case ast::SUM:
-                    if (first) {
-                        result_ = value;
-                        first = false;
-                    } else {
-                        if (value.type == TYPE_INT) {
-                            result_.int_val += value.int_val;
-                        } else if (value.type == TYPE_FLOAT) {
-                            result_.float_val += value.float_val;
-                        }
-                    }
-                    break;
-                case ast::AVG:
-                    count++;
-                    if (value.type == TYPE_INT) {
-                        sum += value.int_val;
-                    } else if (value.type == TYPE_FLOAT) {
-                        sum += value.float_val;
-                    }
-                    break;
-                case ast::MAX:
-                    if (first) {
-                        result_ = value;
-                        first = false;
-                    } else {
-                        if ((value.type == TYPE_INT && result_.int_val < value.int_val) ||
-                            (value.type == TYPE_FLOAT && result_.float_val < value.float_val) ||
-                            (value.type == TYPE_STRING && result_.str_val < value.str_val)) {
-                            result_ = value;
-                        }
-                    }
-                    break;
-                case ast::MIN:
-                    if (first) {
-                        result_ = value;
-                        first = false;
-                    } else {
-                        if ((value.type == TYPE_INT && result_.int_val > value.int_val) ||
-                            (value.type == TYPE_FLOAT && result_.float_val > value.float_val) ||
-                            (value.type == TYPE_STRING && result_.str_val > value.str_val)) {
-                            result_ = value;
-                        }
-                    }
-                    break;
+            case TYPE_FLOAT: {
+                float min_float = std::numeric_limits<float>::lowest();
+                float max_float = std::numeric_limits<float>::max();
+                memcpy(lower_key_ + col.offset, &min_float, sizeof(float));
+                memcpy(upper_key_ + col.offset, &max_float, sizeof(float));
+                break;
             }
-        }
-        
-        // 设置最终结果
-        if (sel_col_.aggFuncType == ast::COUNT) {
-            result_.set_int(count);
-        } else if (sel_col_.aggFuncType == ast::AVG) {
-            result_.set_float(count > 0 ? sum / count : 0.0f);
+            default:
+                memset(lower_key_ + col.offset, 0x00, col.len);
+                memset(upper_key_ + col.offset, 0xff, col.len);
+                break;
         }
     }
 };
@@ -1,35 +1,67 @@
 #pragma once
 
 #include <algorithm>
-#include <cassert>
+#include <cstdint>
 #include <cstring>
-#include <fstream>
-#include <functional>
 #include <memory>
-#include <queue>
 #include <vector>
 
 #include "execution_manager_finals.h"
+#include "execution_parallel_finals.h"
 #include "executor_abstract_finals.h"
 
+// 排序算子。子节点的记录先物化到 rows_，再把每条记录的各排序列编码成一个归一化键：
+// 按字节无符号比较的结果与按列依次比较一致，降序列的字节取反。
+// 排序的对象是 (键的前 8 字节, 行号)，先按前缀做稳定的 LSD 基数排序，前缀相同的再比较键的剩余部分。
+// 记录多且并行度大于 1 时分块并行编码、排序，再两两归并。
+// 上层只需要前 limit_ 条（LIMIT 下推）时不物化全部记录，用大小为 limit_ 的堆保留最小的 limit_ 条
 class SortExecutor : public AbstractExecutor
 {
 private:
+    // 一个排序列在记录中的位置，以及编码后在键中的位置
+    struct Key
+    {
+        int offset;
+        int len;
+        ColType type;
+        bool is_desc;
+        int key_offset;
+    };
+
+    struct Entry
+    {
+        uint64_t prefix; // 键的前 8 字节按大端组成的整数，不足 8 字节时低位补零
+        uint32_t idx;    // 行号
+    };
+
+    static constexpr size_t PARALLEL_MIN_ROWS = 65536; // 每块至少这么多行才分块并行
+    static constexpr size_t RADIX_MIN_ROWS = 256;      // 更少时直接比较排序
+
     std::unique_ptr<AbstractExecutor> prev_;
-    ColMeta col_;  // 单字段排序
-    bool is_desc_; // 题目要求升序
+    std::vector<Key> keys_;
+    size_t key_len_ = 0; // 归一化键的长度
+    size_t dop_;
+    size_t limit_; // 只输出排序后的前 limit_ 条
     size_t tuple_num;
-    std::vector<std::unique_ptr<RmRecord>> tuples_;
+    std::vector<char> rows_;     // 物化的子节点记录
+    std::vector<char> norm_;     // 各行的归一化键，排序完成后释放
+    std::vector<char *> tuples_; // 排序后的记录，指向 rows_
     size_t current_index;
     size_t len_;
 
 public:
-    SortExecutor(std::unique_ptr<AbstractExecutor> prev, const TabCol &sel_col) : prev_(std::move(prev)), current_index(0)
+    SortExecutor(std::unique_ptr<AbstractExecutor> prev, const std::vector<SortKey> &keys, Context *context, size_t limit = SIZE_MAX) : prev_(std::move(prev)), limit_(limit), current_index(0)
     {
-        col_ = *get_col(prev_->cols(), sel_col);
+        for (const auto &key : keys)
+        {
+            auto col = get_col(prev_->cols(), key.col);
+            int len = col->type == TYPE_STRING ? col->len : 4;
+            keys_.push_back({col->offset, len, col->type, key.is_desc, static_cast<int>(key_len_)});
+            key_len_ += len;
+        }
         len_ = prev_->tupleLen();
         tuple_num = 0;
-        is_desc_ = false;
+        dop_ = static_cast<size_t>(std::max(1, context->parallel_degree_));
     }
 
     void beginTuple() override
@@ -54,7 +86,17 @@ public:
         {
             return nullptr;
         }
-        return std::make_unique<RmRecord>(*tuples_[current_index]);
+        return std::make_unique<RmRecord>(tuples_[current_index], static_cast<int>(len_));
+    }
+
+    size_t NextBatch(TupleBatch &batch) override
+    {
+        batch.clear();
+        for (; !batch.full() && current_index < tuples_.size(); ++current_index)
+        {
+            batch.append(tuples_[current_index]);
+        }
+        return batch.sel_size;
     }
 
     bool is_end() const override { return tuples_.empty() || current_index >= tuples_.size(); }
@@ -68,56 +110,300 @@ public:
 private:
     void get_sort_next_tuples()
     {
-        for (prev_->beginTuple(); !prev_->is_end(); prev_->nextTuple())
+        if (limit_ != SIZE_MAX)
+        {
+            top_n();
+            return;
+        }
+        TupleBatch batch;
+        SegLayout layout(prev_->seg_lens());
+        prev_->beginBatch();
+        while (prev_->NextBatch(batch) != 0)
+        {
+            rows_.resize(rows_.size() + batch.sel_size * len_);
+            char *dst = rows_.data() + tuple_num * len_;
+            for (size_t i = 0; i < batch.sel_size; i++, dst += len_)
+            {
+                layout.gather(batch.row(i), dst);
+            }
+            tuple_num += batch.sel_size;
+        }
+        if (tuple_num == 0)
+            return;
+
+        std::vector<Entry> entries(tuple_num);
+        std::vector<Entry> tmp(tuple_num);
+        norm_.resize(tuple_num * key_len_);
+        size_t chunks = std::min(dop_, tuple_num / PARALLEL_MIN_ROWS);
+        if (chunks <= 1)
+        {
+            sort_chunk(entries.data(), tmp.data(), 0, tuple_num);
+        }
+        else
+        {
+            // 各块编码、排序后得到 chunks 个有序段，每轮把相邻两段归并成一段
+            std::vector<size_t> bounds(chunks + 1);
+            for (size_t c = 0; c <= chunks; c++)
+            {
+                bounds[c] = tuple_num * c / chunks;
+            }
+            WorkerPool::run(chunks, chunks, [&](size_t, size_t c)
+                            { sort_chunk(entries.data() + bounds[c], tmp.data() + bounds[c], bounds[c], bounds[c + 1]); });
+            while (bounds.size() > 2)
+            {
+                size_t pairs = bounds.size() / 2; // 段数为奇数时最后一段原样拷贝
+                WorkerPool::run(dop_, pairs, [&](size_t, size_t p)
+                                {
+                                    size_t lo = bounds[2 * p];
+                                    size_t mid = bounds[std::min(2 * p + 1, bounds.size() - 1)];
+                                    size_t hi = bounds[std::min(2 * p + 2, bounds.size() - 1)];
+                                    std::merge(entries.data() + lo, entries.data() + mid, entries.data() + mid, entries.data() + hi, tmp.data() + lo,
+                                               [this](const Entry &a, const Entry &b) { return less(a, b); });
+                                });
+                entries.swap(tmp);
+                std::vector<size_t> merged;
+                for (size_t i = 0; i < bounds.size(); i += 2)
+                {
+                    merged.push_back(bounds[i]);
+                }
+                if (merged.back() != tuple_num)
+                {
+                    merged.push_back(tuple_num);
+                }
+                bounds.swap(merged);
+            }
+        }
+        std::vector<char>().swap(norm_);
+
+        tuples_.reserve(tuple_num);
+        for (const auto &entry : entries)
+        {
+            tuples_.push_back(rows_.data() + static_cast<size_t>(entry.idx) * len_);
+        }
+    }
+
+    // 大顶堆保留目前最小的 limit_ 条，堆顶是其中最大的一条，新记录比它小时替换堆顶。
+    // 键相同时先到的记录算小，结果与全排序后取前 limit_ 条一致
+    void top_n()
+    {
+        if (limit_ == 0)
+        {
+            return;
+        }
+        std::vector<size_t> arrival; // 各槽位中记录的到达顺序
+        std::vector<uint32_t> heap;  // 槽位号
+        std::vector<char> row(len_);
+        std::vector<char> key(key_len_);
+        auto less = [&](uint32_t a, uint32_t b)
+        {
+            int cmp = std::memcmp(norm_.data() + a * key_len_, norm_.data() + b * key_len_, key_len_);
+            return cmp != 0 ? cmp < 0 : arrival[a] < arrival[b];
+        };
+
+        TupleBatch batch;
+        SegLayout layout(prev_->seg_lens());
+        size_t arrived = 0;
+        prev_->beginBatch();
+        while (prev_->NextBatch(batch) != 0)
+        {
+            for (size_t i = 0; i < batch.sel_size; i++, arrived++)
+            {
+                layout.gather(batch.row(i), row.data());
+                encode(row.data(), key.data());
+                uint32_t slot;
+                if (heap.size() < limit_)
+                {
+                    slot = static_cast<uint32_t>(heap.size());
+                    rows_.resize((slot + 1) * len_);
+                    norm_.resize((slot + 1) * key_len_);
+                    arrival.push_back(0);
+                }
+                else
+                {
+                    slot = heap.front();
+                    if (std::memcmp(key.data(), norm_.data() + slot * key_len_, key_len_) >= 0)
+                    {
+                        continue;
+                    }
+                    std::pop_heap(heap.begin(), heap.end(), less);
+                    heap.pop_back();
+                }
+                std::memcpy(rows_.data() + slot * len_, row.data(), len_);
+                std::memcpy(norm_.data() + slot * key_len_, key.data(), key_len_);
+                arrival[slot] = arrived;
+                heap.push_back(slot);
+                std::push_heap(heap.begin(), heap.end(), less);
+            }
+        }
+        std::sort_heap(heap.begin(), heap.end(), less);
+        std::vector<char>().swap(norm_);
+
+        tuple_num = heap.size();
+        tuples_.reserve(tuple_num);
+        for (uint32_t slot : heap)
+        {
+            tuples_.push_back(rows_.data() + static_cast<size_t>(slot) * len_);
+        }
+    }
+
+    // 编码并排序 [begin, end) 行，结果写回 out，tmp 是同样大小的缓冲区
+    void sort_chunk(Entry *out, Entry *tmp, size_t begin, size_t end)
+    {
+        size_t n = end - begin;
+        for (size_t i = 0; i < n; i++)
+        {
+            size_t idx = begin + i;
+            char *key = norm_.data() + idx * key_len_;
+            encode(rows_.data() + idx * len_, key);
+            out[i] = {load_prefix(key), static_cast<uint32_t>(idx)};
+        }
+        if (n < RADIX_MIN_ROWS)
         {
-            tuple_num++;
-            tuples_.emplace_back(prev_->Next());
+            std::sort(out, out + n, [this](const Entry &a, const Entry &b) { return less(a, b); });
+            return;
         }
-        if (tuples_.empty())
+        radix_sort(out, tmp, n);
+        if (key_len_ <= 8)
+        {
             return;
-        if (col_.type!=TYPE_STRING)
-            std::sort(tuples_.begin(), tuples_.end(), [this](const std::unique_ptr<RmRecord> &a, const std::unique_ptr<RmRecord> &b)
-                  { return compareRecords(a, b); });
+        }
+        // 前缀相同的一段再按键的剩余部分排序
+        for (size_t i = 0; i < n;)
+        {
+            size_t j = i + 1;
+            while (j < n && out[j].prefix == out[i].prefix)
+            {
+                j++;
+            }
+            if (j - i > 1)
+            {
+                std::sort(out + i, out + j, [this](const Entry &a, const Entry &b) { return less(a, b); });
+            }
+            i = j;
+        }
     }
 
-    bool compareRecords(const std::unique_ptr<RmRecord> &a, const std::unique_ptr<RmRecord> &b) const
+    bool less(const Entry &a, const Entry &b) const
     {
-        Value lhs = getValue(a, col_.offset, col_.type);
-        Value rhs = getValue(b, col_.offset, col_.type);
-        if (lhs != rhs)
+        if (a.prefix != b.prefix)
+        {
+            return a.prefix < b.prefix;
+        }
+        if (key_len_ > 8)
         {
-            return is_desc_ ? lhs > rhs : lhs < rhs;
+            int cmp = std::memcmp(norm_.data() + static_cast<size_t>(a.idx) * key_len_ + 8, norm_.data() + static_cast<size_t>(b.idx) * key_len_ + 8, key_len_ - 8);
+            if (cmp != 0)
+            {
+                return cmp < 0;
+            }
         }
-        return false;
+        return a.idx < b.idx;
     }
 
-    static Value getValue(const std::unique_ptr<RmRecord> &record, size_t offset, ColType col_type)
+    // 按前缀逐字节的稳定 LSD 基数排序，所有行在某个字节上都相同时跳过这一趟
+    static void radix_sort(Entry *a, Entry *tmp, size_t n)
     {
-        const char *buf = record->data + offset;
-        Value value;
-        switch (col_type)
+        std::vector<size_t> counts(8 * 256, 0);
+        for (size_t i = 0; i < n; i++)
         {
-        case TYPE_INT:
+            uint64_t p = a[i].prefix;
+            for (int b = 0; b < 8; b++)
+            {
+                counts[b * 256 + ((p >> (8 * b)) & 0xff)]++;
+            }
+        }
+        Entry *src = a;
+        Entry *dst = tmp;
+        for (int b = 0; b < 8; b++)
         {
-            int int_value = *reinterpret_cast<const int *>(buf);
-            value.set_int(int_value);
-            break;
+            size_t *count = counts.data() + b * 256;
+            if (count[(src[0].prefix >> (8 * b)) & 0xff] == n)
+            {
+                continue;
+            }
+            size_t sum = 0;
+            for (int v = 0; v < 256; v++)
+            {
+                size_t c = count[v];
+                count[v] = sum;
+                sum += c;
+            }
+            for (size_t i = 0; i < n; i++)
+            {
+                dst[count[(src[i].prefix >> (8 * b)) & 0xff]++] = src[i];
+            }
+            std::swap(src, dst);
         }
-        case TYPE_FLOAT:
+        if (src != a)
         {
-            float float_value = *reinterpret_cast<const float *>(buf);
-            value.set_float(float_value);
-            break;
+            std::copy(src, src + n, a);
         }
-        case TYPE_STRING:
+    }
+
+    // 把记录的各排序列写成归一化键：整数翻转符号位，浮点数负数全部取反、非负数翻转符号位，都按大端存放；
+    // 字符串取有效部分，其余补零。降序列整列取反
+    void encode(const char *record, char *key) const
+    {
+        for (const auto &k : keys_)
         {
-            std::string str_value(buf, strnlen(buf, 256)); // 假设最大字符串长度为256
-            value.set_str(str_value);
-            break;
+            const char *src = record + k.offset;
+            auto *dst = reinterpret_cast<unsigned char *>(key + k.key_offset);
+            switch (k.type)
+            {
+            case TYPE_INT:
+            {
+                uint32_t bits;
+                std::memcpy(&bits, src, 4);
+                store_be32(dst, bits ^ 0x80000000u);
+                break;
+            }
+            case TYPE_FLOAT:
+            {
+                float f;
+                std::memcpy(&f, src, 4);
+                if (f == 0.0f)
+                {
+                    f = 0.0f; // -0 与 0 相等
+                }
+                uint32_t bits;
+                std::memcpy(&bits, &f, 4);
+                store_be32(dst, (bits & 0x80000000u) ? ~bits : bits | 0x80000000u);
+                break;
+            }
+            default:
+            {
+                size_t n = strnlen(src, k.len);
+                std::memcpy(dst, src, n);
+                std::memset(dst + n, 0, k.len - n);
+                break;
+            }
+            }
+            if (k.is_desc)
+            {
+                for (int i = 0; i < k.len; i++)
+                {
+                    dst[i] = ~dst[i];
+                }
+            }
         }
-        default:
-            throw RMDBError();
+    }
+
+    uint64_t load_prefix(const char *key) const
+    {
+        uint64_t p = 0;
+        size_t n = std::min<size_t>(8, key_len_);
+        for (size_t i = 0; i < n; i++)
+        {
+            p = (p << 8) | static_cast<unsigned char>(key[i]);
         }
-        return value;
+        return p << (8 * (8 - n));
+    }
+
+    static void store_be32(unsigned char *dst, uint32_t v)
+    {
+        dst[0] = static_cast<unsigned char>(v >> 24);
+        dst[1] = static_cast<unsigned char>(v >> 16);
+        dst[2] = static_cast<unsigned char>(v >> 8);
+        dst[3] = static_cast<unsigned char>(v);
     }
 };
@@ -1,7 +1,134 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <cstring>
+
 #include "common/common_finals.h"
 
+// 分段记录中的一个字段：第 seg 段内偏移 offset 处
+struct FieldRef
+{
+    int seg = 0;
+    int offset = 0;
+
+    const char *in(const char *const *segs) const { return segs[seg] + offset; }
+};
+
+// 分段记录的布局。连接的结果不拼成整条记录，而是依次保存各子记录的指针，
+// 一条逻辑记录由若干段首尾相接组成，列的 offset 仍按拼接后的整条记录计算
+struct SegLayout
+{
+    std::vector<int> lens;   // 各段长度
+    std::vector<int> begins; // 各段在整条记录中的起始偏移
+
+    SegLayout() = default;
+
+    explicit SegLayout(std::vector<int> seg_lens) : lens(std::move(seg_lens))
+    {
+        int begin = 0;
+        for (int len : lens)
+        {
+            begins.push_back(begin);
+            begin += len;
+        }
+    }
+
+    size_t width() const { return lens.size(); }
+
+    FieldRef locate(int offset) const
+    {
+        int seg = static_cast<int>(lens.size()) - 1;
+        while (seg > 0 && begins[seg] > offset)
+        {
+            seg--;
+        }
+        return {seg, offset - begins[seg]};
+    }
+
+    // 拼成整条记录写入 dst
+    void gather(const char *const *segs, char *dst) const
+    {
+        for (size_t i = 0; i < lens.size(); i++)
+        {
+            std::memcpy(dst + begins[i], segs[i], lens[i]);
+        }
+    }
+
+    // 整条记录按段切分，只算指针不复制
+    void split(const char *data, const char **segs) const
+    {
+        for (size_t i = 0; i < lens.size(); i++)
+        {
+            segs[i] = data + begins[i];
+        }
+    }
+};
+
+// 批量执行时一次传递的一批记录，每条记录是 width 个段指针，布局由产生它的算子的 seg_lens() 给出。
+// 指针只保证在下一次对同一个算子调用 NextBatch 或 beginBatch 之前有效：扫描直接指向表中的记录，
+// 连接只保存左右两边的指针，需要生成新记录的算子把结果写进 buffer。
+// sel 是选择向量，按输出顺序列出有效记录的下标，过滤只改 sel，不搬动记录
+struct TupleBatch
+{
+    static constexpr size_t CAPACITY = 1024;
+
+    size_t size = 0;     // 记录数
+    size_t sel_size = 0; // 有效记录数
+    size_t width = 1;    // 每条记录的段数
+    std::vector<char *> segs = std::vector<char *>(CAPACITY); // 第 i 条记录的段为 segs[i * width, (i + 1) * width)
+    std::array<uint16_t, CAPACITY> sel;
+    std::vector<char> buffer;
+
+    void clear(size_t seg_width = 1)
+    {
+        size = 0;
+        sel_size = 0;
+        width = seg_width;
+        if (segs.size() < CAPACITY * width)
+        {
+            segs.resize(CAPACITY * width);
+        }
+    }
+
+    bool full() const { return size == CAPACITY; }
+
+    // 第 i 条有效记录的第一段，只有一段时就是整条记录
+    char *record(size_t i) const { return segs[sel[i] * width]; }
+
+    // 第 i 条有效记录的各段
+    char *const *row(size_t i) const { return segs.data() + sel[i] * width; }
+
+    // 追加一条只有一段的有效记录
+    void append(char *data)
+    {
+        sel[sel_size++] = static_cast<uint16_t>(size);
+        segs[size++ * width] = data;
+    }
+
+    // 追加一条有效记录，返回它的段指针由调用方填写
+    char **append_row()
+    {
+        sel[sel_size++] = static_cast<uint16_t>(size);
+        return segs.data() + size++ * width;
+    }
+
+    // 追加一条先不做判断的记录，之后由 select 决定是否有效
+    void push(char *data) { segs[size++ * width] = data; }
+
+    void select(size_t i) { sel[sel_size++] = static_cast<uint16_t>(i); }
+
+    // buffer 中留给下一条记录的 len 字节
+    char *slot(size_t len)
+    {
+        if (buffer.size() < CAPACITY * len)
+        {
+            buffer.resize(CAPACITY * len);
+        }
+        return buffer.data() + size * len;
+    }
+};
+
 class AbstractExecutor
 {
 public:
@@ -25,6 +152,29 @@ public:
 
     virtual std::unique_ptr<RmRecord> Next() { return nullptr; }
 
+    // NextBatch 输出的每条记录各段的长度，默认整条记录只有一段
+    virtual std::vector<int> seg_lens() const { return {static_cast<int>(tupleLen())}; }
+
+    // 批量接口，与 beginTuple/nextTuple/Next 二选一使用：beginBatch 之后反复调用 NextBatch，
+    // 每次从当前位置取出至多 TupleBatch::CAPACITY 条记录，返回有效记录数，返回 0 表示已经没有记录。
+    // 默认实现逐条调用 Next 并把记录复制到 batch.buffer，热点算子各自覆盖
+    virtual void beginBatch() { beginTuple(); }
+
+    virtual size_t NextBatch(TupleBatch &batch)
+    {
+        batch.clear();
+        size_t len = tupleLen();
+        while (!is_end() && !batch.full())
+        {
+            auto record = Next();
+            char *slot = batch.slot(len);
+            std::memcpy(slot, record->data, len);
+            batch.append(slot);
+            nextTuple();
+        }
+        return batch.sel_size;
+    }
+
 protected:
     static bool can_cast_type(ColType from, ColType to)
     {
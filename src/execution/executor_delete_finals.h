@@ -27,5 +27,6 @@ public:
             fh_->delete_record(rid_);
             context->txn_->append_write_record(WriteType::DELETE_TUPLE, tab_->fd_, rid_);
         }
+        sm_manager_->stats_.note_modified(tab_->fd_, rids_.size());
     }
 };
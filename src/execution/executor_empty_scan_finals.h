@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "execution_manager_finals.h"
+#include "executor_abstract_finals.h"
+
+// WHERE 恒假时代替表扫描：字段与原表相同，但不读表也不产生任何记录
+class EmptyScanExecutor : public AbstractExecutor
+{
+private:
+    std::vector<ColMeta> *cols_;
+    size_t len_;
+
+public:
+    EmptyScanExecutor(SmManager *sm_manager, const std::string &tab_name)
+    {
+        auto tab = sm_manager->db_.get_table(tab_name);
+        cols_ = &tab->cols;
+        len_ = sm_manager->fhs_[tab->fd_]->record_size;
+    }
+
+    size_t tupleLen() const override { return len_; }
+
+    const std::vector<ColMeta> &cols() const override { return *cols_; }
+
+    bool is_end() const override { return true; }
+};
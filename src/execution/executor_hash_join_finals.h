@@ -0,0 +1,469 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "execution_manager_finals.h"
+#include "executor_abstract_finals.h"
+#include "executor_nestedloop_join_finals.h"
+
+// 等值连接的哈希连接：右儿子为构建侧，整个物化后按连接列建开放寻址哈希表，左儿子逐行探测。
+// 哈希表只存放 (hash, 链头) 两个字段，同键的构建行通过 next_ 串成链，链内保持构建侧的输出顺序。
+// 等值条件之外的连接条件在命中后逐条判断。构建侧只保存查询用到的列，输出记录的右半部分也只有这些列
+class HashJoinExecutor : public AbstractExecutor
+{
+private:
+    // 一对等值连接列在左右记录中的位置，左记录按段定位
+    struct KeyCol
+    {
+        FieldRef left;
+        int right_offset;
+        int left_len;
+        int right_len;
+        ColType type;
+    };
+
+    struct Slot
+    {
+        uint64_t hash;
+        uint32_t head; // 同键链的第一行，EMPTY 表示空槽
+    };
+
+    // 构建侧记录中要保存的一段连续字节
+    struct CopyRange
+    {
+        int offset;
+        int len;
+    };
+
+    static constexpr uint32_t EMPTY = UINT32_MAX;
+
+    std::unique_ptr<AbstractExecutor> left_;  // 探测侧
+    std::unique_ptr<AbstractExecutor> right_; // 构建侧
+    size_t left_len_;
+    size_t right_len_; // 裁剪后的构建行长度
+    std::vector<ColMeta> cols_;
+    std::vector<CopyRange> copy_ranges_; // 为空表示整条保存
+    std::vector<KeyCol> keys_;
+    Predicate other_pred_;               // 编译后的其余连接条件，左记录各段之后接构建行
+    SegLayout left_layout_;
+
+    bool built_ = false;
+    std::vector<char> rows_;       // 物化的构建侧记录，每条 right_len_ 字节
+    std::vector<uint32_t> next_;   // 同键链的下一行
+    std::vector<Slot> slots_;
+    uint64_t mask_ = 0;
+
+    std::unique_ptr<RmRecord> left_record_;
+    std::vector<const char *> row_segs_; // 正在判断的左记录各段和构建行
+    std::vector<char> out_;               // Next 返回的记录
+    uint32_t match_ = EMPTY;              // 当前左记录命中的构建行
+    bool is_end_ = false;
+
+    // 批量执行的状态：一批左记录先统一算好哈希再逐条探测
+    TupleBatch left_batch_;
+    std::array<uint64_t, TupleBatch::CAPACITY> left_hashes_;
+    size_t left_pos_ = 0;
+    char *const *left_row_ = nullptr;
+
+public:
+    // required_cols 为查询用到的列（表名为空时按列名匹配），为空表示保留构建侧的所有列
+    HashJoinExecutor(std::unique_ptr<AbstractExecutor> left, std::unique_ptr<AbstractExecutor> right, std::vector<Condition> conds, const std::vector<TabCol> &required_cols = {}) : left_(std::move(left)), right_(std::move(right))
+    {
+        left_len_ = left_->tupleLen();
+        left_layout_ = SegLayout(left_->seg_lens());
+        row_segs_.resize(left_layout_.width() + 1);
+        auto right_cols = prune_cols(right_->cols(), required_cols, conds);
+        if (copy_ranges_.size() == 1 && copy_ranges_[0].offset == 0 && right_len_ == right_->tupleLen())
+        {
+            copy_ranges_.clear();
+        }
+        cols_ = left_->cols();
+        for (auto col : right_cols)
+        {
+            col.offset += left_len_;
+            cols_.push_back(col);
+        }
+
+        for (auto &cond : conds)
+        {
+            cond.lhs = *get_col(left_->cols(), cond.lhs_col);
+            cond.rhs = *get_col(right_cols, cond.rhs_col);
+            // 两侧类型不同的等值条件（如 INT 与 FLOAT）不能按字节建键，留作普通条件
+            if (cond.op == OP_EQ && cond.lhs.type == cond.rhs.type)
+            {
+                keys_.push_back({left_layout_.locate(cond.lhs.offset), cond.rhs.offset, cond.lhs.len, cond.rhs.len, cond.lhs.type});
+            }
+            else
+            {
+                auto lhs = left_layout_.locate(cond.lhs.offset);
+                other_pred_.add({lhs.seg, lhs.offset, cond.lhs.len, cond.lhs.type}, cond, {static_cast<int>(left_layout_.width()), cond.rhs.offset, cond.rhs.len, cond.rhs.type});
+            }
+        }
+        if (keys_.empty())
+        {
+            throw RMDBError();
+        }
+        out_.resize(left_len_ + right_len_);
+    }
+
+    void beginTuple() override
+    {
+        // 作为嵌套循环的内表被反复扫描时，哈希表只建一次
+        if (!built_)
+        {
+            build();
+        }
+        is_end_ = false;
+        match_ = EMPTY;
+        left_->beginTuple();
+        if (left_->is_end())
+        {
+            is_end_ = true;
+            return;
+        }
+        left_record_ = left_->Next();
+        match_ = probe(split_left());
+        find_next_valid_tuple();
+    }
+
+    void nextTuple() override
+    {
+        match_ = next_[match_];
+        find_next_valid_tuple();
+    }
+
+    std::unique_ptr<RmRecord> Next() override
+    {
+        if (is_end_)
+        {
+            return nullptr;
+        }
+        std::memcpy(out_.data(), left_record_->data, left_len_);
+        std::memcpy(out_.data() + left_len_, row(match_), right_len_);
+        return std::make_unique<RmRecord>(out_.data(), static_cast<int>(out_.size()));
+    }
+
+    size_t tupleLen() const override { return left_len_ + right_len_; }
+
+    // 输出左记录的各段加上构建行
+    std::vector<int> seg_lens() const override
+    {
+        auto lens = left_layout_.lens;
+        lens.push_back(static_cast<int>(right_len_));
+        return lens;
+    }
+
+    const std::vector<ColMeta> &cols() const override { return cols_; }
+
+    bool is_end() const override { return is_end_; }
+
+    void beginBatch() override
+    {
+        if (!built_)
+        {
+            build();
+        }
+        left_->beginBatch();
+        left_batch_.clear();
+        left_pos_ = 0;
+        match_ = EMPTY;
+    }
+
+    size_t NextBatch(TupleBatch &batch) override
+    {
+        size_t width = left_layout_.width();
+        batch.clear(width + 1);
+        while (!batch.full())
+        {
+            if (match_ == EMPTY)
+            {
+                if (left_pos_ == left_batch_.sel_size)
+                {
+                    // 已输出的记录指向当前左批次，先把它们交出去，下一次调用再取新的左批次
+                    if (batch.size > 0)
+                    {
+                        break;
+                    }
+                    left_pos_ = 0;
+                    if (left_->NextBatch(left_batch_) == 0)
+                    {
+                        break;
+                    }
+                    for (size_t i = 0; i < left_batch_.sel_size; i++)
+                    {
+                        left_hashes_[i] = hash_key<true>(left_batch_.row(i));
+                    }
+                }
+                left_row_ = left_batch_.row(left_pos_);
+                std::copy(left_row_, left_row_ + width, row_segs_.begin());
+                match_ = probe(left_row_, left_hashes_[left_pos_]);
+                left_pos_++;
+                continue;
+            }
+            const char *right = row(match_);
+            if (other_pred_.empty() || satisfies_other_conds(right))
+            {
+                // 只记下左右两边的指针，不拼接记录
+                char **segs = batch.append_row();
+                std::copy(left_row_, left_row_ + width, segs);
+                segs[width] = const_cast<char *>(right);
+            }
+            match_ = next_[match_];
+        }
+        return batch.sel_size;
+    }
+
+private:
+    // 选出构建侧要保存的列并重新排布偏移，连接条件用到的列总是保留；相邻的列合并成一次拷贝
+    std::vector<ColMeta> prune_cols(const std::vector<ColMeta> &cols, const std::vector<TabCol> &required_cols, const std::vector<Condition> &conds)
+    {
+        auto needed = [&](const ColMeta &col)
+        {
+            if (required_cols.empty())
+            {
+                return true;
+            }
+            for (auto &cond : conds)
+            {
+                if (cond.rhs_col.tab_name == col.tab_name && cond.rhs_col.col_name == col.name)
+                {
+                    return true;
+                }
+            }
+            for (auto &req : required_cols)
+            {
+                if (req.col_name == col.name && (req.tab_name.empty() || req.tab_name == col.tab_name))
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
+        std::vector<ColMeta> pruned;
+        right_len_ = 0;
+        for (auto col : cols)
+        {
+            if (!needed(col))
+            {
+                continue;
+            }
+            if (!copy_ranges_.empty() && copy_ranges_.back().offset + copy_ranges_.back().len == col.offset)
+            {
+                copy_ranges_.back().len += col.len;
+            }
+            else
+            {
+                copy_ranges_.push_back({col.offset, col.len});
+            }
+            col.offset = static_cast<int>(right_len_);
+            right_len_ += col.len;
+            pruned.push_back(col);
+        }
+        return pruned;
+    }
+
+    const char *row(uint32_t idx) const { return rows_.data() + static_cast<size_t>(idx) * right_len_; }
+
+    static uint64_t hash_bytes(uint64_t h, const char *data, size_t len)
+    {
+        for (size_t i = 0; i < len; i++)
+        {
+            h = (h ^ static_cast<unsigned char>(data[i])) * 1099511628211ULL;
+        }
+        return h;
+    }
+
+    // 字符串按有效长度参与哈希和比较，两边定长不同的 CHAR 列也能匹配
+    static size_t key_len(const char *data, int len, ColType type)
+    {
+        return type == TYPE_STRING ? strnlen(data, len) : len;
+    }
+
+    // LEFT 为 true 时 segs 是左记录的各段，否则 segs[0] 是一条构建行
+    template <bool LEFT>
+    uint64_t hash_key(const char *const *segs) const
+    {
+        uint64_t h = 1469598103934665603ULL;
+        for (auto &key : keys_)
+        {
+            const char *p = LEFT ? key.left.in(segs) : segs[0] + key.right_offset;
+            int len = LEFT ? key.left_len : key.right_len;
+            if (key.type == TYPE_FLOAT)
+            {
+                // key_equal 按 != 比较，-0.0 与 0.0 相等，哈希前统一成 0.0
+                float f;
+                std::memcpy(&f, p, sizeof(float));
+                f = f == 0.0f ? 0.0f : f;
+                h = hash_bytes(h, reinterpret_cast<const char *>(&f), sizeof(float));
+                continue;
+            }
+            h = hash_bytes(h, p, key_len(p, len, key.type));
+        }
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    // 比较 a 与构建行 b 的连接键，a 来自左记录时 LEFT 为 true
+    template <bool LEFT>
+    bool key_equal(const char *const *a, const char *b) const
+    {
+        for (auto &key : keys_)
+        {
+            const char *pa = LEFT ? key.left.in(a) : a[0] + key.right_offset;
+            const char *pb = b + key.right_offset;
+            switch (key.type)
+            {
+            case TYPE_INT:
+                if (std::memcmp(pa, pb, sizeof(int)) != 0)
+                {
+                    return false;
+                }
+                break;
+            case TYPE_FLOAT:
+            {
+                float fa, fb;
+                std::memcpy(&fa, pa, sizeof(float));
+                std::memcpy(&fb, pb, sizeof(float));
+                if (fa != fb)
+                {
+                    return false;
+                }
+                break;
+            }
+            default:
+            {
+                size_t la = key_len(pa, LEFT ? key.left_len : key.right_len, key.type);
+                size_t lb = key_len(pb, key.right_len, key.type);
+                if (la != lb || std::memcmp(pa, pb, la) != 0)
+                {
+                    return false;
+                }
+            }
+            }
+        }
+        return true;
+    }
+
+    void build()
+    {
+        built_ = true;
+        TupleBatch batch;
+        SegLayout layout(right_->seg_lens());
+        std::vector<char> scratch(right_->tupleLen());
+        right_->beginBatch();
+        while (right_->NextBatch(batch) != 0)
+        {
+            for (size_t i = 0; i < batch.sel_size; i++)
+            {
+                const char *record = batch.record(i);
+                if (batch.width > 1)
+                {
+                    layout.gather(batch.row(i), scratch.data());
+                    record = scratch.data();
+                }
+                if (copy_ranges_.empty())
+                {
+                    rows_.insert(rows_.end(), record, record + right_len_);
+                    continue;
+                }
+                for (auto &range : copy_ranges_)
+                {
+                    rows_.insert(rows_.end(), record + range.offset, record + range.offset + range.len);
+                }
+            }
+        }
+        size_t n = right_len_ == 0 ? 0 : rows_.size() / right_len_;
+        size_t capacity = 16;
+        while (capacity < n * 2)
+        {
+            capacity <<= 1;
+        }
+        slots_.assign(capacity, Slot{0, EMPTY});
+        mask_ = capacity - 1;
+        next_.assign(n, EMPTY);
+
+        // 倒序插入链头，链内顺序与构建侧的输出顺序一致
+        for (size_t i = n; i-- > 0;)
+        {
+            const char *data = row(static_cast<uint32_t>(i));
+            uint64_t h = hash_key<false>(&data);
+            for (uint64_t pos = h & mask_;; pos = (pos + 1) & mask_)
+            {
+                auto &slot = slots_[pos];
+                if (slot.head == EMPTY)
+                {
+                    slot = Slot{h, static_cast<uint32_t>(i)};
+                    break;
+                }
+                if (slot.hash == h && key_equal<false>(&data, row(slot.head)))
+                {
+                    next_[i] = slot.head;
+                    slot.head = static_cast<uint32_t>(i);
+                    break;
+                }
+            }
+        }
+    }
+
+    // 返回与左记录连接键相同的第一条构建行
+    uint32_t probe(const char *const *left) const { return probe(left, hash_key<true>(left)); }
+
+    uint32_t probe(const char *const *left, uint64_t h) const
+    {
+        for (uint64_t pos = h & mask_;; pos = (pos + 1) & mask_)
+        {
+            auto &slot = slots_[pos];
+            if (slot.head == EMPTY)
+            {
+                return EMPTY;
+            }
+            if (slot.hash == h && key_equal<true>(left, row(slot.head)))
+            {
+                return slot.head;
+            }
+        }
+    }
+
+    bool satisfies_other_conds(const char *right)
+    {
+        row_segs_.back() = right;
+        return other_pred_.eval(row_segs_.data());
+    }
+
+    // 元组接口下的左记录是整条的，按段切分后与批量接口共用探测逻辑
+    const char *const *split_left()
+    {
+        left_layout_.split(left_record_->data, row_segs_.data());
+        return row_segs_.data();
+    }
+
+    // 从 match_ 开始找下一个满足全部条件的组合，当前左记录的链走完后探测下一条左记录
+    void find_next_valid_tuple()
+    {
+        while (true)
+        {
+            while (match_ != EMPTY)
+            {
+                if (other_pred_.empty() || satisfies_other_conds(row(match_)))
+                {
+                    return;
+                }
+                match_ = next_[match_];
+            }
+            left_->nextTuple();
+            if (left_->is_end())
+            {
+                is_end_ = true;
+                return;
+            }
+            left_record_ = left_->Next();
+            match_ = probe(split_left());
+        }
+    }
+};
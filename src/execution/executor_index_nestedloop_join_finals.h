@@ -0,0 +1,323 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "execution_manager_finals.h"
+#include "executor_abstract_finals.h"
+#include "executor_gap_lock_finals.h"
+#include "executor_nestedloop_join_finals.h"
+#include "index/ix_memory_scan_finals.h"
+
+// 索引嵌套循环连接：内表不再整表重扫，而是对每条外表记录用连接列的值拼出探测键，
+// 在内表索引上取 [lower_bound, upper_bound) 区间。索引前 probe_cols_ 列由等值连接条件给出，
+// 其余索引列取类型的最小/最大值；前缀覆盖整个索引时按唯一键直接查找。
+// 内表自身的过滤条件通过间隙锁判断，与 SeqScanExecutor 一致
+class IndexNestedLoopJoinExecutor : public AbstractExecutor
+{
+private:
+    // 一个探测列：外表记录中的值拷到探测键中索引列的位置，外表记录按段定位
+    struct ProbeCol
+    {
+        FieldRef left;
+        int left_len;
+        int key_offset;
+        int key_len;
+    };
+
+    std::unique_ptr<AbstractExecutor> left_; // 外表
+    TabMeta *tab_;                           // 内表
+    RmFileHandle *fh_;
+    IxIndexHandle *ih_;
+    PoolManager *memory_pool_manager_;
+    std::unique_ptr<GapLockExecutor> gap_lock_;
+
+    size_t left_len_;
+    size_t right_len_;
+    std::vector<ColMeta> cols_;
+    std::vector<ProbeCol> probe_cols_;
+    Predicate other_pred_;               // 编译后的探测键之外的连接条件，外表记录各段之后接内表记录
+    SegLayout left_layout_;
+    bool exact_match_;                   // 探测前缀覆盖整个索引
+
+    char *lower_key_;
+    char *upper_key_;
+    std::unique_ptr<IxScan> scan_;
+    std::unique_ptr<RmRecord> left_record_;
+    std::vector<const char *> row_segs_; // 正在判断的外表记录各段和内表记录
+    std::vector<char> out_;               // Next 返回的记录
+    char *rid_ = nullptr;                 // 当前匹配的内表记录
+    bool is_end_ = false;
+
+    // 批量执行的状态
+    TupleBatch left_batch_;
+    size_t left_pos_ = 0;
+    char *const *left_row_ = nullptr;
+
+public:
+    IndexNestedLoopJoinExecutor(SmManager *sm_manager, std::unique_ptr<AbstractExecutor> left, const std::string &tab_name, const std::vector<Condition> &inner_conds, const IndexMeta &index_meta, std::vector<Condition> conds, Context *context) : left_(std::move(left))
+    {
+        tab_ = sm_manager->db_.get_table(tab_name);
+        fh_ = sm_manager->fhs_[tab_->fd_].get();
+        ih_ = sm_manager->ihs_[index_meta.fd_].get();
+        memory_pool_manager_ = sm_manager->memory_pool_manager_;
+        gap_lock_ = std::make_unique<GapLockExecutor>(sm_manager, tab_, inner_conds, context);
+
+        left_len_ = left_->tupleLen();
+        right_len_ = fh_->record_size;
+        left_layout_ = SegLayout(left_->seg_lens());
+        row_segs_.resize(left_layout_.width() + 1);
+        out_.resize(left_len_ + right_len_);
+        cols_ = left_->cols();
+        for (auto col : tab_->cols)
+        {
+            col.offset += left_len_;
+            cols_.push_back(col);
+        }
+
+        for (auto &cond : conds)
+        {
+            cond.lhs = *get_col(left_->cols(), cond.lhs_col);
+            cond.rhs = *get_col(tab_->cols, cond.rhs_col);
+        }
+
+        // 按索引列顺序取等值连接条件，遇到第一个没有等值条件的列就停止。
+        // 外表 CHAR 比索引列长时截断后可能误匹配，这种条件留作普通条件
+        std::vector<bool> used(conds.size(), false);
+        auto probe_cond = [&](size_t i, const ColMeta &col)
+        {
+            return !used[i] && conds[i].op == OP_EQ && conds[i].rhs_col.col_name == col.name && conds[i].lhs.type == col.type && conds[i].lhs.len <= col.len;
+        };
+        for (const auto &col : index_meta.cols_)
+        {
+            size_t i = 0;
+            while (i < conds.size() && !probe_cond(i, col))
+            {
+                i++;
+            }
+            if (i == conds.size())
+            {
+                break;
+            }
+            used[i] = true;
+            probe_cols_.push_back({left_layout_.locate(conds[i].lhs.offset), conds[i].lhs.len, col.offset, col.len});
+        }
+        if (probe_cols_.empty())
+        {
+            throw RMDBError();
+        }
+        exact_match_ = probe_cols_.size() == index_meta.cols_.size();
+        for (size_t i = 0; i < conds.size(); i++)
+        {
+            if (!used[i])
+            {
+                const auto &cond = conds[i];
+                auto lhs = left_layout_.locate(cond.lhs.offset);
+                other_pred_.add({lhs.seg, lhs.offset, cond.lhs.len, cond.lhs.type}, cond, {static_cast<int>(left_layout_.width()), cond.rhs.offset, cond.rhs.len, cond.rhs.type});
+            }
+        }
+
+        lower_key_ = memory_pool_manager_->allocate(right_len_);
+        upper_key_ = memory_pool_manager_->allocate(right_len_);
+        for (size_t i = probe_cols_.size(); i < index_meta.cols_.size(); i++)
+        {
+            const auto &col = index_meta.cols_[i];
+            switch (col.type)
+            {
+            case TYPE_INT:
+            {
+                int min_int = std::numeric_limits<int>::min();
+                int max_int = std::numeric_limits<int>::max();
+                memcpy(lower_key_ + col.offset, &min_int, sizeof(int));
+                memcpy(upper_key_ + col.offset, &max_int, sizeof(int));
+                break;
+            }
+            case TYPE_FLOAT:
+            {
+                float min_float = std::numeric_limits<float>::lowest();
+                float max_float = std::numeric_limits<float>::max();
+                memcpy(lower_key_ + col.offset, &min_float, sizeof(float));
+                memcpy(upper_key_ + col.offset, &max_float, sizeof(float));
+                break;
+            }
+            default:
+                memset(lower_key_ + col.offset, 0x00, col.len);
+                memset(upper_key_ + col.offset, 0xff, col.len);
+                break;
+            }
+        }
+    }
+
+    ~IndexNestedLoopJoinExecutor() override
+    {
+        memory_pool_manager_->deallocate(lower_key_, right_len_);
+        memory_pool_manager_->deallocate(upper_key_, right_len_);
+    }
+
+    void beginTuple() override
+    {
+        is_end_ = false;
+        left_->beginTuple();
+        if (left_->is_end())
+        {
+            is_end_ = true;
+            return;
+        }
+        left_record_ = left_->Next();
+        probe(split_left());
+        find_next_valid_tuple();
+    }
+
+    void nextTuple() override
+    {
+        advance();
+        find_next_valid_tuple();
+    }
+
+    std::unique_ptr<RmRecord> Next() override
+    {
+        if (is_end_)
+        {
+            return nullptr;
+        }
+        std::memcpy(out_.data(), left_record_->data, left_len_);
+        std::memcpy(out_.data() + left_len_, rid_, right_len_);
+        return std::make_unique<RmRecord>(out_.data(), static_cast<int>(out_.size()));
+    }
+
+    size_t tupleLen() const override { return left_len_ + right_len_; }
+
+    // 输出外表记录的各段加上内表记录
+    std::vector<int> seg_lens() const override
+    {
+        auto lens = left_layout_.lens;
+        lens.push_back(static_cast<int>(right_len_));
+        return lens;
+    }
+
+    const std::vector<ColMeta> &cols() const override { return cols_; }
+
+    bool is_end() const override { return is_end_; }
+
+    void beginBatch() override
+    {
+        left_->beginBatch();
+        left_batch_.clear();
+        left_pos_ = 0;
+        rid_ = nullptr;
+    }
+
+    size_t NextBatch(TupleBatch &batch) override
+    {
+        size_t width = left_layout_.width();
+        batch.clear(width + 1);
+        while (!batch.full())
+        {
+            if (rid_ == nullptr)
+            {
+                if (left_pos_ == left_batch_.sel_size)
+                {
+                    // 已输出的记录指向当前左批次，先把它们交出去，下一次调用再取新的左批次
+                    if (batch.size > 0)
+                    {
+                        break;
+                    }
+                    left_pos_ = 0;
+                    if (left_->NextBatch(left_batch_) == 0)
+                    {
+                        break;
+                    }
+                }
+                left_row_ = left_batch_.row(left_pos_++);
+                std::copy(left_row_, left_row_ + width, row_segs_.begin());
+                probe(left_row_);
+                continue;
+            }
+            if (satisfies_conds(rid_))
+            {
+                char **segs = batch.append_row();
+                std::copy(left_row_, left_row_ + width, segs);
+                segs[width] = rid_;
+            }
+            advance();
+        }
+        return batch.sel_size;
+    }
+
+private:
+    // 用外表记录的连接列填探测键，定位第一条候选内表记录
+    void probe(const char *const *left)
+    {
+        for (const auto &col : probe_cols_)
+        {
+            // 外表 CHAR 列可能比索引列短，其余部分补零
+            std::memcpy(lower_key_ + col.key_offset, col.left.in(left), col.left_len);
+            std::memset(lower_key_ + col.key_offset + col.left_len, 0, col.key_len - col.left_len);
+            std::memcpy(upper_key_ + col.key_offset, lower_key_ + col.key_offset, col.key_len);
+        }
+        if (exact_match_)
+        {
+            scan_.reset();
+            auto it = ih_->find_entry(lower_key_);
+            rid_ = it == ih_->end() ? nullptr : *it;
+            return;
+        }
+        scan_ = std::make_unique<IxScan>(ih_->lower_bound(lower_key_), ih_->upper_bound(upper_key_));
+        rid_ = scan_->is_end() ? nullptr : scan_->rid();
+    }
+
+    // 当前外表记录的下一条候选内表记录
+    void advance()
+    {
+        if (scan_ == nullptr)
+        {
+            rid_ = nullptr;
+            return;
+        }
+        scan_->next();
+        rid_ = scan_->is_end() ? nullptr : scan_->rid();
+    }
+
+    bool satisfies_conds(char *right)
+    {
+        if (!gap_lock_->gap->overlap(right))
+        {
+            return false;
+        }
+        row_segs_.back() = right;
+        return other_pred_.eval(row_segs_.data());
+    }
+
+    // 元组接口下的外表记录是整条的，按段切分后与批量接口共用探测逻辑
+    const char *const *split_left()
+    {
+        left_layout_.split(left_record_->data, row_segs_.data());
+        return row_segs_.data();
+    }
+
+    void find_next_valid_tuple()
+    {
+        while (true)
+        {
+            while (rid_ != nullptr)
+            {
+                if (satisfies_conds(rid_))
+                {
+                    return;
+                }
+                advance();
+            }
+            left_->nextTuple();
+            if (left_->is_end())
+            {
+                is_end_ = true;
+                return;
+            }
+            left_record_ = left_->Next();
+            probe(split_left());
+        }
+    }
+};
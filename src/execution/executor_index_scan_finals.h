@@ -1,6 +1,7 @@
 #pragma once
 
 #include <climits>
+#include <cstdint>
 #include <cstring>
 #include <memory>
 #include <utility>
@@ -9,6 +10,7 @@
 #include <cmath>
 #include <limits>
 
+#include "common/predicate_finals.h"
 #include "execution_manager_finals.h"
 #include "executor_abstract_finals.h"
 #include "index/ix_memory_scan_finals.h"
@@ -33,8 +35,14 @@ private:
     bool exact_key_found_ = false;
     bool exact_key_consumed_ = false;
 
+    size_t limit_;     // 至多输出的记录数，LIMIT 下推而来
+    size_t remaining_; // 本次扫描还能输出的记录数
+
+    Predicate residual_; // 索引区间不能精确表达的条件，区间内的记录还要逐条判断
+
 public:
-    IndexScanExecutor(SmManager *sm_manager, const std::string &tab_name, const std::vector<Condition> &conds, const IndexMeta &index_meta_, Context *context)
+    IndexScanExecutor(SmManager *sm_manager, const std::string &tab_name, const std::vector<Condition> &conds, const IndexMeta &index_meta_, Context *context, size_t limit = SIZE_MAX)
+        : limit_(limit), remaining_(limit)
     {
         context_ = context;
         tab_ = sm_manager->db_.get_table(tab_name);
@@ -43,7 +51,7 @@ public:
         ih_ = sm_manager->ihs_[index_meta_.fd_].get();
         memory_pool_manager_ = sm_manager->memory_pool_manager_;
 
-
+        build_residual(conds, index_meta_.cols_);
 
         // 检查是否为全等值查询（所有索引列都有等值条件）
         if (is_exact_match_query(conds, index_meta_.cols_)) {
@@ -127,6 +135,7 @@ public:
         auto lower_position_ = ih_->lower_bound(lower_key_);
         auto upper_position_ = ih_->upper_bound(upper_key_);
         scan_ = std::make_unique<IxScan>(lower_position_, upper_position_);
+        skip_filtered();
     }
 
     ~IndexScanExecutor() override
@@ -148,21 +157,28 @@ public:
 
     void beginTuple() override
     {
-        // 精确匹配模式下，不需要额外操作
+        // 作为嵌套循环连接的内表时会被反复扫描，每次都从头开始
+        remaining_ = limit_;
         if (exact_match_mode_) {
+            exact_key_consumed_ = false;
             return;
         }
-        // Scan is already initialized in constructor, no need to call next() here
+        scan_ = std::make_unique<IxScan>(ih_->lower_bound(lower_key_), ih_->upper_bound(upper_key_));
+        skip_filtered();
     }
 
     void nextTuple() override
     {
+        if (remaining_ > 0) {
+            remaining_--;
+        }
         if (exact_match_mode_) {
             // 精确匹配模式下，只有一个结果，nextTuple 后就结束
             exact_key_consumed_ = true;
             return;
         }
         scan_->next();
+        skip_filtered();
     }
 
     std::unique_ptr<RmRecord> Next() override { 
@@ -185,6 +201,9 @@ public:
     }
 
     bool is_end() const override { 
+        if (remaining_ == 0) {
+            return true;
+        }
         if (exact_match_mode_) {
             return !exact_key_found_ || exact_key_consumed_;
         }
@@ -209,6 +228,28 @@ public:
         return nullptr; 
     }
 
+    // 按索引顺序取指针，索引区间之外的条件在这里过滤
+    size_t NextBatch(TupleBatch &batch) override
+    {
+        batch.clear();
+        if (exact_match_mode_) {
+            char *rid = this->rid();
+            if (rid != nullptr) {
+                batch.append(rid);
+            }
+            exact_key_consumed_ = true;
+            return batch.sel_size;
+        }
+        for (; !batch.full() && remaining_ > 0 && !scan_->is_end(); scan_->next()) {
+            if (!residual_.eval(scan_->rid())) {
+                continue;
+            }
+            batch.append(scan_->rid());
+            remaining_--;
+        }
+        return batch.sel_size;
+    }
+
     size_t tupleLen() const override { return fh_->record_size; }
 
     const std::vector<ColMeta> &cols() const override { return *cols_; }
@@ -252,11 +293,54 @@ private:
             }
         }
         
-        // 检查键是否存在
-        exact_key_found_ = ih_->exists_entry(exact_key_);
+        // 检查键是否存在，且记录满足其余条件
+        auto it = ih_->find_entry(exact_key_);
+        exact_key_found_ = it != ih_->end() && residual_.eval(*it);
         exact_key_consumed_ = false;
     }
 
+    // 索引区间只对这样的前缀精确：若干列取等值，后面至多一列取范围。
+    // 其余条件（非索引列、范围列之后的列、列与列比较）编译成谓词逐条判断
+    void build_residual(const std::vector<Condition> &conds, const std::vector<ColMeta> &index_cols)
+    {
+        std::vector<bool> covered(conds.size(), false);
+        for (const auto &col : index_cols) {
+            bool has_eq = false;
+            for (size_t i = 0; i < conds.size(); i++) {
+                const auto &cond = conds[i];
+                if (cond.is_rhs_val && !cond.is_subquery && cond.lhs_col.col_name == col.name) {
+                    covered[i] = true;
+                    has_eq |= cond.op == CompOp::OP_EQ;
+                }
+            }
+            if (!has_eq) {
+                break;
+            }
+        }
+        for (size_t i = 0; i < conds.size(); i++) {
+            const auto &cond = conds[i];
+            if (covered[i] || cond.is_subquery) {
+                continue;
+            }
+            const auto &lhs = tab_->get_col(cond.lhs_col.col_name);
+            Predicate::Operand lhs_operand{0, lhs.offset, lhs.len, lhs.type};
+            if (cond.is_rhs_val) {
+                residual_.add(lhs_operand, cond.op, cond.rhs_val);
+            } else {
+                const auto &rhs = tab_->get_col(cond.rhs_col.col_name);
+                residual_.add(lhs_operand, cond.op, Predicate::Operand{0, rhs.offset, rhs.len, rhs.type});
+            }
+        }
+    }
+
+    // 跳过区间内不满足其余条件的记录
+    void skip_filtered()
+    {
+        while (!scan_->is_end() && !residual_.eval(scan_->rid())) {
+            scan_->next();
+        }
+    }
+
     // 优化的边界更新函数，减少分支和函数调用开销
     static inline void update_bounds(char *upper_key, char *lower_key, char *key, ColType type, int len, bool update_upper, bool update_lower)
     {
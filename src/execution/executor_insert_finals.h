@@ -8,48 +8,75 @@
 class InsertExecutor : public AbstractExecutor
 {
 public:
+    // values_ 为按行展开的多行数据，每行 tab_->cols.size() 个值
     InsertExecutor(SmManager *sm_manager_, const std::string &tab_name, std::vector<Value> &values_, Context *context_)
     {
         auto tab_ = sm_manager_->db_.get_table(tab_name);
         auto fh_ = sm_manager_->fhs_[tab_->fd_].get();
+        auto col_num = tab_->cols.size();
+        auto pool = sm_manager_->memory_pool_manager_;
 
-        // Make record buffer
-        auto rid_ = sm_manager_->memory_pool_manager_->allocate(fh_->record_size);
-        std::memset(rid_, '\0', fh_->record_size);
-
-        for (size_t i = 0; i < values_.size(); i++)
+        std::vector<char *> rows;
+        rows.reserve(values_.size() / col_num);
+        try
         {
-            auto &col = tab_->cols[i];
-            auto &val = values_[i];
-            if (col.type != val.type)
+            for (size_t row = 0; row < values_.size(); row += col_num)
             {
-                if (!can_cast_type(val.type, col.type))
-                    throw RMDBError();
-                else
-                    cast_value(val, col.type);
-            }
+                // Make record buffer
+                auto rid_ = pool->allocate(fh_->record_size);
+                std::memset(rid_, '\0', fh_->record_size);
+                rows.push_back(rid_);
 
-            switch (val.type)
-            {
-            case ColType::TYPE_INT:
-            {
-                std::memcpy(rid_ + col.offset, &val.int_val, col.len);
-                break;
-            }
-            case ColType::TYPE_FLOAT:
-            {
-                std::memcpy(rid_ + col.offset, &val.float_val, col.len);
-                break;
+                for (size_t i = 0; i < col_num; i++)
+                {
+                    auto &col = tab_->cols[i];
+                    auto &val = values_[row + i];
+                    if (col.type != val.type)
+                    {
+                        if (!can_cast_type(val.type, col.type))
+                            throw RMDBError();
+                        else
+                            cast_value(val, col.type);
+                    }
+
+                    switch (val.type)
+                    {
+                    case ColType::TYPE_INT:
+                    {
+                        std::memcpy(rid_ + col.offset, &val.int_val, col.len);
+                        break;
+                    }
+                    case ColType::TYPE_FLOAT:
+                    {
+                        std::memcpy(rid_ + col.offset, &val.float_val, col.len);
+                        break;
+                    }
+                    case ColType::TYPE_STRING:
+                    {
+                        std::memcpy(rid_ + col.offset, val.str_val.c_str(), val.str_val.length());
+                        break;
+                    }
+                    }
+                }
             }
-            case ColType::TYPE_STRING:
+        }
+        catch (RMDBError &)
+        {
+            for (auto rid_ : rows)
             {
-                std::memcpy(rid_ + col.offset, val.str_val.c_str(), val.str_val.length());
-                break;
-            }
+                pool->deallocate(rid_, fh_->record_size);
             }
+            throw;
         }
 
-        // Insert into index
+        insert_batch(sm_manager_, tab_, rows, context_);
+    };
+
+    // 整批写入：先对整批做唯一性检查，再对每个索引和记录文件各加一次锁批量插入。
+    // 检查失败时释放整批记录，不产生任何写入
+    static void insert_batch(SmManager *sm_manager_, TabMeta *tab_, std::vector<char *> &rows, Context *context_)
+    {
+        auto fh_ = sm_manager_->fhs_[tab_->fd_].get();
         auto &indexes = tab_->indexes;
 
         if (IxIndexHandle::unique_check)
@@ -57,23 +84,29 @@ public:
             for (auto &index : indexes)
             {
                 auto ih = sm_manager_->ihs_[index.fd_].get();
-                if (ih->exists_entry(rid_))
+                if (ih->exists_any(rows))
                 {
-                    sm_manager_->memory_pool_manager_->deallocate(rid_, fh_->record_size);
+                    for (auto rid_ : rows)
+                    {
+                        sm_manager_->memory_pool_manager_->deallocate(rid_, fh_->record_size);
+                    }
                     throw IndexEntryAlreadyExistError();
                 }
             }
         }
 
-
+        // Insert into index
         for (auto &index : indexes)
         {
-            auto ih = sm_manager_->ihs_[index.fd_].get();
-            ih->insert_entry(rid_);
+            sm_manager_->ihs_[index.fd_]->insert_entries(rows);
         }
 
         // Insert into record file
-        fh_->insert_record(rid_);
-        context_->txn_->append_write_record(WriteType::INSERT_TUPLE, tab_->fd_, rid_);
-    };
+        fh_->insert_records(rows);
+        for (auto rid_ : rows)
+        {
+            context_->txn_->append_write_record(WriteType::INSERT_TUPLE, tab_->fd_, rid_);
+        }
+        sm_manager_->stats_.note_modified(tab_->fd_, rows.size());
+    }
 };
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "execution_manager_finals.h"
+#include "executor_abstract_finals.h"
+
+// LIMIT：跳过子节点的前 offset_ 条记录，再输出至多 limit_ 条。不改变记录布局，
+// 输出够了就不再向子节点要记录，子节点是按索引顺序的扫描时扫描随之结束
+class LimitExecutor : public AbstractExecutor
+{
+private:
+    std::unique_ptr<AbstractExecutor> prev_;
+    size_t limit_;
+    size_t offset_;
+    size_t skipped_ = 0; // 已跳过的记录数
+    size_t emitted_ = 0; // 已输出的记录数
+
+public:
+    LimitExecutor(std::unique_ptr<AbstractExecutor> prev, size_t limit, size_t offset) : prev_(std::move(prev)), limit_(limit), offset_(offset) {}
+
+    const AbstractExecutor *child() const { return prev_.get(); }
+
+    void beginTuple() override
+    {
+        emitted_ = 0;
+        if (limit_ == 0)
+        {
+            return;
+        }
+        prev_->beginTuple();
+        for (skipped_ = 0; skipped_ < offset_ && !prev_->is_end(); skipped_++)
+        {
+            prev_->nextTuple();
+        }
+    }
+
+    void nextTuple() override
+    {
+        prev_->nextTuple();
+        emitted_++;
+    }
+
+    std::unique_ptr<RmRecord> Next() override { return is_end() ? nullptr : prev_->Next(); }
+
+    bool is_end() const override { return emitted_ >= limit_ || prev_->is_end(); }
+
+    void beginBatch() override
+    {
+        skipped_ = 0;
+        emitted_ = 0;
+        if (limit_ > 0)
+        {
+            prev_->beginBatch();
+        }
+    }
+
+    // 只改选择向量：去掉还需跳过的前几条，截掉超出 limit_ 的部分
+    size_t NextBatch(TupleBatch &batch) override
+    {
+        batch.clear();
+        while (emitted_ < limit_)
+        {
+            size_t n = prev_->NextBatch(batch);
+            if (n == 0)
+            {
+                return 0;
+            }
+            size_t skip = std::min(n, offset_ - skipped_);
+            size_t take = std::min(n - skip, limit_ - emitted_);
+            skipped_ += skip;
+            if (take == 0)
+            {
+                continue;
+            }
+            std::copy(batch.sel.begin() + skip, batch.sel.begin() + skip + take, batch.sel.begin());
+            batch.sel_size = take;
+            emitted_ += take;
+            return take;
+        }
+        batch.clear();
+        return 0;
+    }
+
+    size_t tupleLen() const override { return prev_->tupleLen(); }
+
+    std::vector<int> seg_lens() const override { return prev_->seg_lens(); }
+
+    const std::vector<ColMeta> &cols() const override { return prev_->cols(); }
+};
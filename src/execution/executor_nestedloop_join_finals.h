@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+
+#include "common/predicate_finals.h"
 #include "execution_manager_finals.h"
 #include "executor_abstract_finals.h"
 
@@ -14,6 +17,18 @@ private:
     bool isEnd;
     std::unique_ptr<RmRecord> left_record_; // 当前左表记录
 
+    // 批量执行时右表只扫描一次，物化后对每一批左记录重复使用
+    bool inner_built_ = false;
+    std::vector<char> inner_rows_;
+    size_t inner_num_ = 0;
+    SegLayout left_layout_;
+    Predicate conds_pred_;                // 编译后的连接条件，左记录各段之后接右记录
+    std::vector<const char *> row_segs_; // 正在判断的一对左右记录
+    std::vector<char> out_;              // Next 返回的记录
+    TupleBatch left_batch_;
+    size_t left_pos_ = 0;  // 当前左记录在 left_batch_ 中的位置
+    size_t inner_pos_ = 0; // 当前左记录下一条要比较的右记录
+
 public:
     NestedLoopJoinExecutor(std::unique_ptr<AbstractExecutor> left, std::unique_ptr<AbstractExecutor> right, std::vector<Condition> conds) : left_(std::move(left)), right_(std::move(right)), fed_conds_(std::move(conds)), isEnd(false)
     {
@@ -25,6 +40,25 @@ public:
             col.offset += left_->tupleLen(); // 调整右表字段偏移
         }
         cols_.insert(cols_.end(), right_cols.begin(), right_cols.end());
+
+        // 连接顺序由优化器决定，表在左右记录中的偏移不一定从 0 开始，按子节点的列重新定位
+        for (auto &cond : fed_conds_)
+        {
+            cond.lhs = *get_col(left_->cols(), cond.lhs_col);
+            if (!cond.is_rhs_val)
+            {
+                cond.rhs = *get_col(right_->cols(), cond.rhs_col);
+            }
+        }
+        left_layout_ = SegLayout(left_->seg_lens());
+        int right_seg = static_cast<int>(left_layout_.width());
+        for (auto &cond : fed_conds_)
+        {
+            auto lhs = left_layout_.locate(cond.lhs.offset);
+            conds_pred_.add({lhs.seg, lhs.offset, cond.lhs.len, cond.lhs.type}, cond, {right_seg, cond.rhs.offset, cond.rhs.len, cond.rhs.type});
+        }
+        row_segs_.resize(right_seg + 1);
+        out_.resize(len_);
     }
 
     void beginTuple() override
@@ -42,6 +76,76 @@ public:
         find_next_valid_tuple();
     }
 
+    void beginBatch() override
+    {
+        if (!inner_built_)
+        {
+            inner_built_ = true;
+            size_t right_len = right_->tupleLen();
+            TupleBatch batch;
+            SegLayout layout(right_->seg_lens());
+            right_->beginBatch();
+            while (right_->NextBatch(batch) != 0)
+            {
+                inner_rows_.resize(inner_rows_.size() + batch.sel_size * right_len);
+                char *dst = inner_rows_.data() + inner_num_ * right_len;
+                for (size_t i = 0; i < batch.sel_size; i++, dst += right_len)
+                {
+                    layout.gather(batch.row(i), dst);
+                }
+                inner_num_ += batch.sel_size;
+            }
+        }
+        left_->beginBatch();
+        left_batch_.clear();
+        left_pos_ = 0;
+        inner_pos_ = 0;
+    }
+
+    size_t NextBatch(TupleBatch &batch) override
+    {
+        size_t width = left_layout_.width();
+        batch.clear(width + 1);
+        size_t right_len = right_->tupleLen();
+        while (!batch.full())
+        {
+            if (left_pos_ == left_batch_.sel_size)
+            {
+                // 已输出的记录指向当前左批次，先把它们交出去，下一次调用再取新的左批次
+                if (batch.size > 0)
+                {
+                    break;
+                }
+                left_pos_ = 0;
+                inner_pos_ = 0;
+                if (inner_num_ == 0 || left_->NextBatch(left_batch_) == 0)
+                {
+                    left_batch_.clear();
+                    break;
+                }
+            }
+            char *const *left = left_batch_.row(left_pos_);
+            std::copy(left, left + width, row_segs_.begin());
+            for (; inner_pos_ < inner_num_ && !batch.full(); inner_pos_++)
+            {
+                char *right = inner_rows_.data() + inner_pos_ * right_len;
+                row_segs_[width] = right;
+                if (conds_pred_.eval(row_segs_.data()))
+                {
+                    char **segs = batch.append_row();
+                    std::copy(left, left + width, segs);
+                    segs[width] = right;
+                }
+            }
+            if (inner_pos_ == inner_num_)
+            {
+                left_pos_++;
+                inner_pos_ = 0;
+            }
+        }
+        return batch.sel_size;
+    }
+
     void find_next_valid_tuple()
     {
         while (!left_->is_end())
@@ -87,98 +191,31 @@ public:
         return nullptr;
     }
 
-    bool satisfies_join_conds(const RmRecord *left, const RmRecord *right) const
+    bool satisfies_join_conds(const RmRecord *left, const RmRecord *right)
     {
-        // 检查所有连接条件是否都满足
-        return std::all_of(fed_conds_.begin(), fed_conds_.end(), [&](const Condition &cond)
-                           { return evaluate_cond(left, right, cond); });
+        left_layout_.split(left->data, row_segs_.data());
+        row_segs_.back() = right->data;
+        return conds_pred_.eval(row_segs_.data());
     }
 
+    // 拼接到 out_ 中，返回的记录在下一次调用 Next 前有效
     std::unique_ptr<RmRecord> merge_records(const RmRecord *left, const RmRecord *right)
     {
-        auto combined = std::make_unique<RmRecord>();
-        combined->data = new char[len_];
-        std::memcpy(combined->data, left->data, left_->tupleLen());
-        std::memcpy(combined->data + left_->tupleLen(), right->data, right_->tupleLen());
-        return combined;
+        std::memcpy(out_.data(), left->data, left_->tupleLen());
+        std::memcpy(out_.data() + left_->tupleLen(), right->data, right_->tupleLen());
+        return std::make_unique<RmRecord>(out_.data(), static_cast<int>(len_));
     }
 
-    static bool evaluate_cond(const RmRecord *left, const RmRecord *right, const Condition &cond)
+    size_t tupleLen() const override
     {
-        // 获取左侧字段数据
-        char *lhs_buf = left->data + cond.lhs.offset;
-        char *rhs_buf = right->data + cond.rhs.offset;
-
-        // 根据列的类型来比较数据
-        switch (cond.lhs.type)
-        {
-        case TYPE_INT:
-        {
-            int lhs_value = *reinterpret_cast<int *>(lhs_buf);
-            int rhs_value = cond.is_rhs_val ? cond.rhs_val.int_val : *reinterpret_cast<int *>(rhs_buf);
-            switch (cond.op)
-            {
-            case OP_EQ:
-                return lhs_value == rhs_value;
-            case OP_LT:
-                return lhs_value < rhs_value;
-            case OP_LE:
-                return lhs_value <= rhs_value;
-            case OP_GT:
-                return lhs_value > rhs_value;
-            case OP_GE:
-                return lhs_value >= rhs_value;
-            }
-            break;
-        }
-        case TYPE_FLOAT:
-        {
-            float lhs_value = *reinterpret_cast<float *>(lhs_buf);
-            float rhs_value = cond.is_rhs_val ? cond.rhs_val.float_val : *reinterpret_cast<float *>(rhs_buf);
-            switch (cond.op)
-            {
-            case OP_EQ:
-                return lhs_value == rhs_value;
-            case OP_LT:
-                return lhs_value < rhs_value;
-            case OP_LE:
-                return lhs_value <= rhs_value;
-            case OP_GT:
-                return lhs_value > rhs_value;
-            case OP_GE:
-                return lhs_value >= rhs_value;
-            }
-            break;
-        }
-        case TYPE_STRING:
-        {
-            std::string lhs_value(lhs_buf, strnlen(lhs_buf, cond.lhs.len));
-            std::string rhs_value = cond.is_rhs_val ? cond.rhs_val.str_val : std::string(rhs_buf, strnlen(rhs_buf, cond.rhs.len));
-            int cmp_result = lhs_value.compare(rhs_value);
-            switch (cond.op)
-            {
-            case OP_EQ:
-                return cmp_result == 0;
-            case OP_LT:
-                return cmp_result < 0;
-            case OP_LE:
-                return cmp_result <= 0;
-            case OP_GT:
-                return cmp_result > 0;
-            case OP_GE:
-                return cmp_result >= 0;
-            }
-            break;
-        }
-        default:
-            return false; // 对于未知类型，返回 false
-        }
-        return false; // 默认返回 false
+        return left_->tupleLen() + right_->tupleLen(); // 返回左右节点的记录长度之和
     }
 
-    size_t tupleLen() const override
+    std::vector<int> seg_lens() const override
     {
-        return left_->tupleLen() + right_->tupleLen(); // 返回左右节点的记录长度之和
+        auto lens = left_layout_.lens;
+        lens.push_back(static_cast<int>(right_->tupleLen()));
+        return lens;
     }
 
     const std::vector<ColMeta> &cols() const override
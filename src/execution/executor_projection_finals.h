@@ -6,7 +6,11 @@
 #include "execution_merge_join_finals.h"
 #include "execution_sort_finals.h"
 #include "executor_abstract_finals.h"
+#include "executor_empty_scan_finals.h"
+#include "executor_hash_join_finals.h"
+#include "executor_index_nestedloop_join_finals.h"
 #include "executor_index_scan_finals.h"
+#include "executor_limit_finals.h"
 #include "executor_seq_scan_finals.h"
 
 class ProjectionExecutor : public AbstractExecutor
@@ -31,15 +35,25 @@ public:
 
     const std::vector<ColMeta> &cols() const override
     {
-        if (dynamic_cast<IndexScanExecutor *>(prev_.get()) != nullptr)
+        // LIMIT 原样输出子节点的记录，按它下面的算子判断
+        const AbstractExecutor *prev = prev_.get();
+        if (auto limit = dynamic_cast<const LimitExecutor *>(prev))
+            prev = limit->child();
+        if (dynamic_cast<const IndexScanExecutor *>(prev) != nullptr)
             return cols_;
-        else if (dynamic_cast<NestedLoopJoinExecutor *>(prev_.get()) != nullptr)
+        else if (dynamic_cast<const NestedLoopJoinExecutor *>(prev) != nullptr)
             return cols_;
-        else if (dynamic_cast<MergeJoinExecutor *>(prev_.get()) != nullptr)
+        else if (dynamic_cast<const MergeJoinExecutor *>(prev) != nullptr)
             return cols_;
-        else if (dynamic_cast<SeqScanExecutor *>(prev_.get()) != nullptr)
+        else if (dynamic_cast<const HashJoinExecutor *>(prev) != nullptr)
             return cols_;
-        else if (dynamic_cast<SortExecutor *>(prev_.get()) != nullptr)
+        else if (dynamic_cast<const IndexNestedLoopJoinExecutor *>(prev) != nullptr)
+            return cols_;
+        else if (dynamic_cast<const SeqScanExecutor *>(prev) != nullptr)
+            return cols_;
+        else if (dynamic_cast<const EmptyScanExecutor *>(prev) != nullptr)
+            return cols_;
+        else if (dynamic_cast<const SortExecutor *>(prev) != nullptr)
             return cols_;
         else
             return prev_->cols();
@@ -51,5 +65,12 @@ public:
 
     std::unique_ptr<RmRecord> Next() override { return prev_->Next(); }
 
+    // 投影不改变记录布局，批量接口直接透传
+    void beginBatch() override { prev_->beginBatch(); }
+
+    size_t NextBatch(TupleBatch &batch) override { return prev_->NextBatch(batch); }
+
+    std::vector<int> seg_lens() const override { return prev_->seg_lens(); }
+
     bool is_end() const override { return prev_->is_end(); };
 };
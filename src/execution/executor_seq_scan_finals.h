@@ -5,8 +5,10 @@
 #include <vector>
 
 #include "execution_manager_finals.h"
+#include "execution_parallel_finals.h"
 #include "executor_gap_lock_finals.h"
 #include "executor_abstract_finals.h"
+#include "index/ix_memory_scan_finals.h"
 #include "record/rm_scan_finals.h"
 
 class SeqScanExecutor : public AbstractExecutor
@@ -25,6 +27,8 @@ private:
 
     std::unique_ptr<GapLockExecutor> gap_lock;
     Context *context_;
+    int parallel_degree_;                    // 批量接口下的扫描并行度
+    std::unique_ptr<ScanExchange> exchange_; // 并行扫描时的结果队列
 
 public:
     SeqScanExecutor(SmManager *sm_manager, std::string tab_name, const std::vector<Condition> &conds, Context *context) : tab_name_(std::move(tab_name)), sm_manager_(sm_manager)
@@ -36,6 +40,7 @@ public:
         len_ = fh_->record_size;
 
         context_ = context;
+        parallel_degree_ = context_->parallel_degree_;
 
         gap_lock = std::make_unique<GapLockExecutor>(sm_manager, tab_, conds, context_);
     }
@@ -72,7 +77,63 @@ public:
 
     char *rid() const override { return rid_; }
 
+    // 并行度大于 1 且表足够大时由工作线程并行扫描，按索引顺序扫描时仍然串行
+    void beginBatch() override
+    {
+        exchange_.reset();
+        if (parallel())
+        {
+            exchange_ = std::make_unique<ScanExchange>(fh_, gap_lock->gap, parallel_degree_);
+            return;
+        }
+        beginTuple();
+    }
+
+    // 先取出一批记录指针，再统一按条件过滤出选择向量
+    size_t NextBatch(TupleBatch &batch) override
+    {
+        if (exchange_ != nullptr)
+        {
+            return exchange_->next(batch);
+        }
+        batch.clear();
+        while (batch.sel_size == 0 && !scan_->is_end())
+        {
+            batch.clear();
+            for (; !batch.full() && !scan_->is_end(); scan_->next())
+            {
+                batch.push(scan_->rid());
+            }
+            for (size_t i = 0; i < batch.size; i++)
+            {
+                if (gap_lock->gap->overlap(batch.segs[i]))
+                {
+                    batch.select(i);
+                }
+            }
+        }
+        return batch.sel_size;
+    }
+
+    int parallel_degree() const { return parallel_degree_; }
+
+    // 可以并行扫描时返回按 morsel 扫描的接口，由父算子在自己的线程中驱动，不经过 NextBatch
+    std::unique_ptr<MorselScan> morsel_scan() const
+    {
+        if (!parallel())
+        {
+            return nullptr;
+        }
+        return std::make_unique<MorselScan>(fh_, gap_lock->gap);
+    }
+
 private:
+    bool parallel() const
+    {
+        bool by_index = !tab_->indexes.empty() && fh_->ban;
+        return !by_index && MorselScan::worth(fh_, parallel_degree_);
+    }
+
     void find_next_valid_tuple()
     {
         while (!scan_->is_end())
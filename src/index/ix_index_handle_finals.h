@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <queue>
 #include <shared_mutex>
 #include <utility>
@@ -166,6 +167,36 @@ public:
         bp_tree_.insert(key);
     }
 
+    // 批量唯一性检查：与已有键重复或批内互相重复都返回 true
+    bool exists_any(const std::vector<char *> &keys) const {
+        std::shared_lock lk(rw_mutex);
+        for (auto key: keys) {
+            if (bp_tree_.contains(key)) {
+                return true;
+            }
+        }
+        if (keys.size() < 2) {
+            return false;
+        }
+        auto sorted = keys;
+        auto comp = bp_tree_.key_comp();
+        std::sort(sorted.begin(), sorted.end(), comp);
+        for (size_t i = 1; i < sorted.size(); ++i) {
+            if (!comp(sorted[i - 1], sorted[i])) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // 整批只加一次写锁
+    void insert_entries(const std::vector<char *> &keys) {
+        std::unique_lock lk(rw_mutex);
+        for (auto key: keys) {
+            bp_tree_.insert(key);
+        }
+    }
+
     void delete_entry(char *key) {
         std::unique_lock lk(rw_mutex);  // exclusive lock for write operation
         bp_tree_.erase(key);
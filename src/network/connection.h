@@ -0,0 +1,46 @@
+#pragma once
+
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cahce/plan_cache.h"
+#include "common/arena.h"
+#include "common/config_finals.h"
+#include "common/send_buffer.h"
+#include "../deps/parallel_hashmap/phmap.h"
+
+// 一个客户端连接的全部会话状态，原先散落在 client_handler 的栈上
+struct Connection {
+    // 连接使用的协议在收到第一个字节时确定，SHM 由分帧连接上的 FRAME_SHM_ATTACH 切换
+    enum class Mode { UNKNOWN, LEGACY, FRAMED, SHM };
+
+    explicit Connection(int fd_, bool listener_ = false) : fd(fd_), listener(listener_) {}
+
+    ~Connection() {
+        if (passed_fd >= 0) {
+            close(passed_fd);
+        }
+    }
+
+    int fd;
+    bool listener; // 监听套接字也注册在同一个 epoll 上
+
+    txn_id_t txn_id = INVALID_TXN_ID;
+    phmap::flat_hash_map<std::string, PreparedStatement> prepared_stmts;
+    Mode mode = Mode::UNKNOWN;
+
+    // 接收缓冲区，分帧连接下可能包含不完整的帧，大小随最大帧增长
+    std::vector<char> inbox = std::vector<char>(BUFFER_LENGTH + 1);
+    size_t inbox_size = 0;
+
+    int passed_fd = -1; // 第一次读取时随 SCM_RIGHTS 收到的共享内存 fd
+    std::unique_ptr<shm::Channel> shm; // SHM 模式下请求和结果所在的共享内存
+
+    SendBuffer send_buf;
+    Arena arena; // 按语句回收的对象内存
+    std::string output; // 当前语句要追加到 output.txt 的内容
+    int parallel_degree = 1; // SET parallel_degree 设置的扫描并行度
+};
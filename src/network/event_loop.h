@@ -0,0 +1,113 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "connection.h"
+#include "executor_pool.h"
+
+// epoll reactor：单线程负责 accept 和可读事件检测，语句的执行交给 ExecutorPool。
+// 客户端 fd 以 EPOLLONESHOT 注册，同一时刻一个连接只会被一个执行线程处理，
+// 处理完成后由执行线程重新挂回 epoll。
+class EventLoop {
+public:
+    static constexpr int MAX_EVENTS = 64;
+    static constexpr int STALL_CHECK_MS = 50;
+
+    // handler 返回 false 表示连接需要关闭
+    using Handler = std::function<bool(Connection *)>;
+
+    EventLoop(size_t num_workers, size_t max_workers, Handler handler)
+        : handler_(std::move(handler)),
+          pool_(num_workers, max_workers, [this](Connection *conn) { serve(conn); }) {
+        epfd_ = epoll_create1(EPOLL_CLOEXEC);
+    }
+
+    ~EventLoop() {
+        for (auto &listener: listeners_) {
+            close(listener->fd);
+        }
+        close(epfd_);
+    }
+
+    EventLoop(const EventLoop &) = delete;
+    EventLoop &operator=(const EventLoop &) = delete;
+
+    bool add_listener(int fd) {
+        // 监听套接字非阻塞，accept_all 一次取完所有排队的连接
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        listeners_.push_back(std::make_unique<Connection>(fd, true));
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.ptr = listeners_.back().get();
+        return epoll_ctl(epfd_, EPOLL_CTL_ADD, fd, &ev) == 0;
+    }
+
+    void run(const bool &should_exit) {
+        epoll_event events[MAX_EVENTS];
+        while (!should_exit) {
+            int n = epoll_wait(epfd_, events, MAX_EVENTS, STALL_CHECK_MS);
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                break;
+            }
+            for (int i = 0; i < n; ++i) {
+                auto conn = static_cast<Connection *>(events[i].data.ptr);
+                if (conn->listener) {
+                    accept_all(conn->fd);
+                } else {
+                    pool_.submit(conn);
+                }
+            }
+            pool_.check_stall();
+        }
+    }
+
+private:
+    void accept_all(int listen_fd) {
+        while (true) {
+            // 连接上的写走阻塞模式，读取时使用 MSG_DONTWAIT
+            int fd = accept4(listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+            if (fd == -1) {
+                return;
+            }
+            auto conn = new Connection(fd);
+            epoll_event ev{};
+            ev.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+            ev.data.ptr = conn;
+            if (epoll_ctl(epfd_, EPOLL_CTL_ADD, fd, &ev) != 0) {
+                close(fd);
+                delete conn;
+            }
+        }
+    }
+
+    // 在执行线程中运行
+    void serve(Connection *conn) {
+        if (!handler_(conn)) {
+            epoll_ctl(epfd_, EPOLL_CTL_DEL, conn->fd, nullptr);
+            close(conn->fd);
+            delete conn;
+            return;
+        }
+        epoll_event ev{};
+        ev.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+        ev.data.ptr = conn;
+        epoll_ctl(epfd_, EPOLL_CTL_MOD, conn->fd, &ev);
+    }
+
+    int epfd_;
+    Handler handler_;
+    std::vector<std::unique_ptr<Connection>> listeners_;
+    ExecutorPool pool_;
+};
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "connection.h"
+
+// 执行线程池，线程数默认等于核数，负责执行 reactor 分发过来的就绪连接。
+// check_stall 临时补充的线程空闲超过 IDLE_TIMEOUT 后退出，线程数回落到初始大小
+class ExecutorPool {
+public:
+    using Handler = std::function<void(Connection *)>;
+
+    static constexpr auto IDLE_TIMEOUT = std::chrono::seconds(10);
+
+    ExecutorPool(size_t num_workers, size_t max_workers, Handler handler)
+        : max_workers_(max_workers), handler_(std::move(handler)) {
+        if (num_workers == 0) {
+            num_workers = 1;
+        }
+        base_workers_ = num_workers;
+        for (size_t i = 0; i < num_workers; ++i) {
+            add_worker();
+        }
+    }
+
+    ~ExecutorPool() {
+        {
+            std::lock_guard lk(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto &worker: workers_) {
+            worker.join();
+        }
+    }
+
+    ExecutorPool(const ExecutorPool &) = delete;
+    ExecutorPool &operator=(const ExecutorPool &) = delete;
+
+    void submit(Connection *conn) {
+        {
+            std::lock_guard lk(mutex_);
+            queue_.push_back(conn);
+        }
+        cv_.notify_one();
+    }
+
+    // 由 reactor 周期性调用：锁等待（wait-die 中老事务等待新事务）可能占满所有执行线程，
+    // 而持锁事务的下一条语句（commit）还在队列里。若队列非空且一个周期内没有任何语句完成，
+    // 则临时补充一个执行线程，避免整个池子饿死。
+    void check_stall() {
+        std::lock_guard lk(mutex_);
+        reap_exited();
+        auto finished = finished_.load(std::memory_order_relaxed);
+        if (queue_.empty() || finished != last_finished_) {
+            last_finished_ = finished;
+            return;
+        }
+        if (live_workers() < max_workers_) {
+            add_worker();
+        }
+    }
+
+    size_t size() const {
+        std::lock_guard lk(mutex_);
+        return live_workers();
+    }
+
+private:
+    // 调用方持有 mutex_
+    size_t live_workers() const { return workers_.size() - exited_.size(); }
+
+    // 调用方持有 mutex_：回收已经退出的临时线程
+    void reap_exited() {
+        for (auto id: exited_) {
+            for (auto it = workers_.begin(); it != workers_.end(); ++it) {
+                if (it->get_id() == id) {
+                    it->join();
+                    workers_.erase(it);
+                    break;
+                }
+            }
+        }
+        exited_.clear();
+    }
+
+    void add_worker() {
+        workers_.emplace_back([this] { worker_loop(); });
+    }
+
+    void worker_loop() {
+        while (true) {
+            Connection *conn;
+            {
+                std::unique_lock lk(mutex_);
+                if (!cv_.wait_for(lk, IDLE_TIMEOUT, [this] { return stop_ || !queue_.empty(); })) {
+                    // 空闲超时：多于初始线程数时退出，由 check_stall 回收
+                    if (live_workers() > base_workers_) {
+                        exited_.push_back(std::this_thread::get_id());
+                        return;
+                    }
+                    continue;
+                }
+                if (stop_ && queue_.empty()) {
+                    return;
+                }
+                conn = queue_.front();
+                queue_.pop_front();
+            }
+            handler_(conn);
+            finished_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    size_t base_workers_;
+    size_t max_workers_;
+    Handler handler_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Connection *> queue_;
+    std::vector<std::thread> workers_;
+    std::vector<std::thread::id> exited_; // 已退出、尚未 join 的临时线程
+    bool stop_ = false;
+
+    std::atomic<size_t> finished_{0};
+    size_t last_finished_ = 0;
+};
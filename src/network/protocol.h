@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// 分帧协议：每帧 = 4 字节大端 payload 长度 + 1 字节帧类型 + payload。
+// 长度最高字节必须为 0（单帧不超过 16MB），因此分帧连接的第一个字节总是 0x00，
+// 而旧客户端直接发送 SQL 文本，第一个字节不可能为 0，服务端据此区分两种协议。
+namespace protocol {
+
+    static constexpr size_t FRAME_HEADER_SIZE = 5;
+    static constexpr uint32_t MAX_FRAME_PAYLOAD = (1u << 24) - 1;
+
+    // 结果集按块流式返回，缓冲区超过该大小即发送一个数据帧
+    static constexpr size_t RESULT_CHUNK_SIZE = 64 * 1024;
+
+    // 客户端 -> 服务端
+    static constexpr char FRAME_QUERY = 'Q';     // payload 为一条 SQL
+    static constexpr char FRAME_TERMINATE = 'X'; // 关闭连接，payload 为空
+    static constexpr char FRAME_SHM_ATTACH = 'M'; // 仅限 AF_UNIX 连接的第一帧，随 SCM_RIGHTS 携带共享内存 fd，见 shm_channel.h
+
+    // 服务端 -> 客户端
+    static constexpr char FRAME_DATA = 'D'; // 结果数据块，一条语句可以有任意多个
+    static constexpr char FRAME_END = 'E';  // 结果结束标记，payload 为 1 字节状态
+
+    // FRAME_END 的状态
+    static constexpr char STATUS_OK = 'S';
+    static constexpr char STATUS_FAILURE = 'F';
+    static constexpr char STATUS_ABORT = 'A';
+    static constexpr char STATUS_PARSE_ERROR = 'P';
+
+    inline void encode_header(char *dst, char type, uint32_t payload_len) {
+        dst[0] = static_cast<char>((payload_len >> 24) & 0xff);
+        dst[1] = static_cast<char>((payload_len >> 16) & 0xff);
+        dst[2] = static_cast<char>((payload_len >> 8) & 0xff);
+        dst[3] = static_cast<char>(payload_len & 0xff);
+        dst[4] = type;
+    }
+
+    inline uint32_t decode_length(const char *src) {
+        auto p = reinterpret_cast<const unsigned char *>(src);
+        return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+               (static_cast<uint32_t>(p[2]) << 8) | static_cast<uint32_t>(p[3]);
+    }
+
+} // namespace protocol
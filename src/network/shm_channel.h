@@ -0,0 +1,378 @@
+#pragma once
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "protocol.h"
+
+// 本机客户端的共享内存传输。客户端用 memfd 创建一块共享内存，连上 AF_UNIX 监听端口后，
+// 把 fd 通过 SCM_RIGHTS 随 FRAME_SHM_ATTACH 帧一起发给服务端。此后请求和结果都写进这块内存里的
+// 两个单生产者单消费者环形缓冲区，内容仍是 protocol.h 定义的帧。套接字只用作门铃：
+// 客户端每写入一段请求就发 1 字节唤醒服务端的 epoll；服务端写结果时，只有客户端声明自己
+// 将要阻塞时才发门铃，客户端自旋等待期间不产生任何系统调用。
+// memfd 的大小用 F_SEAL_SHRINK | F_SEAL_GROW 封住，服务端只映射已封好的 fd，
+// 客户端事后 ftruncate 缩小文件也不会让服务端访问映射时收到 SIGBUS。
+namespace shm {
+
+    static constexpr int SIZE_SEALS = F_SEAL_SHRINK | F_SEAL_GROW;
+
+    static constexpr uint32_t MAGIC = 0x524d5348; // "RMSH"
+    static constexpr size_t DEFAULT_CAPACITY = 1 << 20;
+    static constexpr size_t CACHE_LINE = 64;
+
+    struct RingHeader {
+        alignas(CACHE_LINE) std::atomic<uint64_t> head; // 消费者已读到的位置
+        alignas(CACHE_LINE) std::atomic<uint64_t> tail; // 生产者已写到的位置
+        alignas(CACHE_LINE) std::atomic<uint32_t> consumer_waiting; // 消费者即将阻塞在门铃上
+    };
+
+    struct ChannelHeader {
+        uint32_t magic;
+        uint32_t capacity; // 每个方向的环形缓冲区大小，2 的幂
+        RingHeader request;  // 客户端 -> 服务端
+        RingHeader response; // 服务端 -> 客户端
+    };
+
+    // 单生产者单消费者环形缓冲区，位置单调递增，按 capacity 取模定位
+    class Ring {
+    public:
+        Ring(RingHeader *header, char *data, size_t capacity) : header_(header), data_(data), capacity_(capacity) {}
+
+        // 可读字节数；对方写坏了共享内存时返回值超过 capacity，调用方应断开连接
+        size_t readable() const {
+            return header_->tail.load(std::memory_order_acquire) - header_->head.load(std::memory_order_relaxed);
+        }
+
+        size_t capacity() const { return capacity_; }
+
+        // 生产者：写入尽可能多的字节，返回实际写入数
+        size_t write_some(const char *src, size_t n) {
+            uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+            uint64_t head = header_->head.load(std::memory_order_acquire);
+            size_t space = capacity_ - (tail - head);
+            if (space > capacity_) {
+                return 0;
+            }
+            n = std::min(n, space);
+            copy_in(tail, src, n);
+            header_->tail.store(tail + n, std::memory_order_seq_cst);
+            return n;
+        }
+
+        // 消费者：读出至多 n 字节，返回实际读出数
+        size_t read_some(char *dst, size_t n) {
+            uint64_t head = header_->head.load(std::memory_order_relaxed);
+            size_t avail = readable();
+            if (avail > capacity_) {
+                return 0;
+            }
+            n = std::min(n, avail);
+            copy_out(head, dst, n);
+            header_->head.store(head + n, std::memory_order_release);
+            return n;
+        }
+
+        // 生产者写完一批数据后调用：消费者已经声明要阻塞时需要发门铃
+        bool consumer_waiting() const { return header_->consumer_waiting.load(std::memory_order_seq_cst) != 0; }
+
+        // 消费者阻塞前后调用，与生产者的 tail 写入构成 Dekker 式握手
+        void set_waiting(bool waiting) { header_->consumer_waiting.store(waiting ? 1 : 0, std::memory_order_seq_cst); }
+
+    private:
+        void copy_in(uint64_t pos, const char *src, size_t n) {
+            size_t offset = pos & (capacity_ - 1);
+            size_t first = std::min(n, capacity_ - offset);
+            memcpy(data_ + offset, src, first);
+            memcpy(data_, src + first, n - first);
+        }
+
+        void copy_out(uint64_t pos, char *dst, size_t n) const {
+            size_t offset = pos & (capacity_ - 1);
+            size_t first = std::min(n, capacity_ - offset);
+            memcpy(dst, data_ + offset, first);
+            memcpy(dst + first, data_, n - first);
+        }
+
+        RingHeader *header_;
+        char *data_;
+        size_t capacity_;
+    };
+
+    // 一块映射好的共享内存及其上的两个方向的环形缓冲区
+    class Channel {
+    public:
+        ~Channel() {
+            if (base_ != nullptr) {
+                munmap(base_, size_);
+            }
+        }
+
+        Channel(const Channel &) = delete;
+        Channel &operator=(const Channel &) = delete;
+
+        static size_t layout_size(size_t capacity) { return data_offset() + 2 * capacity; }
+
+        // 客户端：创建并初始化共享内存，fd 由调用方发送给服务端后关闭
+        static std::unique_ptr<Channel> create(size_t capacity, int &fd) {
+            if (capacity == 0 || (capacity & (capacity - 1)) != 0 || capacity > UINT32_MAX) {
+                return nullptr;
+            }
+            fd = memfd_create("rmdb_shm", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+            if (fd < 0) {
+                return nullptr;
+            }
+            size_t size = layout_size(capacity);
+            if (ftruncate(fd, size) != 0 || fcntl(fd, F_ADD_SEALS, SIZE_SEALS | F_SEAL_SEAL) != 0) {
+                close(fd);
+                return nullptr;
+            }
+            auto channel = map(fd, size);
+            if (channel == nullptr) {
+                close(fd);
+                return nullptr;
+            }
+            auto header = channel->header();
+            header->magic = MAGIC;
+            header->capacity = static_cast<uint32_t>(capacity);
+            channel->init(capacity);
+            return channel;
+        }
+
+        // 服务端：映射客户端发来的 fd，校验大小已封住和布局，fd 由调用方关闭
+        static std::unique_ptr<Channel> attach(int fd) {
+            int seals = fcntl(fd, F_GET_SEALS);
+            if (seals < 0 || (seals & SIZE_SEALS) != SIZE_SEALS) {
+                return nullptr;
+            }
+            struct stat st {};
+            if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < data_offset()) {
+                return nullptr;
+            }
+            auto channel = map(fd, st.st_size);
+            if (channel == nullptr) {
+                return nullptr;
+            }
+            auto header = channel->header();
+            size_t capacity = header->capacity;
+            if (header->magic != MAGIC || capacity == 0 || (capacity & (capacity - 1)) != 0 ||
+                layout_size(capacity) > channel->size_) {
+                return nullptr;
+            }
+            channel->init(capacity);
+            return channel;
+        }
+
+        Ring &request() { return *request_; }
+
+        Ring &response() { return *response_; }
+
+    private:
+        Channel() = default;
+
+        static size_t data_offset() { return (sizeof(ChannelHeader) + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE; }
+
+        static std::unique_ptr<Channel> map(int fd, size_t size) {
+            void *base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (base == MAP_FAILED) {
+                return nullptr;
+            }
+            std::unique_ptr<Channel> channel(new Channel());
+            channel->base_ = static_cast<char *>(base);
+            channel->size_ = size;
+            return channel;
+        }
+
+        ChannelHeader *header() { return reinterpret_cast<ChannelHeader *>(base_); }
+
+        void init(size_t capacity) {
+            char *data = base_ + data_offset();
+            request_ = std::make_unique<Ring>(&header()->request, data, capacity);
+            response_ = std::make_unique<Ring>(&header()->response, data + capacity, capacity);
+        }
+
+        char *base_ = nullptr;
+        size_t size_ = 0;
+        std::unique_ptr<Ring> request_;
+        std::unique_ptr<Ring> response_;
+    };
+
+    // 发 1 字节门铃
+    inline bool ring_doorbell(int fd) {
+        char bell = 0;
+        while (send(fd, &bell, 1, MSG_NOSIGNAL | MSG_DONTWAIT) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            // 门铃已经积压在套接字里时对方必然会被唤醒
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        return true;
+    }
+
+    // 环形缓冲区满时等待对方消费；对方断开时返回 false
+    inline bool wait_for_space(int fd) {
+        pollfd pfd{fd, POLLRDHUP, 0};
+        if (poll(&pfd, 1, 0) > 0 && (pfd.revents & (POLLRDHUP | POLLHUP | POLLERR))) {
+            return false;
+        }
+        std::this_thread::yield();
+        return true;
+    }
+
+    // 客户端：通过 AF_UNIX 连接服务端并建立共享内存通道，之后用 query 收发帧
+    class Client {
+    public:
+        static constexpr int SPIN_ROUNDS = 1 << 14;
+
+        ~Client() {
+            if (fd_ >= 0) {
+                close(fd_);
+            }
+        }
+
+        bool connect(const char *unix_path, size_t capacity = DEFAULT_CAPACITY) {
+            fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            if (fd_ < 0) {
+                return false;
+            }
+            sockaddr_un addr{};
+            addr.sun_family = AF_UNIX;
+            snprintf(addr.sun_path, sizeof(addr.sun_path), "%s", unix_path);
+            if (::connect(fd_, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0) {
+                return false;
+            }
+            int shm_fd;
+            channel_ = Channel::create(capacity, shm_fd);
+            if (channel_ == nullptr) {
+                return false;
+            }
+
+            char frame[protocol::FRAME_HEADER_SIZE];
+            protocol::encode_header(frame, protocol::FRAME_SHM_ATTACH, 0);
+            iovec iov{frame, sizeof(frame)};
+            alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+            msghdr msg{};
+            msg.msg_iov = &iov;
+            msg.msg_iovlen = 1;
+            msg.msg_control = control;
+            msg.msg_controllen = sizeof(control);
+            cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+            cmsg->cmsg_level = SOL_SOCKET;
+            cmsg->cmsg_type = SCM_RIGHTS;
+            cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+            memcpy(CMSG_DATA(cmsg), &shm_fd, sizeof(int));
+            bool sent = sendmsg(fd_, &msg, MSG_NOSIGNAL) == static_cast<ssize_t>(sizeof(frame));
+            close(shm_fd);
+            if (!sent) {
+                return false;
+            }
+
+            // 服务端映射成功后经套接字回复一个 STATUS_OK 结束帧
+            char reply[protocol::FRAME_HEADER_SIZE + 1];
+            size_t got = 0;
+            while (got < sizeof(reply)) {
+                auto n = recv(fd_, reply + got, sizeof(reply) - got, 0);
+                if (n <= 0) {
+                    return false;
+                }
+                got += n;
+            }
+            return reply[4] == protocol::FRAME_END && reply[5] == protocol::STATUS_OK;
+        }
+
+        // 发送一条 SQL，收集全部数据帧直到结束帧，返回 false 表示连接已断开
+        bool query(const std::string &sql, std::string &result, char &status) {
+            char header[protocol::FRAME_HEADER_SIZE];
+            protocol::encode_header(header, protocol::FRAME_QUERY, static_cast<uint32_t>(sql.size()));
+            if (!send_bytes(header, sizeof(header)) || !send_bytes(sql.data(), sql.size())) {
+                return false;
+            }
+            result.clear();
+            while (true) {
+                if (!recv_bytes(header, sizeof(header))) {
+                    return false;
+                }
+                uint32_t len = protocol::decode_length(header);
+                if (header[4] == protocol::FRAME_END) {
+                    return len == 1 && recv_bytes(&status, 1);
+                }
+                size_t old_size = result.size();
+                result.resize(old_size + len);
+                if (!recv_bytes(&result[old_size], len)) {
+                    return false;
+                }
+            }
+        }
+
+    private:
+        bool send_bytes(const char *src, size_t n) {
+            auto &ring = channel_->request();
+            while (n > 0) {
+                size_t written = ring.write_some(src, n);
+                if (written == 0) {
+                    if (!wait_for_space(fd_)) {
+                        return false;
+                    }
+                    continue;
+                }
+                src += written;
+                n -= written;
+                if (!ring_doorbell(fd_)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool recv_bytes(char *dst, size_t n) {
+            auto &ring = channel_->response();
+            int spins = 0;
+            while (n > 0) {
+                size_t got = ring.read_some(dst, n);
+                if (got > 0) {
+                    dst += got;
+                    n -= got;
+                    spins = 0;
+                    continue;
+                }
+                // 单核机器上自旋只会抢走服务端的 CPU，直接阻塞
+                static const int spin_rounds = std::thread::hardware_concurrency() > 1 ? SPIN_ROUNDS : 0;
+                if (++spins < spin_rounds) {
+                    continue;
+                }
+                // 自旋超时后声明阻塞，再检查一次避免丢失唤醒
+                ring.set_waiting(true);
+                if (ring.readable() == 0) {
+                    char bells[64];
+                    auto r = recv(fd_, bells, sizeof(bells), 0);
+                    if (r <= 0 && !(r < 0 && errno == EINTR)) {
+                        ring.set_waiting(false);
+                        return false;
+                    }
+                }
+                ring.set_waiting(false);
+                spins = 0;
+            }
+            return true;
+        }
+
+        int fd_ = -1;
+        std::unique_ptr<Channel> channel_;
+    };
+
+} // namespace shm
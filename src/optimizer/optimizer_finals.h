@@ -2,6 +2,7 @@
 
 #include <map>
 
+#include "common/arena.h"
 #include "common/context_finals.h"
 #include "errors_finals.h"
 #include "parser/parser.h"
@@ -22,65 +23,72 @@ public:
         switch (query->parse->type) {
             case ast::HelpNode:
                 // help;
-                return std::make_shared<OtherPlan>(T_Help, std::string());
+                return make_arena_shared<OtherPlan>(T_Help, std::string());
             
             case ast::ShowTablesNode:
                 // show tables;
-                return std::make_shared<OtherPlan>(T_ShowTable, std::string());
+                return make_arena_shared<OtherPlan>(T_ShowTable, std::string());
             
             case ast::DescTableNode:
             {
                 // desc table;
                 auto x = std::static_pointer_cast<ast::DescTable>(query->parse);
-                return std::make_shared<OtherPlan>(T_DescTable, x->tab_name);
+                return make_arena_shared<OtherPlan>(T_DescTable, x->tab_name);
             }
             
             case ast::DescIndexNode:
             {
                 // show index;
                 auto x = std::static_pointer_cast<ast::DescIndex>(query->parse);
-                return std::make_shared<OtherPlan>(T_DescIndex, x->tab_name);
+                return make_arena_shared<OtherPlan>(T_DescIndex, x->tab_name);
             }
             
             case ast::TxnBeginNode:
                 // begin;
-                return std::make_shared<OtherPlan>(T_Transaction_begin, std::string());
+                return make_arena_shared<OtherPlan>(T_Transaction_begin, std::string());
             
             case ast::TxnAbortNode:
                 // abort;
-                return std::make_shared<OtherPlan>(T_Transaction_abort, std::string());
+                return make_arena_shared<OtherPlan>(T_Transaction_abort, std::string());
             
             case ast::TxnCommitNode:
                 // commit;
-                return std::make_shared<OtherPlan>(T_Transaction_commit, std::string());
+                return make_arena_shared<OtherPlan>(T_Transaction_commit, std::string());
             
             case ast::TxnRollbackNode:
                 // rollback;
-                return std::make_shared<OtherPlan>(T_Transaction_rollback, std::string());
+                return make_arena_shared<OtherPlan>(T_Transaction_rollback, std::string());
             
             case ast::SetStmtNode:
             {
                 // Set Knob Plan
                 auto x = std::static_pointer_cast<ast::SetStmt>(query->parse);
-                return std::make_shared<SetKnobPlan>(x->set_knob_type_, x->bool_val_);
+                return make_arena_shared<SetKnobPlan>(x->set_knob_type_, x->bool_val_, x->int_val_);
             }
             
             case ast::CreateStaticCheckpointNode:
-                return std::make_shared<OtherPlan>(T_Create_StaticCheckPoint, std::string());
+                return make_arena_shared<OtherPlan>(T_Create_StaticCheckPoint, std::string());
             
             case ast::CrashStmtNode:
-                return std::make_shared<OtherPlan>(T_Crash, std::string());
+                return make_arena_shared<OtherPlan>(T_Crash, std::string());
             
             case ast::LoadStmtNode:
             {
                 auto x = std::static_pointer_cast<ast::LoadStmt>(query->parse);
-                return std::make_shared<OtherPlan>(T_LoadData, x->tab_name, x->file_name);
+                return make_arena_shared<OtherPlan>(T_LoadData, x->tab_name, x->file_name);
+            }
+            
+            case ast::AnalyzeStmtNode:
+            {
+                // analyze [table];
+                auto x = std::static_pointer_cast<ast::AnalyzeStmt>(query->parse);
+                return make_arena_shared<OtherPlan>(T_Analyze, x->tab_name);
             }
             
             case ast::IoEnableNode:
             {
                 auto x = std::static_pointer_cast<ast::IoEnable>(query->parse);
-                return std::make_shared<OtherPlan>(T_IoEnable, x->set_io_enable);
+                return make_arena_shared<OtherPlan>(T_IoEnable, x->set_io_enable);
             }
             
             default:
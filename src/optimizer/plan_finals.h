@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cassert>
+#include <cstdint>
 #include <cstring>
 #include <memory>
 #include <string>
@@ -33,16 +34,21 @@ typedef enum PlanTag
     T_Transaction_rollback,
     T_SeqScan,
     T_IndexScan,
+    T_EmptyScan, // WHERE 恒假时代替表扫描
     T_NestLoop,
     T_SortMerge, // sort merge join
+    T_HashJoin,
+    T_IndexNestLoop, // index nested loop join
     T_Sort,
+    T_Limit,
     T_Projection,
     T_Agg,
     T_Having,
     T_Create_StaticCheckPoint,
     T_Crash,
     T_LoadData,
-    T_IoEnable
+    T_IoEnable,
+    T_Analyze
 } PlanTag;
 
 // 查询执行计划
@@ -79,6 +85,7 @@ public:
     std::string tab_name_;
     std::vector<Condition> conds_;
     IndexMeta index_meta_;
+    size_t limit_ = SIZE_MAX; // 上层只需要前 limit_ 条时索引扫描取够就停
 };
 
 class JoinPlan : public Plan
@@ -119,6 +126,9 @@ public:
     TabCol left_join_col, right_join_col;
 
     std::vector<std::string> tables;
+
+    // 查询用到的列，物化构建侧的哈希连接只保存其中的列，为空表示保留所有列
+    std::vector<TabCol> required_cols_;
 };
 
 class ProjectionPlan : public Plan
@@ -137,22 +147,47 @@ public:
     std::vector<TabCol> sel_cols_;
 };
 
+// 排序的一列
+struct SortKey
+{
+    TabCol col;
+    bool is_desc;
+};
+
 class SortPlan : public Plan
 {
 public:
-    SortPlan(PlanTag tag, std::shared_ptr<Plan> subplan, TabCol sel_col, bool is_desc)
+    SortPlan(PlanTag tag, std::shared_ptr<Plan> subplan, std::vector<SortKey> keys)
     {
         Plan::tag = tag;
         subplan_ = std::move(subplan);
-        sel_col_ = std::move(sel_col);
-        is_desc_ = is_desc;
+        keys_ = std::move(keys);
     }
 
     ~SortPlan() {}
 
     std::shared_ptr<Plan> subplan_;
-    TabCol sel_col_;
-    bool is_desc_;
+    std::vector<SortKey> keys_; // 先按第一列排序，相等时再看后面的列
+    size_t limit_ = SIZE_MAX;   // 上层只需要前 limit_ 条时只保留这么多条，不做全排序
+};
+
+// LIMIT count OFFSET offset：跳过前 offset_ 条，再输出至多 limit_ 条
+class LimitPlan : public Plan
+{
+public:
+    LimitPlan(PlanTag tag, std::shared_ptr<Plan> subplan, size_t limit, size_t offset)
+    {
+        Plan::tag = tag;
+        subplan_ = std::move(subplan);
+        limit_ = limit;
+        offset_ = offset;
+    }
+
+    ~LimitPlan() {}
+
+    std::shared_ptr<Plan> subplan_;
+    size_t limit_;
+    size_t offset_;
 };
 
 // dml语句，包括insert; delete; update; select语句　
@@ -230,15 +265,17 @@ public:
 class SetKnobPlan : public Plan
 {
 public:
-    SetKnobPlan(ast::SetKnobType knob_type, bool bool_value)
+    SetKnobPlan(ast::SetKnobType knob_type, bool bool_value, int int_value = 0)
     {
         Plan::tag = T_SetKnob;
         set_knob_type_ = knob_type;
         bool_value_ = bool_value;
+        int_value_ = int_value;
     }
 
     ast::SetKnobType set_knob_type_;
     bool bool_value_;
+    int int_value_;
 };
 
 class plannerInfo
@@ -260,6 +297,7 @@ public:
     std::vector<TabCol> sel_cols_;
     std::shared_ptr<Plan> subplan_;
     std::vector<TabCol> group_by_cols;
+    bool from_index_ = false; // 只有 MIN/MAX，直接取 subplan_ 索引扫描区间的两端
 
     AggPlan(PlanTag tag, std::shared_ptr<Plan> subplan, std::vector<TabCol> group_by_cols, std::vector<TabCol> sel_cols_) : sel_cols_(std::move(sel_cols_)), subplan_(std::move(subplan)), group_by_cols(std::move(group_by_cols)) { Plan::tag = tag; }
 
@@ -1,9 +1,15 @@
 #include "planner_finals.h"
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
+#include "common/arena.h"
 #include "execution/execution_merge_join_finals.h"
 #include "execution/executor_delete_finals.h"
 #include "execution/executor_index_scan_finals.h"
@@ -12,6 +18,7 @@
 #include "execution/executor_projection_finals.h"
 #include "execution/executor_seq_scan_finals.h"
 #include "execution/executor_update_finals.h"
+#include "optimizer/rewriter_finals.h"
 #include "record_printer.h"
 
 // 性能优化：预编译静态常量
@@ -28,6 +35,24 @@ namespace {
     // 预分配的内存池大小
     constexpr size_t TYPICAL_TABLE_COUNT = 8;
     constexpr size_t TYPICAL_CONDITION_COUNT = 16;
+
+    // 连接枚举：不超过 BUSHY_JOIN_LIMIT 张表时枚举浓密树，不超过 DP_JOIN_LIMIT 张表时动态规划枚举左深树，更多时贪心
+    constexpr size_t BUSHY_JOIN_LIMIT = 8;
+    constexpr size_t DP_JOIN_LIMIT = 14;
+
+    // 哈希连接构建侧每行的代价（物化 + 插入哈希表），相对于探测一行
+    constexpr double HASH_BUILD_FACTOR = 2.0;
+
+    // 一组表连接后的最优结果，叶子的 left/right 为 0
+    struct JoinRel
+    {
+        double rows = 0;           // 估计输出行数
+        double cost = 0;           // 估计代价（处理的元组数）
+        uint64_t left = 0;         // 左子树包含的表
+        uint64_t right = 0;        // 右子树包含的表
+        PlanTag tag = T_SeqScan;   // 叶子的扫描方式或连接算法
+        int key = -1;              // 排序归并/哈希连接使用的等值条件下标
+    };
 }
 
 IndexMeta Planner::get_index_cols(const std::string &tab_name, const std::vector<Condition> &curr_conds) const {
@@ -39,8 +64,8 @@ IndexMeta Planner::get_index_cols(const std::string &tab_name, const std::vector
         return {};
     }
 
-    // 用于存储条件列的集合
-    std::unordered_set<std::string> conds_cols_;
+    // 条件列及其上所有条件的联合选择率
+    std::unordered_map<std::string, double> conds_cols_;
     conds_cols_.reserve(curr_conds.size());
     
     // 遍历当前条件，只添加有效的列
@@ -49,7 +74,8 @@ IndexMeta Planner::get_index_cols(const std::string &tab_name, const std::vector
         // 如果条件是列与值比较，并且列属于当前表格
         if (cond.is_rhs_val && cond.lhs_col.tab_name == tab_name) 
         {
-            conds_cols_.emplace(cond.lhs_col.col_name);
+            auto [pos, inserted] = conds_cols_.emplace(cond.lhs_col.col_name, 1.0);
+            pos->second *= estimate_selectivity(cond);
         }
     }
     
@@ -62,6 +88,7 @@ IndexMeta Planner::get_index_cols(const std::string &tab_name, const std::vector
     // 初始化匹配结果
     size_t matched_index_number_ = SIZE_MAX;
     int max_match_col_count_ = 0;
+    double min_match_selectivity_ = 1.0;
     
     // 性能优化：使用索引遍历而非迭代器
     const auto& indexes = tab_->indexes;
@@ -69,13 +96,16 @@ IndexMeta Planner::get_index_cols(const std::string &tab_name, const std::vector
     {
         const auto& current_index = indexes[idx_number_];
         int match_col_num = 0;
+        double match_selectivity = 1.0;
         
         // 性能优化：提前退出循环和分支预测优化
         for (const auto& col : current_index.cols_)
         {
-            if (conds_cols_.count(col.name)) 
+            auto pos = conds_cols_.find(col.name);
+            if (pos != conds_cols_.end()) 
             {
                 ++match_col_num;
+                match_selectivity *= pos->second;
             }
             else
             {
@@ -84,10 +114,12 @@ IndexMeta Planner::get_index_cols(const std::string &tab_name, const std::vector
             }
         }
         
-        // 更新最佳匹配
-        if (match_col_num > max_match_col_count_) 
+        // 更新最佳匹配：匹配列数相同时选估计选择率更低的索引
+        if (match_col_num > max_match_col_count_ ||
+            (match_col_num > 0 && match_col_num == max_match_col_count_ && match_selectivity < min_match_selectivity_)) 
         {
             max_match_col_count_ = match_col_num;
+            min_match_selectivity_ = match_selectivity;
             matched_index_number_ = idx_number_;
         }
     }
@@ -117,6 +149,29 @@ bool Planner::get_merge_join_index(const std::string &tab_name, const TabCol &co
     return false;
 }
 
+IndexMeta Planner::get_join_index(const std::string &tab_name, const std::vector<std::string> &eq_cols) const
+{
+    auto tab_ = sm_manager_->db_.get_table(tab_name);
+    const IndexMeta *best = nullptr;
+    size_t best_prefix = 0;
+    for (const auto &index : tab_->indexes)
+    {
+        size_t prefix = 0;
+        while (prefix < index.cols_.size() &&
+               std::find(eq_cols.begin(), eq_cols.end(), index.cols_[prefix].name) != eq_cols.end())
+        {
+            ++prefix;
+        }
+        // 覆盖列数相同时选列数少的索引，更可能整键命中
+        if (prefix > best_prefix || (prefix > 0 && prefix == best_prefix && index.cols_.size() < best->cols_.size()))
+        {
+            best = &index;
+            best_prefix = prefix;
+        }
+    }
+    return best == nullptr ? IndexMeta{} : *best;
+}
+
 std::vector<Condition> pop_conds(std::vector<Condition> &conds, const std::string &tab_names)
 {
     std::vector<Condition> solved_conds;
@@ -143,84 +198,9 @@ std::vector<Condition> pop_conds(std::vector<Condition> &conds, const std::strin
     return solved_conds;
 }
 
-int push_conds(Condition *cond, const std::shared_ptr<Plan> &plan)
-{
-    // 性能优化：使用if-else链代替dynamic_pointer_cast避免RTTI开销
-    const auto plan_tag = plan->tag;
-    
-    if (plan_tag == T_SeqScan || plan_tag == T_IndexScan) 
-    {
-        // 直接转换为ScanPlan，避免dynamic_pointer_cast
-        auto x = static_cast<ScanPlan*>(plan.get());
-        if (x->tab_name_ == cond->lhs_col.tab_name) 
-        {
-            return 1;
-        }
-        else if (x->tab_name_ == cond->rhs_col.tab_name) 
-        {
-            return 2;
-        }
-        else
-        {
-            return 0;
-        }
-    }
-    else if (plan_tag == T_NestLoop || plan_tag == T_SortMerge) 
-    {
-        // 直接转换为JoinPlan
-        auto x = static_cast<JoinPlan*>(plan.get());
-        int left_res = push_conds(cond, x->left_);
-        // 条件已经下推到左子节点
-        if (left_res == 3) 
-        {
-            return 3;
-        }
-        int right_res = push_conds(cond, x->right_);
-        // 条件已经下推到右子节点
-        if (right_res == 3) 
-        {
-            return 3;
-        }
-        // 左子节点或右子节点有一个没有匹配到条件的列
-        if (left_res == 0 || right_res == 0) 
-        {
-            return left_res + right_res;
-        }
-        // 左子节点匹配到条件的右边
-        if (left_res == 2) 
-        {
-            // 性能优化：使用预计算的数组代替map查找
-            std::swap(cond->lhs_col, cond->rhs_col);
-            cond->op = SWAP_OP_MAP[cond->op];
-        }
-        x->conds_.emplace_back(std::move(*cond));
-        return 3;
-    }
-    return 0;
-}
-
-std::shared_ptr<Plan> pop_scan(int *scantbl, const std::string &table, std::vector<std::string> &joined_tables, const std::vector<std::shared_ptr<Plan>>& plans)
-{
-    // 性能优化：使用索引遍历避免迭代器开销
-    const size_t plans_size = plans.size();
-    for (size_t i = 0; i < plans_size; ++i)
-    {
-        // 性能优化：直接使用static_cast避免dynamic_pointer_cast
-        auto x = static_cast<ScanPlan*>(plans[i].get());
-        if (x->tab_name_ == table) 
-        {
-            scantbl[i] = 1;
-            joined_tables.emplace_back(x->tab_name_);
-            return plans[i];
-        }
-    }
-    return nullptr;
-}
-
 std::shared_ptr<Query> Planner::logical_optimization(std::shared_ptr<Query> query, Context *context)
 {
-    // TODO 实现逻辑优化规则
-
+    QueryRewriter::rewrite(*query);
     return query;
 }
 
@@ -232,10 +212,77 @@ std::shared_ptr<Plan> Planner::physical_optimization(const std::shared_ptr<Query
     plan = generate_agg_plan(query, std::move(plan));
     // 处理orderby
     plan = generate_sort_plan(query, std::move(plan));
+    plan = generate_limit_plan(query, std::move(plan));
 
     return plan;
 }
 
+double Planner::table_rows(const std::string &tab_name) const
+{
+    return static_cast<double>(sm_manager_->row_count(*sm_manager_->db_.get_table(tab_name)));
+}
+
+std::shared_ptr<const ColStats> Planner::get_col_stats(const TabCol &col) const
+{
+    auto tab = sm_manager_->db_.get_table(col.tab_name);
+    auto stats = sm_manager_->stats_.get(tab->fd_);
+    if (stats == nullptr)
+    {
+        return nullptr;
+    }
+    auto idx = static_cast<size_t>(tab->get_col(col.col_name).idx);
+    if (idx >= stats->cols.size())
+    {
+        return nullptr;
+    }
+    // 与整张表的统计共享所有权
+    return {stats, &stats->cols[idx]};
+}
+
+double Planner::estimate_selectivity(const Condition &cond) const
+{
+    if (cond.is_subquery)
+    {
+        return 0.5;
+    }
+    auto lhs = get_col_stats(cond.lhs_col);
+    if (!cond.is_rhs_val && cond.lhs_col.tab_name != cond.rhs_col.tab_name)
+    {
+        if (cond.op != OP_EQ)
+        {
+            return 1.0 / 3;
+        }
+        // 等值连接：有统计时按 1 / max(NDV)，否则按主外键假设 1 / max(|R|, |S|)
+        auto rhs = get_col_stats(cond.rhs_col);
+        if (lhs && rhs)
+        {
+            return 1.0 / std::max({lhs->ndv, rhs->ndv, 1.0});
+        }
+        return 1.0 / std::max({table_rows(cond.lhs_col.tab_name), table_rows(cond.rhs_col.tab_name), 1.0});
+    }
+    // 与常量比较：用直方图估计，参数未绑定或没有统计时按经验值
+    if (cond.is_rhs_val && lhs && cond.rhs_val.raw)
+    {
+        double v = StatsManager::to_number(cond.rhs_val.raw->data, cond.lhs);
+        double eq = lhs->eq_fraction(v);
+        double lt = lhs->lt_fraction(v);
+        switch (cond.op)
+        {
+        case OP_EQ:
+            return eq;
+        case OP_LT:
+            return lt;
+        case OP_LE:
+            return std::min(1.0, lt + eq);
+        case OP_GT:
+            return std::max(0.0, 1.0 - lt - eq);
+        case OP_GE:
+            return std::max(0.0, 1.0 - lt);
+        }
+    }
+    return cond.op == OP_EQ ? 0.1 : 1.0 / 3;
+}
+
 std::shared_ptr<Plan> Planner::make_one_rel(const std::shared_ptr<Query> &query, Context *context)
 {
     auto x = std::dynamic_pointer_cast<ast::SelectStmt>(query->parse);
@@ -245,17 +292,42 @@ std::shared_ptr<Plan> Planner::make_one_rel(const std::shared_ptr<Query> &query,
     // 性能优化：预分配向量大小，避免重复分配
     std::vector<std::shared_ptr<Plan>> table_scan_executors;
     table_scan_executors.reserve(table_count);
-    
+
+    // 每个叶子的代价估计，后面的连接枚举以此为起点
+    std::unordered_map<uint64_t, JoinRel> rels;
+    rels.reserve(table_count <= DP_JOIN_LIMIT ? (size_t{1} << table_count) : table_count * 2);
+    std::vector<double> base_rows(table_count);
+
     // Scan table，生成表算子列表tab_nodes
     for (size_t i = 0; i < table_count; ++i)
     {
         auto curr_conds = pop_conds(query->conds, tables[i]);
         auto index_meta = get_index_cols(tables[i], curr_conds);
-        
+
+        const double rows = table_rows(tables[i]);
+        base_rows[i] = rows;
+        JoinRel leaf;
+        leaf.rows = rows;
+        for (const auto &cond : curr_conds)
+        {
+            leaf.rows *= estimate_selectivity(cond);
+        }
+        leaf.rows = std::max(leaf.rows, 1.0);
+
         // 性能优化：减少条件分支，使用三元运算符
-        const auto scan_type = index_meta.cols_.empty() ? T_SeqScan : T_IndexScan;
+        auto scan_type = index_meta.cols_.empty() ? T_SeqScan : T_IndexScan;
+        leaf.cost = scan_type == T_SeqScan ? rows : leaf.rows + std::log2(rows + 1);
+        if (query->always_false)
+        {
+            scan_type = T_EmptyScan;
+            leaf.rows = 1;
+            leaf.cost = 0;
+        }
+        leaf.tag = scan_type;
+        rels.emplace(uint64_t{1} << i, leaf);
+
         table_scan_executors.emplace_back(
-            std::make_shared<ScanPlan>(scan_type, sm_manager_, tables[i], 
+            make_arena_shared<ScanPlan>(scan_type, sm_manager_, tables[i],
                                      std::move(curr_conds), std::move(index_meta))
         );
     }
@@ -265,123 +337,279 @@ std::shared_ptr<Plan> Planner::make_one_rel(const std::shared_ptr<Query> &query,
     {
         return table_scan_executors[0];
     }
-    // 获取where条件
+    if (!enable_nestedloop_join && !enable_sortmerge_join)
+    {
+        throw RMDBError();
+    }
+
+    // 剩下的条件都跨两张表，记录每个条件两侧所在的表
     auto &conds = query->conds;
-    std::shared_ptr<Plan> table_join_executors;
+    std::vector<std::pair<uint64_t, uint64_t>> cond_tabs;
+    std::vector<double> cond_sels;
+    cond_tabs.reserve(conds.size());
+    cond_sels.reserve(conds.size());
+    auto tab_bit = [&](const std::string &tab_name)
+    {
+        auto pos = std::find(tables.begin(), tables.end(), tab_name);
+        if (pos == tables.end())
+        {
+            throw RMDBError();
+        }
+        return uint64_t{1} << (pos - tables.begin());
+    };
+    for (const auto &cond : conds)
+    {
+        cond_tabs.emplace_back(tab_bit(cond.lhs_col.tab_name), tab_bit(cond.rhs_col.tab_name));
+        cond_sels.push_back(estimate_selectivity(cond));
+    }
 
-    // 性能优化：使用栈分配的数组代替动态分配
-    std::vector<int> scantbl(table_count, -1);
-    
-    if (!conds.empty()) 
+    // 排序归并的输入若已经按连接列有序（单表且可以走连接列上的索引），不需要额外排序
+    auto sort_cost = [&](uint64_t set, const TabCol &col)
     {
-        // 有连接条件
-        std::vector<std::string> joined_tables;
-        joined_tables.reserve(table_count);
-        
-        auto it = conds.begin();
-        while (it != conds.end())
-        {
-            auto left = pop_scan(scantbl.data(), it->lhs_col.tab_name, joined_tables, table_scan_executors);
-            auto right = pop_scan(scantbl.data(), it->rhs_col.tab_name, joined_tables, table_scan_executors);
-            std::vector<Condition> join_conds{*it};
-            
-            // 判断使用哪种join方式
-            if (enable_nestedloop_join || enable_sortmerge_join) 
-            {
-                TabCol left_col, right_col;
+        const auto &rel = rels.at(set);
+        if ((set & (set - 1)) == 0 && join_input_ordered(table_scan_executors[__builtin_ctzll(set)].get(), col))
+        {
+            return 0.0;
+        }
+        return rel.rows * std::log2(rel.rows + 2);
+    };
 
-                // 性能优化：直接访问AST节点，避免重复转换
-                left = generate_join_sort_plan(it->lhs_col.tab_name, conds, left_col, left);
-                if (x->has_sort && x->order->cols->col_name == left_col.col_name) 
-                {
-                    x->has_sort = false;
-                }
+    // right 为单表时，right 一侧可以用作索引探测的等值连接列（类型相同，且外表 CHAR 不比内表长）
+    auto probe_cols = [&](uint64_t left, uint64_t right)
+    {
+        std::vector<std::string> cols;
+        for (size_t i = 0; i < conds.size(); ++i)
+        {
+            const auto &cond = conds[i];
+            auto [lhs, rhs] = cond_tabs[i];
+            if (cond.op != OP_EQ || cond.lhs.type != cond.rhs.type)
+            {
+                continue;
+            }
+            if ((lhs & left) && rhs == right && cond.lhs.len <= cond.rhs.len)
+            {
+                cols.push_back(cond.rhs_col.col_name);
+            }
+            else if ((rhs & left) && lhs == right && cond.rhs.len <= cond.lhs.len)
+            {
+                cols.push_back(cond.lhs_col.col_name);
+            }
+        }
+        return cols;
+    };
 
-                right = generate_join_sort_plan(it->rhs_col.tab_name, conds, right_col, right);
-                if (x->has_sort && x->order->cols->col_name == right_col.col_name) 
+    // 估计 left ⋈ right 的输出行数，并在允许的连接算法中选代价最小的一种。
+    // 嵌套循环对左表每一行重新执行一次右子树，所以小表应在左侧；哈希连接用右子树建表，所以小表应在右侧；
+    // 右侧是单表且连接列上有索引时，索引嵌套循环对左表每一行只做一次索引查找
+    auto cost_join = [&](uint64_t left, uint64_t right)
+    {
+        const auto &l = rels.at(left);
+        const auto &r = rels.at(right);
+        JoinRel join;
+        join.left = left;
+        join.right = right;
+        double sel = 1.0;
+        for (size_t i = 0; i < conds.size(); ++i)
+        {
+            auto [lhs, rhs] = cond_tabs[i];
+            if (((lhs & left) && (rhs & right)) || ((lhs & right) && (rhs & left)))
+            {
+                sel *= cond_sels[i];
+                if (join.key < 0 && conds[i].op == OP_EQ && conds[i].lhs.type == conds[i].rhs.type)
                 {
-                    x->has_sort = false;
+                    join.key = static_cast<int>(i);
                 }
-                
-                // 性能优化：使用条件运算符减少分支
-                const auto join_type = (!left_col.empty() && !right_col.empty()) ? T_SortMerge : T_NestLoop;
-                table_join_executors = (join_type == T_SortMerge) ?
-                    std::make_shared<JoinPlan>(T_SortMerge, std::move(left), std::move(right),
-                                             join_conds, left_col, right_col, tables) :
-                    std::make_shared<JoinPlan>(T_NestLoop, std::move(left), std::move(right), join_conds);
             }
-            else
+        }
+        join.rows = std::max(l.rows * r.rows * sel, 1.0);
+
+        join.tag = T_NestLoop;
+        join.cost = l.cost + l.rows * r.cost + join.rows;
+        // 关闭嵌套循环表示强制排序归并，此时也不用哈希连接
+        if (enable_hash_join && enable_nestedloop_join && join.key >= 0)
+        {
+            double hash_cost = l.cost + r.cost + HASH_BUILD_FACTOR * r.rows + l.rows + join.rows;
+            if (hash_cost < join.cost)
             {
-                throw RMDBError();
+                join.tag = T_HashJoin;
+                join.cost = hash_cost;
             }
-
-            it = conds.erase(it);
-            break;
         }
-        
-        // 根据连接条件，生成第2-n层join
-        it = conds.begin();
-        while (it != conds.end())
-        {
-            std::shared_ptr<Plan> left_need_to_join_executors = nullptr;
-            std::shared_ptr<Plan> right_need_to_join_executors = nullptr;
-            bool isneedreverse = false;
-            
-            // 性能优化：使用find代替循环查找
-            if (std::find(joined_tables.begin(), joined_tables.end(), it->lhs_col.tab_name) == joined_tables.end()) 
+        if (enable_nestedloop_join && (right & (right - 1)) == 0)
+        {
+            const size_t inner = __builtin_ctzll(right);
+            if (!get_join_index(tables[inner], probe_cols(left, right)).cols_.empty())
             {
-                left_need_to_join_executors = pop_scan(scantbl.data(), it->lhs_col.tab_name, joined_tables, table_scan_executors);
+                double probe_cost = std::log2(base_rows[inner] + 2) + std::max(join.rows / l.rows, 1.0);
+                double index_cost = l.cost + l.rows * probe_cost + join.rows;
+                if (index_cost < join.cost)
+                {
+                    join.tag = T_IndexNestLoop;
+                    join.cost = index_cost;
+                }
             }
-            if (std::find(joined_tables.begin(), joined_tables.end(), it->rhs_col.tab_name) == joined_tables.end()) 
+        }
+        if (enable_sortmerge_join && join.key >= 0)
+        {
+            const auto &key = conds[join.key];
+            bool lhs_left = (cond_tabs[join.key].first & left) != 0;
+            double merge_cost = l.cost + r.cost + l.rows + r.rows + join.rows +
+                                sort_cost(left, lhs_left ? key.lhs_col : key.rhs_col) +
+                                sort_cost(right, lhs_left ? key.rhs_col : key.lhs_col);
+            // 只允许排序归并时，即使代价更高也必须选它
+            if (!enable_nestedloop_join || merge_cost < join.cost)
             {
-                right_need_to_join_executors = pop_scan(scantbl.data(), it->rhs_col.tab_name, joined_tables, table_scan_executors);
-                isneedreverse = true;
+                join.tag = T_SortMerge;
+                join.cost = merge_cost;
             }
+        }
+        return join;
+    };
 
-            if (left_need_to_join_executors && right_need_to_join_executors) 
+    auto relax = [&](uint64_t left, uint64_t right)
+    {
+        auto join = cost_join(left, right);
+        auto [pos, inserted] = rels.emplace(left | right, join);
+        if (!inserted && join.cost < pos->second.cost)
+        {
+            pos->second = join;
+        }
+    };
+
+    const uint64_t all = table_count >= 64 ? ~uint64_t{0} : (uint64_t{1} << table_count) - 1;
+    if (table_count <= DP_JOIN_LIMIT)
+    {
+        // 按集合从小到大做动态规划，表少时枚举所有浓密树，否则只枚举左深树
+        const bool bushy = table_count <= BUSHY_JOIN_LIMIT;
+        for (uint64_t set = 1; set <= all; ++set)
+        {
+            if ((set & (set - 1)) == 0)
             {
-                std::vector<Condition> join_conds{*it};
-                auto temp_join_executors = std::make_shared<JoinPlan>(T_NestLoop, 
-                    std::move(left_need_to_join_executors), std::move(right_need_to_join_executors), join_conds);
-                table_join_executors = std::make_shared<JoinPlan>(T_NestLoop, 
-                    std::move(temp_join_executors), std::move(table_join_executors), std::vector<Condition>());
+                continue;
             }
-            else if (left_need_to_join_executors || right_need_to_join_executors) 
+            for (uint64_t left = (set - 1) & set; left != 0; left = (left - 1) & set)
             {
-                if (isneedreverse) 
+                uint64_t right = set ^ left;
+                if (!bushy && (right & (right - 1)) != 0)
                 {
-                    std::swap(it->lhs_col, it->rhs_col);
-                    it->op = SWAP_OP_MAP[it->op];
-                    left_need_to_join_executors = std::move(right_need_to_join_executors);
+                    continue;
                 }
-                std::vector<Condition> join_conds{*it};
-                table_join_executors = std::make_shared<JoinPlan>(T_NestLoop, 
-                    std::move(left_need_to_join_executors), std::move(table_join_executors), join_conds);
-            }
-            else
-            {
-                push_conds(&(*it), table_join_executors);
+                relax(left, right);
             }
-            it = conds.erase(it);
         }
     }
     else
     {
-        table_join_executors = table_scan_executors[0];
-        scantbl[0] = 1;
+        // 表太多时贪心：每轮合并代价最小的一对
+        std::vector<uint64_t> sets;
+        for (size_t i = 0; i < table_count; ++i)
+        {
+            sets.push_back(uint64_t{1} << i);
+        }
+        while (sets.size() > 1)
+        {
+            size_t best_l = 0, best_r = 1;
+            JoinRel best;
+            best.cost = std::numeric_limits<double>::infinity();
+            for (size_t i = 0; i < sets.size(); ++i)
+            {
+                for (size_t j = 0; j < sets.size(); ++j)
+                {
+                    if (i == j)
+                    {
+                        continue;
+                    }
+                    auto join = cost_join(sets[i], sets[j]);
+                    if (join.cost < best.cost)
+                    {
+                        best = join;
+                        best_l = i;
+                        best_r = j;
+                    }
+                }
+            }
+            rels[best.left | best.right] = best;
+            sets[best_l] = best.left | best.right;
+            sets.erase(sets.begin() + best_r);
+        }
     }
 
-    // 连接剩余表
-    for (size_t i = 0; i < table_count; ++i)
+    // 按选出的连接树生成计划，每个条件挂到两侧表第一次相遇的连接上，并调整为左列在左子树
+    std::function<std::shared_ptr<Plan>(uint64_t)> build = [&](uint64_t set) -> std::shared_ptr<Plan>
     {
-        if (scantbl[i] == -1) 
+        if ((set & (set - 1)) == 0)
         {
-            table_join_executors = std::make_shared<JoinPlan>(T_NestLoop, 
-                std::move(table_scan_executors[i]), std::move(table_join_executors), std::vector<Condition>());
+            return std::move(table_scan_executors[__builtin_ctzll(set)]);
         }
-    }
+        const auto &rel = rels.at(set);
+        auto left = build(rel.left);
+        auto right = build(rel.right);
 
-    return table_join_executors;
+        std::vector<Condition> join_conds;
+        int key = -1;
+        for (size_t i = 0; i < conds.size(); ++i)
+        {
+            auto [lhs, rhs] = cond_tabs[i];
+            bool forward = (lhs & rel.left) && (rhs & rel.right);
+            if (!forward && !((lhs & rel.right) && (rhs & rel.left)))
+            {
+                continue;
+            }
+            Condition cond = conds[i];
+            if (!forward)
+            {
+                std::swap(cond.lhs_col, cond.rhs_col);
+                std::swap(cond.lhs, cond.rhs);
+                cond.op = SWAP_OP_MAP[cond.op];
+            }
+            cond.join_cond = true;
+            if (static_cast<int>(i) == rel.key)
+            {
+                key = static_cast<int>(join_conds.size());
+            }
+            join_conds.emplace_back(std::move(cond));
+        }
+
+        if (rel.tag == T_SortMerge)
+        {
+            TabCol left_col = join_conds[key].lhs_col;
+            TabCol right_col = join_conds[key].rhs_col;
+            left = generate_join_sort_plan(std::move(left), left_col);
+            right = generate_join_sort_plan(std::move(right), right_col);
+            return make_arena_shared<JoinPlan>(T_SortMerge, std::move(left), std::move(right),
+                                               std::move(join_conds), left_col, right_col, tables);
+        }
+        if (rel.tag == T_IndexNestLoop)
+        {
+            // 内表不再单独扫描，扫描计划只用来携带表名、过滤条件和探测用的索引
+            auto scan = std::static_pointer_cast<ScanPlan>(right);
+            scan->index_meta_ = get_join_index(scan->tab_name_, probe_cols(rel.left, rel.right));
+        }
+        auto join = make_arena_shared<JoinPlan>(rel.tag, std::move(left), std::move(right), std::move(join_conds));
+        if (rel.tag == T_HashJoin)
+        {
+            join->required_cols_ = query->required_cols;
+        }
+        return join;
+    };
+    auto plan = build(all);
+    conds.clear();
+
+    // 顶层排序归并的输出按连接列升序，ORDER BY 该列时不需要再排序
+    if (x->has_sort && plan->tag == T_SortMerge && x->order.size() == 1 && x->order[0]->orderby_dir != ast::OrderBy_DESC)
+    {
+        auto join = static_cast<JoinPlan *>(plan.get());
+        const auto &order_col = *x->order[0]->cols;
+        for (const auto &col : {join->left_join_col, join->right_join_col})
+        {
+            if (col.col_name == order_col.col_name && (order_col.tab_name.empty() || order_col.tab_name == col.tab_name))
+            {
+                x->has_sort = false;
+                break;
+            }
+        }
+    }
+    return plan;
 }
 
 std::shared_ptr<Plan> Planner::generate_agg_plan(const std::shared_ptr<Query> &query, std::shared_ptr<Plan> plan)
@@ -421,17 +649,67 @@ std::shared_ptr<Plan> Planner::generate_agg_plan(const std::shared_ptr<Query> &q
     }
 
     // 生成聚合计划
-    plan = std::make_shared<AggPlan>(T_Agg, std::move(plan), group_by_cols, agg_sel_cols);
+    auto agg = make_arena_shared<AggPlan>(T_Agg, std::move(plan), group_by_cols, agg_sel_cols);
+    if (group_by_cols.empty())
+    {
+        choose_minmax_index(*agg);
+    }
+    plan = std::move(agg);
 
     // 如果有 HAVING 子句，则生成 HAVING 计划
     if (x->group_by && !x->group_by->having_conds.empty())
     {
-        plan = std::make_shared<HavingPlan>(T_Having, std::move(plan), std::move(sel_cols), query->having_conds);
+        plan = make_arena_shared<HavingPlan>(T_Having, std::move(plan), std::move(sel_cols), query->having_conds);
     }
 
     return plan;
 }
 
+void Planner::choose_minmax_index(AggPlan &agg) const
+{
+    if (agg.subplan_->tag != T_SeqScan && agg.subplan_->tag != T_IndexScan)
+    {
+        return;
+    }
+    const auto &target = agg.sel_cols_.front();
+    for (const auto &col : agg.sel_cols_)
+    {
+        if ((col.aggFuncType != ast::MIN && col.aggFuncType != ast::MAX) || col.col_name != target.col_name)
+        {
+            return;
+        }
+    }
+
+    // 条件只能是其他列与同类型常量的等值比较，每列至多一个
+    auto scan = static_cast<ScanPlan *>(agg.subplan_.get());
+    auto tab = sm_manager_->db_.get_table(scan->tab_name_);
+    std::unordered_set<std::string> eq_cols;
+    for (const auto &cond : scan->conds_)
+    {
+        if (!cond.is_rhs_val || cond.is_subquery || cond.op != OP_EQ || cond.lhs_col.col_name == target.col_name ||
+            cond.rhs_val.type != tab->get_col(cond.lhs_col.col_name).type || !eq_cols.insert(cond.lhs_col.col_name).second)
+        {
+            return;
+        }
+    }
+
+    const size_t prefix = eq_cols.size();
+    for (const auto &index : tab->indexes)
+    {
+        if (index.cols_.size() <= prefix || index.cols_[prefix].name != target.col_name)
+        {
+            continue;
+        }
+        if (std::all_of(index.cols_.begin(), index.cols_.begin() + prefix, [&](const ColMeta &col)
+                        { return eq_cols.count(col.name) > 0; }))
+        {
+            agg.subplan_ = make_arena_shared<ScanPlan>(T_IndexScan, sm_manager_, scan->tab_name_, scan->conds_, index);
+            agg.from_index_ = true;
+            return;
+        }
+    }
+}
+
 std::shared_ptr<Plan> Planner::generate_sort_plan(const std::shared_ptr<Query> &query, std::shared_ptr<Plan> plan)
 {
     auto x = std::dynamic_pointer_cast<ast::SelectStmt>(query->parse);
@@ -440,77 +718,89 @@ std::shared_ptr<Plan> Planner::generate_sort_plan(const std::shared_ptr<Query> &
         return plan;
     }
     
-    const auto& tables = query->tables;
-    const size_t table_count = tables.size();
-    
-    // 性能优化：预分配vector容量，避免重复分配
     std::vector<ColMeta> all_cols;
-    size_t estimated_col_count = table_count * 10; // 估算每表平均10列
-    all_cols.reserve(estimated_col_count);
-    
-    for (const auto& sel_tab_name : tables)
+    for (const auto &sel_tab_name : query->tables)
     {
         const auto &sel_tab_cols = sm_manager_->db_.get_table(sel_tab_name)->cols;
         all_cols.insert(all_cols.end(), sel_tab_cols.begin(), sel_tab_cols.end());
     }
-    
-    TabCol sel_col;
-    const auto& target_col_name = x->order->cols->col_name;
-    
-    // 性能优化：使用基于范围的循环并早期退出
-    for (const auto &col : all_cols)
+
+    // 列名带表名时按表名和列名匹配，否则取第一个同名列
+    std::vector<SortKey> keys;
+    keys.reserve(x->order.size());
+    for (const auto &order : x->order)
     {
-        if (col.name == target_col_name) 
+        const auto &target = *order->cols;
+        auto it = std::find_if(all_cols.begin(), all_cols.end(), [&](const ColMeta &col)
+                               { return col.name == target.col_name && (target.tab_name.empty() || col.tab_name == target.tab_name); });
+        if (it == all_cols.end())
         {
-            sel_col = {.tab_name = col.tab_name, .col_name = col.name};
-            break;
+            throw RMDBError();
         }
+        keys.push_back({{.tab_name = it->tab_name, .col_name = it->name}, order->orderby_dir == ast::OrderBy_DESC});
     }
-    
-    return std::make_shared<SortPlan>(T_Sort, std::move(plan), sel_col, 
-                                    x->order->orderby_dir == ast::OrderBy_DESC);
+
+    // 单表按一列升序时可以改为按该列上的索引顺序扫描，省去排序
+    if (keys.size() == 1 && !keys[0].is_desc && join_input_ordered(plan.get(), keys[0].col))
+    {
+        return generate_join_sort_plan(std::move(plan), keys[0].col);
+    }
+    return make_arena_shared<SortPlan>(T_Sort, std::move(plan), std::move(keys));
 }
 
-std::shared_ptr<Plan>
-Planner::generate_join_sort_plan(const std::string &table, std::vector<Condition> &conds, TabCol &col, std::shared_ptr<Plan> plan)
+std::shared_ptr<Plan> Planner::generate_limit_plan(const std::shared_ptr<Query> &query, std::shared_ptr<Plan> plan)
 {
-    // 性能优化：使用基于范围的循环查找适合的条件列
-    for (auto &cond : conds)
+    auto x = std::dynamic_pointer_cast<ast::SelectStmt>(query->parse);
+    if (x->limit == nullptr)
     {
-        if (cond.is_rhs_val || cond.op != OP_EQ) 
-            continue;
-
-        if (cond.lhs_col.tab_name == table) 
-        {
-            col = cond.lhs_col;
-            cond.join_cond = true;
-            break;
-        }
-        else if (cond.rhs_col.tab_name == table) 
-        {
-            col = cond.rhs_col;
-            cond.join_cond = true;
-            break;
-        }
+        return plan;
+    }
+    size_t limit = static_cast<size_t>(x->limit->count);
+    size_t offset = static_cast<size_t>(x->limit->offset);
+    // 下层只需产生前 limit + offset 条，相加溢出时按不限条数处理
+    size_t need = limit > SIZE_MAX - offset ? SIZE_MAX : limit + offset;
+    // 只有排序和索引扫描的输出条数与上层需要的一一对应，其余算子（过滤、连接、聚合）不能提前截断
+    if (plan->tag == T_Sort)
+    {
+        static_cast<SortPlan *>(plan.get())->limit_ = need;
     }
+    else if (plan->tag == T_IndexScan)
+    {
+        static_cast<ScanPlan *>(plan.get())->limit_ = need;
+    }
+    return make_arena_shared<LimitPlan>(T_Limit, std::move(plan), limit, offset);
+}
 
-    // 如果没有找到合适的条件列或已经是索引扫描，直接返回原计划
-    if (col.empty() || plan->tag == T_IndexScan) 
-        return plan;
+bool Planner::join_input_ordered(const Plan *plan, const TabCol &col)
+{
+    if (plan->tag != T_SeqScan && plan->tag != T_IndexScan)
+    {
+        return false;
+    }
+    auto scan_plan = static_cast<const ScanPlan *>(plan);
+    if (plan->tag == T_IndexScan)
+    {
+        return scan_plan->index_meta_.cols_.front().name == col.col_name;
+    }
+    // 索引扫描不会过滤非索引列上的条件，带条件的顺序扫描不能改成按连接列的索引扫描
+    return scan_plan->conds_.empty() && get_merge_join_index(scan_plan->tab_name_, col);
+}
 
-    // 性能优化：直接转换而非dynamic_pointer_cast
-    auto scan_plan = static_cast<ScanPlan*>(plan.get());
-    bool exist_index = get_merge_join_index(scan_plan->tab_name_, col);
-    
-    if (exist_index)
+std::shared_ptr<Plan> Planner::generate_join_sort_plan(std::shared_ptr<Plan> plan, const TabCol &col)
+{
+    if (!join_input_ordered(plan.get(), col))
     {
-        std::vector<std::string> index_col_names = {col.col_name};
-        return std::make_shared<ScanPlan>(T_IndexScan, sm_manager_, scan_plan->tab_name_, 
-                                        scan_plan->conds_, index_col_names);
+        return make_arena_shared<SortPlan>(T_Sort, std::move(plan), std::vector<SortKey>{{col, false}});
     }
-    
-    // 否则，返回排序计划
-    return std::make_shared<SortPlan>(T_Sort, std::move(plan), col, false);
+    if (plan->tag == T_IndexScan)
+    {
+        return plan;
+    }
+    // 按连接列上的索引顺序扫描，省去排序
+    auto scan_plan = static_cast<ScanPlan *>(plan.get());
+    std::vector<std::string> index_col_names = {col.col_name};
+    return make_arena_shared<ScanPlan>(T_IndexScan, sm_manager_, scan_plan->tab_name_,
+                                    scan_plan->conds_, index_col_names);
 }
 
 std::shared_ptr<Plan> Planner::generate_select_plan(std::shared_ptr<Query> query, Context *context)
@@ -520,7 +810,7 @@ std::shared_ptr<Plan> Planner::generate_select_plan(std::shared_ptr<Query> query
     // 物理优化
     auto &sel_cols = query->cols;
     std::shared_ptr<Plan> plannerRoot = physical_optimization(query, context);
-    plannerRoot = std::make_shared<ProjectionPlan>(T_Projection, std::move(plannerRoot), std::move(sel_cols));
+    plannerRoot = make_arena_shared<ProjectionPlan>(T_Projection, std::move(plannerRoot), std::move(sel_cols));
 
     return plannerRoot;
 }
@@ -547,29 +837,29 @@ std::shared_ptr<Plan> Planner::do_planner(std::shared_ptr<Query> query, Context
                 throw RMDBError();
             }
         }
-        plannerRoot = std::make_shared<DDLPlan>(T_CreateTable, x->tab_name, std::vector<std::string>(), col_defs);
+        plannerRoot = make_arena_shared<DDLPlan>(T_CreateTable, x->tab_name, std::vector<std::string>(), col_defs);
     }
     else if (auto x = std::dynamic_pointer_cast<ast::DropTable>(query->parse))
     {
         // drop table;
-        plannerRoot = std::make_shared<DDLPlan>(T_DropTable, x->tab_name, std::vector<std::string>(),
+        plannerRoot = make_arena_shared<DDLPlan>(T_DropTable, x->tab_name, std::vector<std::string>(),
                                                 std::vector<ColDef>());
     }
     else if (auto x = std::dynamic_pointer_cast<ast::CreateIndex>(query->parse))
     {
         // create index;
-        plannerRoot = std::make_shared<DDLPlan>(T_CreateIndex, x->tab_name, x->col_names, std::vector<ColDef>());
+        plannerRoot = make_arena_shared<DDLPlan>(T_CreateIndex, x->tab_name, x->col_names, std::vector<ColDef>());
     }
     else if (auto x = std::dynamic_pointer_cast<ast::DropIndex>(query->parse))
     {
         // drop index
-        plannerRoot = std::make_shared<DDLPlan>(T_DropIndex, x->tab_name, x->col_names, std::vector<ColDef>());
+        plannerRoot = make_arena_shared<DDLPlan>(T_DropIndex, x->tab_name, x->col_names, std::vector<ColDef>());
     }
     else if (auto x = std::dynamic_pointer_cast<ast::InsertStmt>(query->parse))
     {
         // insert;
-        // plannerRoot = std::make_shared<DMLPlan>(T_Insert, std::shared_ptr<Plan>(), x->tab_name, query->values,
-        //                                         std::vector<Condition>(), std::vector<SetClause>());
+        plannerRoot = make_arena_shared<DMLPlan>(T_Insert, std::shared_ptr<Plan>(), x->tab_name, query->values,
+                                                std::vector<Condition>(), std::vector<SetClause>());
     }
     else if (auto x = std::dynamic_pointer_cast<ast::DeleteStmt>(query->parse))
     {
@@ -582,16 +872,16 @@ std::shared_ptr<Plan> Planner::do_planner(std::shared_ptr<Query> query, Context
 
         if (index_meta.cols_.empty() )
         { // 该表没有索引
-            table_scan_executors = std::make_shared<ScanPlan>(T_SeqScan, sm_manager_, x->tab_name, query->conds,
+            table_scan_executors = make_arena_shared<ScanPlan>(T_SeqScan, sm_manager_, x->tab_name, query->conds,
                                                               index_meta);
         }
         else
         { // 存在索引
-            table_scan_executors = std::make_shared<ScanPlan>(T_IndexScan, sm_manager_, x->tab_name, query->conds,
+            table_scan_executors = make_arena_shared<ScanPlan>(T_IndexScan, sm_manager_, x->tab_name, query->conds,
                                                               index_meta);
         }
 
-        plannerRoot = std::make_shared<DMLPlan>(T_Delete, table_scan_executors, x->tab_name, std::vector<Value>(),
+        plannerRoot = make_arena_shared<DMLPlan>(T_Delete, table_scan_executors, x->tab_name, std::vector<Value>(),
                                                 query->conds, std::vector<SetClause>());
     }
     else if (auto x = std::dynamic_pointer_cast<ast::UpdateStmt>(query->parse))
@@ -605,22 +895,22 @@ std::shared_ptr<Plan> Planner::do_planner(std::shared_ptr<Query> query, Context
 
         if (index_meta.cols_.empty())
         { // 该表没有索引
-            table_scan_executors = std::make_shared<ScanPlan>(T_SeqScan, sm_manager_, x->tab_name, query->conds, index_meta);
+            table_scan_executors = make_arena_shared<ScanPlan>(T_SeqScan, sm_manager_, x->tab_name, query->conds, index_meta);
         }
         else
         { // 存在索引
-            table_scan_executors = std::make_shared<ScanPlan>(T_IndexScan, sm_manager_, x->tab_name, query->conds, index_meta);
+            table_scan_executors = make_arena_shared<ScanPlan>(T_IndexScan, sm_manager_, x->tab_name, query->conds, index_meta);
         }
-        plannerRoot = std::make_shared<DMLPlan>(T_Update, table_scan_executors, x->tab_name, std::vector<Value>(),
+        plannerRoot = make_arena_shared<DMLPlan>(T_Update, table_scan_executors, x->tab_name, std::vector<Value>(),
                                                 query->conds, query->set_clauses);
     }
     else if (auto x = std::dynamic_pointer_cast<ast::SelectStmt>(query->parse))
     {
         // select
-        std::shared_ptr<plannerInfo> root = std::make_shared<plannerInfo>(x);
+        std::shared_ptr<plannerInfo> root = make_arena_shared<plannerInfo>(x);
         // 生成select语句的查询执行计划
         std::shared_ptr<Plan> projection = generate_select_plan(std::move(query), context);
-        plannerRoot = std::make_shared<DMLPlan>(T_select, projection, std::string(), std::vector<Value>(),
+        plannerRoot = make_arena_shared<DMLPlan>(T_select, projection, std::string(), std::vector<Value>(),
                                                 std::vector<Condition>(), std::vector<SetClause>());
     }
     else
@@ -18,8 +18,10 @@ class Planner
 private:
     SmManager *sm_manager_;
 
+    // 允许优化器使用的连接算法，都打开时按代价选择
     bool enable_nestedloop_join = true;
-    bool enable_sortmerge_join = false;
+    bool enable_sortmerge_join = true;
+    bool enable_hash_join = true;
 
 public:
     Planner(SmManager *sm_manager) : sm_manager_(sm_manager) {}
@@ -36,6 +38,11 @@ public:
         enable_sortmerge_join = set_val;
     }
 
+    void set_enable_hash_join(bool set_val)
+    {
+        enable_hash_join = set_val;
+    }
+
 private:
     std::shared_ptr<Query> logical_optimization(std::shared_ptr<Query> query, Context *context);
     std::shared_ptr<Plan> physical_optimization(const std::shared_ptr<Query> &query, Context *context);
@@ -44,12 +51,22 @@ private:
 
     std::shared_ptr<Plan> generate_sort_plan(const std::shared_ptr<Query> &query, std::shared_ptr<Plan> plan);
 
+    // LIMIT 放在投影之下，并把需要的行数下推给排序和索引扫描
+    static std::shared_ptr<Plan> generate_limit_plan(const std::shared_ptr<Query> &query, std::shared_ptr<Plan> plan);
+
     std::shared_ptr<Plan> generate_select_plan(std::shared_ptr<Query> query, Context *context);
 
-    static std::shared_ptr<Plan> generate_agg_plan(const std::shared_ptr<Query> &query, std::shared_ptr<Plan> plan);
+    std::shared_ptr<Plan> generate_agg_plan(const std::shared_ptr<Query> &query, std::shared_ptr<Plan> plan);
+
+    // 单表上只有 MIN/MAX 的标量聚合：聚合列是某个索引的第一列，或紧跟在由等值条件确定的索引前缀之后时，
+    // 子计划换成这个索引上的扫描，执行时只取区间两端
+    void choose_minmax_index(AggPlan &agg) const;
 
     IndexMeta get_index_cols(const std::string &tab_name, const std::vector<Condition> &curr_conds) const;
 
+    // 内表上可以按连接列逐行探测的索引：索引前缀的列都有等值连接条件，取覆盖列数最多的一个
+    IndexMeta get_join_index(const std::string &tab_name, const std::vector<std::string> &eq_cols) const;
+
     // 性能优化：使用内联函数和constexpr，避免map查找
     constexpr ColType interp_sv_type(ast::SvType sv_type) noexcept
     {
@@ -61,7 +78,20 @@ private:
             default: return TYPE_STRING; // 默认情况
         }
     }
-    std::shared_ptr<Plan> generate_join_sort_plan(const std::string &table, std::vector<Condition> &conds, TabCol &col, std::shared_ptr<Plan> plan);
+    // 表的当前行数，用于基数估计
+    double table_rows(const std::string &tab_name) const;
+
+    // 列的统计信息，表没有收集过统计时为空
+    std::shared_ptr<const ColStats> get_col_stats(const TabCol &col) const;
+
+    // 估计单个条件的选择率，有 ANALYZE 收集的统计时按直方图和不同值个数估计
+    double estimate_selectivity(const Condition &cond) const;
+
+    // 排序归并的输入是否已经（或可以通过索引扫描）按 col 有序
+    bool join_input_ordered(const Plan *plan, const TabCol &col);
+
+    // 为排序归并的一侧生成按 col 有序的输入
+    std::shared_ptr<Plan> generate_join_sort_plan(std::shared_ptr<Plan> plan, const TabCol &col);
 
     bool get_merge_join_index(const std::string &tab_name, const TabCol &col);
 };
@@ -0,0 +1,439 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "analyze/analyze_finals.h"
+
+// 逻辑优化：在选择连接顺序之前按规则改写 WHERE 条件，每条规则都是独立的静态函数，可以单独调用。
+// 依赖字面量取值的规则（类型折叠、区间合并）得到的计划只对当前字面量成立，
+// 它们删掉或改写的条件不再完整指向 Query::params，计划缓存发现参数覆盖不全就不会缓存这个计划；
+// PREPARE 语句的参数在执行时才知道，不做这类改写
+class QueryRewriter
+{
+public:
+    // 依次应用所有规则，WHERE 恒假时设置 query.always_false
+    static void rewrite(Query &query)
+    {
+        bool literal_rules = !query.prepared;
+        bool satisfiable = fold_constants(query.conds, query.params, literal_rules);
+        if (satisfiable)
+        {
+            infer_transitive(query.conds);
+            remove_redundant(query.conds);
+            if (literal_rules)
+            {
+                satisfiable = merge_ranges(query.conds);
+            }
+        }
+        query.always_false = !satisfiable;
+        query.required_cols = required_columns(query);
+    }
+
+    // 常量折叠：同一列与自身比较时 =、<=、>= 恒真直接删除，<、> 恒假；
+    // literal_rules 时按 params 中转换前的字面量处理跨类型比较：INT 列与 FLOAT 字面量折叠成等价的整数比较
+    // （a > 2.5 即 a > 2，不可能相等的 = 恒假），FLOAT 列与 INT 字面量按浮点数重新生成 raw。
+    // 返回 false 表示条件恒假
+    static bool fold_constants(std::vector<Condition> &conds, const std::vector<Value> &params, bool literal_rules)
+    {
+        for (size_t i = 0; i < conds.size();)
+        {
+            auto &cond = conds[i];
+            if (cond.is_subquery)
+            {
+                i++;
+                continue;
+            }
+            if (!cond.is_rhs_val && same_col(cond.lhs_col, cond.rhs_col))
+            {
+                if (cond.op == OP_LT || cond.op == OP_GT)
+                {
+                    return false;
+                }
+                conds.erase(conds.begin() + static_cast<long>(i));
+                continue;
+            }
+            if (!literal_rules || !cond.is_rhs_val || cond.param_idx < 0 || static_cast<size_t>(cond.param_idx) >= params.size())
+            {
+                i++;
+                continue;
+            }
+            const auto &literal = params[cond.param_idx];
+            if (cond.lhs.type == TYPE_FLOAT && literal.type == TYPE_INT)
+            {
+                cond.rhs_val.set_float(static_cast<float>(literal.int_val));
+                cond.rhs_val.init_raw(cond.lhs.len);
+                cond.param_idx = -1;
+            }
+            else if (cond.lhs.type == TYPE_INT && literal.type == TYPE_FLOAT)
+            {
+                double v = literal.float_val;
+                double n;
+                switch (cond.op)
+                {
+                case OP_EQ:
+                    if (v != std::floor(v))
+                    {
+                        return false;
+                    }
+                    n = v;
+                    break;
+                case OP_LT:
+                case OP_GE:
+                    n = std::ceil(v);
+                    break;
+                default:
+                    n = std::floor(v);
+                    break;
+                }
+                // 超出 INT 范围时比较结果与列值无关
+                if (n < std::numeric_limits<int>::min() || n > std::numeric_limits<int>::max())
+                {
+                    bool below = n < 0;
+                    bool always_true = (cond.op == OP_LT || cond.op == OP_LE) ? !below : (cond.op != OP_EQ && below);
+                    if (!always_true)
+                    {
+                        return false;
+                    }
+                    conds.erase(conds.begin() + static_cast<long>(i));
+                    continue;
+                }
+                cond.rhs_val.set_int(static_cast<int>(n));
+                cond.rhs_val.init_raw(cond.lhs.len);
+                cond.param_idx = -1;
+            }
+            i++;
+        }
+        return true;
+    }
+
+    // 传递闭包：按列间等值条件划分等价类，某列上的字面量条件复制到同一等价类的其他列上，
+    // 让每张表在连接前就能用上这些过滤条件和索引。复制的条件保留 param_idx，计划缓存可以重新绑定
+    static void infer_transitive(std::vector<Condition> &conds)
+    {
+        std::vector<ColMeta> members;
+        std::vector<size_t> parent;
+        auto find = [&](size_t x)
+        {
+            while (parent[x] != x)
+            {
+                x = parent[x] = parent[parent[x]];
+            }
+            return x;
+        };
+        auto member = [&](const TabCol &col, const ColMeta &meta)
+        {
+            for (size_t i = 0; i < members.size(); i++)
+            {
+                if (members[i].tab_name == col.tab_name && members[i].name == col.col_name)
+                {
+                    return i;
+                }
+            }
+            members.push_back(meta);
+            parent.push_back(parent.size());
+            return members.size() - 1;
+        };
+        for (auto &cond : conds)
+        {
+            if (!cond.is_rhs_val && !cond.is_subquery && cond.op == OP_EQ && cond.lhs.type == cond.rhs.type)
+            {
+                size_t a = member(cond.lhs_col, cond.lhs);
+                size_t b = member(cond.rhs_col, cond.rhs);
+                parent[find(a)] = find(b);
+            }
+        }
+        if (members.empty())
+        {
+            return;
+        }
+
+        size_t n = conds.size();
+        for (size_t i = 0; i < n; i++)
+        {
+            if (!conds[i].is_rhs_val || conds[i].is_subquery)
+            {
+                continue;
+            }
+            auto it = std::find_if(members.begin(), members.end(), [&](const ColMeta &col)
+                                   { return col.tab_name == conds[i].lhs_col.tab_name && col.name == conds[i].lhs_col.col_name; });
+            if (it == members.end())
+            {
+                continue;
+            }
+            size_t root = find(static_cast<size_t>(it - members.begin()));
+            for (size_t m = 0; m < members.size(); m++)
+            {
+                const auto &col = members[m];
+                // 定长不同的 CHAR 列之间不复制，字面量的 raw 按列长生成
+                if (find(m) != root || &col == &*it || col.type != conds[i].lhs.type || col.len != conds[i].lhs.len)
+                {
+                    continue;
+                }
+                Condition copy = conds[i];
+                copy.lhs_col = {.tab_name = col.tab_name, .col_name = col.name};
+                copy.lhs = col;
+                bool exists = std::any_of(conds.begin(), conds.end(), [&](const Condition &cond)
+                                          { return cond.is_rhs_val && !cond.is_subquery && same_col(cond.lhs_col, copy.lhs_col) && cond.op == copy.op && cond.param_idx == copy.param_idx && (copy.param_idx >= 0 || compare_value(cond.rhs_val, copy.rhs_val) == 0); });
+                if (!exists)
+                {
+                    conds.push_back(std::move(copy));
+                }
+            }
+        }
+    }
+
+    // 删除重复的列间条件，a = b 与 b = a、a < b 与 b > a 视为同一条件
+    static void remove_redundant(std::vector<Condition> &conds)
+    {
+        std::vector<Condition> kept;
+        kept.reserve(conds.size());
+        for (auto &cond : conds)
+        {
+            if (!cond.is_rhs_val && !cond.is_subquery)
+            {
+                bool duplicate = std::any_of(kept.begin(), kept.end(), [&](const Condition &other)
+                                             { return !other.is_rhs_val && !other.is_subquery &&
+                                                      ((same_col(other.lhs_col, cond.lhs_col) && same_col(other.rhs_col, cond.rhs_col) && other.op == cond.op) ||
+                                                       (same_col(other.lhs_col, cond.rhs_col) && same_col(other.rhs_col, cond.lhs_col) && other.op == swap_op(cond.op))); });
+                if (duplicate)
+                {
+                    continue;
+                }
+            }
+            kept.push_back(std::move(cond));
+        }
+        conds = std::move(kept);
+    }
+
+    // 区间合并：同一列上的字面量条件只保留最紧的下界和上界，上下界相等且都闭合时合并成 =，
+    // 有 = 时检查它是否满足其他条件后只保留 =。返回 false 表示某列的取值区间为空
+    static bool merge_ranges(std::vector<Condition> &conds)
+    {
+        std::vector<bool> removed(conds.size(), false);
+        for (size_t i = 0; i < conds.size(); i++)
+        {
+            if (removed[i] || !range_cond(conds[i]))
+            {
+                continue;
+            }
+            std::vector<size_t> group;
+            for (size_t j = i; j < conds.size(); j++)
+            {
+                if (!removed[j] && range_cond(conds[j]) && same_col(conds[i].lhs_col, conds[j].lhs_col))
+                {
+                    group.push_back(j);
+                }
+            }
+            if (group.size() == 1)
+            {
+                continue;
+            }
+
+            int eq = -1, lower = -1, upper = -1;
+            for (size_t j : group)
+            {
+                auto &cond = conds[j];
+                switch (cond.op)
+                {
+                case OP_EQ:
+                    if (eq < 0)
+                    {
+                        eq = static_cast<int>(j);
+                    }
+                    break;
+                case OP_GT:
+                case OP_GE:
+                    if (lower < 0 || tighter(cond, conds[lower], 1))
+                    {
+                        lower = static_cast<int>(j);
+                    }
+                    break;
+                default:
+                    if (upper < 0 || tighter(cond, conds[upper], -1))
+                    {
+                        upper = static_cast<int>(j);
+                    }
+                    break;
+                }
+            }
+
+            if (eq >= 0)
+            {
+                for (size_t j : group)
+                {
+                    if (!holds(conds[eq].rhs_val, conds[j]))
+                    {
+                        return false;
+                    }
+                }
+            }
+            else if (lower >= 0 && upper >= 0)
+            {
+                int c = compare_value(conds[lower].rhs_val, conds[upper].rhs_val);
+                if (c > 0)
+                {
+                    return false;
+                }
+                if (c == 0)
+                {
+                    if (conds[lower].op != OP_GE || conds[upper].op != OP_LE)
+                    {
+                        return false;
+                    }
+                    conds[lower].op = OP_EQ;
+                    conds[lower].param_idx = -1;
+                    eq = lower;
+                }
+            }
+            for (size_t j : group)
+            {
+                int idx = static_cast<int>(j);
+                removed[j] = eq >= 0 ? idx != eq : idx != lower && idx != upper;
+            }
+        }
+
+        size_t n = 0;
+        for (size_t i = 0; i < conds.size(); i++)
+        {
+            if (removed[i])
+            {
+                continue;
+            }
+            if (n != i)
+            {
+                conds[n] = std::move(conds[i]);
+            }
+            n++;
+        }
+        conds.resize(n);
+        return true;
+    }
+
+    // 计划需要读取的列：投影列、WHERE/HAVING 涉及的列、GROUP BY 列和 ORDER BY 列。
+    // 表名为空的列（多表查询里的 GROUP BY、ORDER BY）按列名匹配任意表
+    static std::vector<TabCol> required_columns(const Query &query)
+    {
+        std::vector<TabCol> cols;
+        auto add = [&](const std::string &tab_name, const std::string &col_name)
+        {
+            if (col_name.empty() || col_name == "*")
+            {
+                return;
+            }
+            bool exists = std::any_of(cols.begin(), cols.end(), [&](const TabCol &col)
+                                      { return col.tab_name == tab_name && col.col_name == col_name; });
+            if (!exists)
+            {
+                cols.push_back({.tab_name = tab_name, .col_name = col_name});
+            }
+        };
+        for (auto &col : query.cols)
+        {
+            add(col.tab_name, col.col_name);
+        }
+        for (auto &cond : query.conds)
+        {
+            add(cond.lhs_col.tab_name, cond.lhs_col.col_name);
+            if (!cond.is_rhs_val && !cond.is_subquery)
+            {
+                add(cond.rhs_col.tab_name, cond.rhs_col.col_name);
+            }
+        }
+        for (auto &cond : query.having_conds)
+        {
+            add(cond.lhs_col.tab_name, cond.lhs_col.col_name);
+        }
+        if (auto x = std::dynamic_pointer_cast<ast::SelectStmt>(query.parse))
+        {
+            if (x->group_by)
+            {
+                for (auto &col : x->group_by->cols)
+                {
+                    add(col->tab_name, col->col_name);
+                }
+            }
+            if (x->has_sort)
+            {
+                for (auto &order : x->order)
+                {
+                    add(std::string(), order->cols->col_name);
+                }
+            }
+        }
+        return cols;
+    }
+
+private:
+    static bool same_col(const TabCol &a, const TabCol &b)
+    {
+        return a.tab_name == b.tab_name && a.col_name == b.col_name;
+    }
+
+    static CompOp swap_op(CompOp op)
+    {
+        switch (op)
+        {
+        case OP_LT:
+            return OP_GT;
+        case OP_GT:
+            return OP_LT;
+        case OP_LE:
+            return OP_GE;
+        case OP_GE:
+            return OP_LE;
+        default:
+            return op;
+        }
+    }
+
+    // 可以参与区间合并的条件：右边是与列同类型的字面量
+    static bool range_cond(const Condition &cond)
+    {
+        return cond.is_rhs_val && !cond.is_subquery && cond.rhs_val.type == cond.lhs.type;
+    }
+
+    static int compare_value(const Value &a, const Value &b)
+    {
+        switch (a.type)
+        {
+        case TYPE_INT:
+            return (a.int_val > b.int_val) - (a.int_val < b.int_val);
+        case TYPE_FLOAT:
+            return (a.float_val > b.float_val) - (a.float_val < b.float_val);
+        default:
+        {
+            int c = a.str_val.compare(b.str_val);
+            return (c > 0) - (c < 0);
+        }
+        }
+    }
+
+    // 同方向的两个边界中 a 是否比 b 更紧，dir 为 1 表示下界、-1 表示上界；值相同时开区间更紧
+    static bool tighter(const Condition &a, const Condition &b, int dir)
+    {
+        int c = compare_value(a.rhs_val, b.rhs_val) * dir;
+        return c > 0 || (c == 0 && (a.op == OP_GT || a.op == OP_LT) && b.op != a.op);
+    }
+
+    static bool holds(const Value &v, const Condition &cond)
+    {
+        int c = compare_value(v, cond.rhs_val);
+        switch (cond.op)
+        {
+        case OP_EQ:
+            return c == 0;
+        case OP_LT:
+            return c < 0;
+        case OP_GT:
+            return c > 0;
+        case OP_LE:
+            return c <= 0;
+        default:
+            return c >= 0;
+        }
+    }
+};
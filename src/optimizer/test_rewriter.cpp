@@ -0,0 +1,139 @@
+#undef NDEBUG
+
+#include <cassert>
+#include <iostream>
+
+#include "rewriter_finals.h"
+
+// 逐条验证 QueryRewriter 的改写规则，条件直接手工构造，不需要建库
+
+static ColMeta make_col(const std::string &tab_name, const std::string &name, ColType type)
+{
+    ColMeta col;
+    col.tab_name = tab_name;
+    col.name = name;
+    col.type = type;
+    col.len = type == TYPE_STRING ? 8 : 4;
+    col.offset = 0;
+    return col;
+}
+
+static Condition lit_cond(const ColMeta &col, CompOp op, int val, int param_idx)
+{
+    Condition cond;
+    cond.lhs_col = {.tab_name = col.tab_name, .col_name = col.name};
+    cond.lhs = col;
+    cond.op = op;
+    cond.is_rhs_val = true;
+    cond.rhs_val.set_int(val);
+    cond.rhs_val.init_raw(col.len);
+    cond.param_idx = param_idx;
+    return cond;
+}
+
+static Condition col_cond(const ColMeta &lhs, CompOp op, const ColMeta &rhs)
+{
+    Condition cond;
+    cond.lhs_col = {.tab_name = lhs.tab_name, .col_name = lhs.name};
+    cond.lhs = lhs;
+    cond.op = op;
+    cond.is_rhs_val = false;
+    cond.rhs_col = {.tab_name = rhs.tab_name, .col_name = rhs.name};
+    cond.rhs = rhs;
+    return cond;
+}
+
+static const ColMeta a_id = make_col("a", "id", TYPE_INT);
+static const ColMeta b_aid = make_col("b", "aid", TYPE_INT);
+
+static void test_fold_constants()
+{
+    // a.id = a.id 恒真
+    std::vector<Condition> conds = {col_cond(a_id, OP_EQ, a_id), lit_cond(a_id, OP_GT, 1, 0)};
+    std::vector<Value> params(1);
+    params[0].set_int(1);
+    assert(QueryRewriter::fold_constants(conds, params, true));
+    assert(conds.size() == 1 && conds[0].is_rhs_val);
+
+    // a.id < a.id 恒假
+    conds = {col_cond(a_id, OP_LT, a_id)};
+    assert(!QueryRewriter::fold_constants(conds, params, true));
+
+    // a.id > 2.5 折叠为 a.id > 2，a.id = 2.5 恒假
+    params[0].set_float(2.5);
+    conds = {lit_cond(a_id, OP_GT, 2, 0)};
+    assert(QueryRewriter::fold_constants(conds, params, true));
+    assert(conds[0].rhs_val.int_val == 2 && conds[0].param_idx == -1);
+    conds = {lit_cond(a_id, OP_GE, 2, 0)};
+    assert(QueryRewriter::fold_constants(conds, params, true));
+    assert(conds[0].rhs_val.int_val == 3);
+    conds = {lit_cond(a_id, OP_EQ, 2, 0)};
+    assert(!QueryRewriter::fold_constants(conds, params, true));
+    // PREPARE 中不依赖字面量
+    conds = {lit_cond(a_id, OP_EQ, 2, 0)};
+    assert(QueryRewriter::fold_constants(conds, params, false));
+}
+
+static void test_infer_transitive()
+{
+    std::vector<Condition> conds = {col_cond(a_id, OP_EQ, b_aid), lit_cond(a_id, OP_LT, 3, 0)};
+    QueryRewriter::infer_transitive(conds);
+    assert(conds.size() == 3);
+    assert(conds[2].lhs_col.tab_name == "b" && conds[2].op == OP_LT && conds[2].param_idx == 0);
+    // 已经存在的条件不重复推导
+    QueryRewriter::infer_transitive(conds);
+    assert(conds.size() == 3);
+}
+
+static void test_remove_redundant()
+{
+    std::vector<Condition> conds = {col_cond(a_id, OP_EQ, b_aid), col_cond(b_aid, OP_EQ, a_id), col_cond(a_id, OP_LT, b_aid), col_cond(b_aid, OP_GT, a_id)};
+    QueryRewriter::remove_redundant(conds);
+    assert(conds.size() == 2);
+}
+
+static void test_merge_ranges()
+{
+    // a.id > 1 and a.id > 2 and a.id < 4 and a.id <= 10 只剩 a.id > 2 and a.id < 4
+    std::vector<Condition> conds = {lit_cond(a_id, OP_GT, 1, 0), lit_cond(a_id, OP_GT, 2, 1), lit_cond(a_id, OP_LT, 4, 2), lit_cond(a_id, OP_LE, 10, 3)};
+    assert(QueryRewriter::merge_ranges(conds));
+    assert(conds.size() == 2 && conds[0].param_idx == 1 && conds[1].param_idx == 2);
+
+    // a.id >= 2 and a.id <= 2 合并为 a.id = 2
+    conds = {lit_cond(a_id, OP_GE, 2, 0), lit_cond(a_id, OP_LE, 2, 1)};
+    assert(QueryRewriter::merge_ranges(conds));
+    assert(conds.size() == 1 && conds[0].op == OP_EQ && conds[0].param_idx == -1);
+
+    // 空区间
+    conds = {lit_cond(a_id, OP_GT, 5, 0), lit_cond(a_id, OP_LT, 3, 1)};
+    assert(!QueryRewriter::merge_ranges(conds));
+    conds = {lit_cond(a_id, OP_GT, 2, 0), lit_cond(a_id, OP_LT, 2, 1)};
+    assert(!QueryRewriter::merge_ranges(conds));
+    conds = {lit_cond(a_id, OP_EQ, 2, 0), lit_cond(a_id, OP_GT, 3, 1)};
+    assert(!QueryRewriter::merge_ranges(conds));
+
+    // 不同列互不影响
+    conds = {lit_cond(a_id, OP_GT, 5, 0), lit_cond(b_aid, OP_LT, 3, 1)};
+    assert(QueryRewriter::merge_ranges(conds));
+    assert(conds.size() == 2);
+}
+
+static void test_required_columns()
+{
+    Query query;
+    query.cols = {{.tab_name = "a", .col_name = "id"}};
+    query.conds = {col_cond(a_id, OP_EQ, b_aid)};
+    auto cols = QueryRewriter::required_columns(query);
+    assert(cols.size() == 2 && cols[1].tab_name == "b" && cols[1].col_name == "aid");
+}
+
+int main()
+{
+    test_fold_constants();
+    test_infer_transitive();
+    test_remove_redundant();
+    test_merge_ranges();
+    test_required_columns();
+    std::cout << "all rewriter tests passed" << std::endl;
+    return 0;
+}
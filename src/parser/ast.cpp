@@ -1,8 +0,0 @@
-
-#include "ast.h"
-
-namespace ast
-{
-
-    thread_local std::shared_ptr<TreeNode> parse_tree;
-}
@@ -49,7 +49,9 @@ namespace ast
     enum SetKnobType
     {
         EnableNestLoop,
-        EnableSortMerge
+        EnableSortMerge,
+        EnableHashJoin,
+        ParallelDegree
     };
 
 enum TreeNodeType
@@ -76,12 +78,14 @@ enum TreeNodeType
     FloatLitNode,
     StringLitNode,
     BoolLitNode,
+    ParamLitNode,
     ColNode,
     AggFuncNode,
     SetClauseNode,
     BinaryExprNode,
     SubQueryExprNode,
     OrderByNode,
+    LimitNode,
     CreateStaticCheckpointNode,
     CrashStmtNode,
     HavingCauseNode,
@@ -93,6 +97,9 @@ enum TreeNodeType
     SelectStmtNode,
     SetStmtNode,
     LoadStmtNode,
+    PrepareStmtNode,
+    ExecuteStmtNode,
+    AnalyzeStmtNode,
 
     UNKNOWN
 };
@@ -186,6 +193,14 @@ enum TreeNodeType
         DescIndex(std::string tab_name_) : tab_name(std::move(tab_name_)) { type = DescIndexNode; }
     };
 
+    // ANALYZE [table]，tab_name 为空表示所有表
+    struct AnalyzeStmt : public TreeNode
+    {
+        std::string tab_name;
+
+        AnalyzeStmt(std::string tab_name_) : tab_name(std::move(tab_name_)) { type = AnalyzeStmtNode; }
+    };
+
     struct CreateIndex : public TreeNode
     {
         std::string tab_name;
@@ -246,6 +261,12 @@ enum TreeNodeType
         BoolLit(bool val_) : val(val_) { type = BoolLitNode; }
     };
 
+    // PREPARE 语句中的 '?' 参数，类型由与之比较或赋值的列决定
+    struct ParamLit : public Value
+    {
+        ParamLit() { type = ParamLitNode; }
+    };
+
     struct Col : public Expr
     {
         std::string tab_name;
@@ -315,6 +336,7 @@ enum TreeNodeType
         SubQueryExpr(std::shared_ptr<Col> lhs_, SvCompOp op_, std::vector<std::shared_ptr<Value>> rhs_) : BinaryExpr(std::move(lhs_), op_, nullptr), vals(std::move(rhs_)) { TreeNode::type = SubQueryExprNode; }
     };
 
+    // ORDER BY 中的一列
     struct OrderBy : public TreeNode
     {
         std::shared_ptr<Col> cols;
@@ -323,6 +345,15 @@ enum TreeNodeType
         OrderBy(std::shared_ptr<Col> cols_, OrderByDir orderby_dir_) : cols(std::move(cols_)), orderby_dir(orderby_dir_) { type = OrderByNode; }
     };
 
+    // LIMIT count [OFFSET offset]
+    struct Limit : public TreeNode
+    {
+        int count;
+        int offset;
+
+        Limit(int count_, int offset_) : count(count_), offset(offset_) { type = LimitNode; }
+    };
+
     struct CreateStaticCheckpoint : public TreeNode
     {
     public:
@@ -361,9 +392,9 @@ enum TreeNodeType
     struct InsertStmt : public TreeNode
     {
         std::string tab_name;
-        std::vector<std::shared_ptr<Value>> vals;
+        std::vector<std::vector<std::shared_ptr<Value>>> rows; // VALUES 后的每一行
 
-        InsertStmt(std::string tab_name_, std::vector<std::shared_ptr<Value>> vals_) : tab_name(std::move(tab_name_)), vals(std::move(vals_)) { type = InsertStmtNode; }
+        InsertStmt(std::string tab_name_, std::vector<std::vector<std::shared_ptr<Value>>> rows_) : tab_name(std::move(tab_name_)), rows(std::move(rows_)) { type = InsertStmtNode; }
     };
 
     struct DeleteStmt : public TreeNode
@@ -404,23 +435,26 @@ enum TreeNodeType
         std::shared_ptr<GroupBy> group_by;
 
         bool has_sort;
-        std::shared_ptr<OrderBy> order;
+        std::vector<std::shared_ptr<OrderBy>> order; // 按顺序的各排序列
+
+        std::shared_ptr<Limit> limit; // 没有 LIMIT 时为空
 
-        SelectStmt(std::vector<std::shared_ptr<Col>> cols_, std::vector<std::string> tabs_, std::vector<std::shared_ptr<BinaryExpr>> conds_, std::shared_ptr<GroupBy> group_by_, std::shared_ptr<OrderBy> order_) : cols(std::move(cols_)), tabs(std::move(tabs_)), conds(std::move(conds_)), group_by(std::move(group_by_)), order(std::move(order_))
+        SelectStmt(std::vector<std::shared_ptr<Col>> cols_, std::vector<std::string> tabs_, std::vector<std::shared_ptr<BinaryExpr>> conds_, std::shared_ptr<GroupBy> group_by_, std::vector<std::shared_ptr<OrderBy>> order_, std::shared_ptr<Limit> limit_ = nullptr) : cols(std::move(cols_)), tabs(std::move(tabs_)), conds(std::move(conds_)), group_by(std::move(group_by_)), order(std::move(order_)), limit(std::move(limit_))
         {
-            has_sort = (bool)order;
+            has_sort = !order.empty();
             has_agg = false;
             type = SelectStmtNode;
         }
     };
 
-    // set enable_nestloop
+    // set enable_nestloop = true / set parallel_degree = 4
     struct SetStmt : public TreeNode
     {
         SetKnobType set_knob_type_;
         bool bool_val_;
+        int int_val_;
 
-        SetStmt(SetKnobType type, bool bool_value) : set_knob_type_(type), bool_val_(bool_value) { TreeNode::type = SetStmtNode; }
+        SetStmt(SetKnobType type, bool bool_value, int int_value = 0) : set_knob_type_(type), bool_val_(bool_value), int_val_(int_value) { TreeNode::type = SetStmtNode; }
     };
 
     struct LoadStmt : public TreeNode
@@ -431,6 +465,22 @@ enum TreeNodeType
         LoadStmt(std::string file_name_, std::string table_name_) : file_name(std::move(file_name_)), tab_name(std::move(table_name_)) { type = LoadStmtNode; }
     };
 
-    extern thread_local std::shared_ptr<ast::TreeNode> parse_tree;
+    // prepare name as <dml>
+    struct PrepareStmt : public TreeNode
+    {
+        std::string name;
+        std::shared_ptr<TreeNode> stmt;
+
+        PrepareStmt(std::string name_, std::shared_ptr<TreeNode> stmt_) : name(std::move(name_)), stmt(std::move(stmt_)) { type = PrepareStmtNode; }
+    };
+
+    // execute name(v1, v2, ...)
+    struct ExecuteStmt : public TreeNode
+    {
+        std::string name;
+        std::vector<std::shared_ptr<Value>> vals;
+
+        ExecuteStmt(std::string name_, std::vector<std::shared_ptr<Value>> vals_) : name(std::move(name_)), vals(std::move(vals_)) { type = ExecuteStmtNode; }
+    };
 
 } // namespace ast
@@ -90,6 +90,11 @@ namespace ast
                 std::cout << "DESC_TABLE\n";
                 print_val(x->tab_name, offset);
             }
+            else if (auto x = std::dynamic_pointer_cast<AnalyzeStmt>(node))
+            {
+                std::cout << "ANALYZE\n";
+                print_val(x->tab_name, offset);
+            }
             else if (auto x = std::dynamic_pointer_cast<DescIndex>(node))
             {
                 std::cout << "DESC_INDEX\n";
@@ -168,7 +173,10 @@ namespace ast
             {
                 std::cout << "INSERT\n";
                 print_val(x->tab_name, offset);
-                print_node_list(x->vals, offset);
+                for (auto &row : x->rows)
+                {
+                    print_node_list(row, offset);
+                }
             }
             else if (auto x = std::dynamic_pointer_cast<DeleteStmt>(node))
             {
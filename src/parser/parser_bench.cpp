@@ -0,0 +1,92 @@
+#undef NDEBUG
+
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+#include "parser.h"
+
+// 解析器吞吐基准：每个线程各自持有 SqlParser，反复解析同一组语句，
+// 依次用 1..max_threads 个线程运行，输出总吞吐以观察解析在多线程下是否线性扩展。
+// bison 和手写的递归下降解析器各跑一遍，对比单条语句的解析延迟。
+// 用法：parser_bench [最大线程数] [每线程轮数]
+
+static const std::vector<std::string> sqls = {
+    "select * from warehouse where w_id = 10;",
+    "select c_discount, c_last, c_credit, w_tax from customer, warehouse where w_id = 1 and c_w_id = w_id and c_d_id = 2 and c_id = 3;",
+    "select id, name, score from grade where score > 90.5 and name <> 'tom' order by score desc;",
+    "select count(*) as cnt, max(score) from grade group by course having count(*) > 2;",
+    "insert into orders values (1, 2, 3, 4, 0, 5, 1, 'x'), (2, 2, 3, 4, 0, 5, 1, 'y');",
+    "update district set d_next_o_id = d_next_o_id + 1 where d_w_id = 1 and d_id = 2;",
+    "delete from new_orders where no_o_id = 2101 and no_d_id = 1 and no_w_id = 1;",
+    "create table t (id int, name char(16), score float);",
+    "begin;",
+    "commit;",
+};
+
+static size_t parse_all(const std::string &sql)
+{
+    SqlParser parser(sql.c_str());
+    std::shared_ptr<ast::TreeNode> parse_tree;
+    size_t n = 0;
+    while (true)
+    {
+        int rc = parser.next(parse_tree);
+        assert(rc == 0);
+        if (parse_tree == nullptr)
+        {
+            break;
+        }
+        n++;
+    }
+    return n;
+}
+
+int main(int argc, char **argv)
+{
+    int max_threads = argc > 1 ? atoi(argv[1]) : (int)std::thread::hardware_concurrency();
+    int rounds = argc > 2 ? atoi(argv[2]) : 20000;
+    if (max_threads <= 0)
+    {
+        max_threads = 1;
+    }
+
+    for (bool handwritten : {false, true})
+    {
+        SqlParser::handwritten = handwritten;
+        // 单条语句单独解析，模拟每个请求新建一个 SqlParser 的服务端用法
+        for (auto &sql : sqls)
+        {
+            assert(parse_all(sql) == 1);
+        }
+
+        for (int threads = 1; threads <= max_threads; threads *= 2)
+        {
+            std::vector<std::thread> workers;
+            auto start = std::chrono::steady_clock::now();
+            for (int t = 0; t < threads; t++)
+            {
+                workers.emplace_back([rounds] {
+                    for (int r = 0; r < rounds; r++)
+                    {
+                        for (auto &sql : sqls)
+                        {
+                            parse_all(sql);
+                        }
+                    }
+                });
+            }
+            for (auto &worker : workers)
+            {
+                worker.join();
+            }
+            auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            double total = (double)threads * rounds * sqls.size();
+            std::cout << (handwritten ? "handwritten" : "bison") << " threads=" << threads << " statements=" << (size_t)total << " time=" << elapsed << "s"
+                      << " throughput=" << (size_t)(total / elapsed) << " stmt/s"
+                      << " latency=" << elapsed * 1e9 * threads / total << " ns/stmt" << std::endl;
+        }
+    }
+    return 0;
+}
@@ -10,6 +10,10 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <memory>
+
+#include "rd_parser.h"
+
 /**
  * @typedef YY_BUFFER_STATE
  * 表示词法分析器的缓冲区状态。
@@ -23,15 +27,13 @@ typedef struct yy_buffer_state *YY_BUFFER_STATE;
 typedef void *yyscan_t;
 
 /**
- * @brief 解析输入源（可重入）。
+ * @brief 从输入源中解析下一条语句（可重入）。
  *
  * @param yyscanner 词法分析器实例的句柄。
+ * @param parse_tree 输出参数，保存解析出的语句；遇到 EOF 或 EXIT 时置空。
  * @return 解析结果的状态码。
  */
-int yyparse(yyscan_t yyscanner);
-
-/** 兼容无参数旧接口（在解析器内部维护线程局部的 scanner）。*/
-int yyparse();
+int yyparse(yyscan_t yyscanner, std::shared_ptr<ast::TreeNode> &parse_tree);
 
 /**
  * @brief 初始化词法分析器实例，并传递用户定义的数据。
@@ -50,9 +52,6 @@ int yylex_init(yyscan_t *scanner);
  */
 YY_BUFFER_STATE yy_scan_string(const char *yy_str, yyscan_t yyscanner);
 
-/** 兼容无参数旧接口。*/
-YY_BUFFER_STATE yy_scan_string(const char *yy_str);
-
 /**
  * @brief 删除指定的词法分析器缓冲区（可重入）。
  *
@@ -61,9 +60,6 @@ YY_BUFFER_STATE yy_scan_string(const char *yy_str);
  */
 void yy_delete_buffer(YY_BUFFER_STATE buffer, yyscan_t yyscanner);
 
-/** 兼容无参数旧接口。*/
-void yy_delete_buffer(YY_BUFFER_STATE buffer);
-
 /**
  * @brief 销毁指定的词法分析器实例。
  *
@@ -71,3 +67,39 @@ void yy_delete_buffer(YY_BUFFER_STATE buffer);
  * @return 销毁结果的状态码。
  */
 int yylex_destroy(yyscan_t yyscanner);
+
+/**
+ * @brief 一次解析调用的全部状态：词法分析器实例和输入缓冲区。
+ *
+ * 每个调用方各自持有一个 SqlParser，解析结果通过参数返回，
+ * 不依赖任何全局或线程局部变量，多个线程可以同时解析。
+ */
+class SqlParser
+{
+public:
+    /** 为 true 时使用手写的递归下降解析器（RdParser），否则使用 flex/bison，在启动时设置。*/
+    inline static bool handwritten = false;
+
+    /**
+     * @param sql 要解析的语句文本，需在 SqlParser 的生命周期内保持有效。
+     */
+    explicit SqlParser(const char *sql);
+
+    ~SqlParser();
+
+    SqlParser(const SqlParser &) = delete;
+    SqlParser &operator=(const SqlParser &) = delete;
+
+    /**
+     * @brief 解析下一条语句。
+     *
+     * @param parse_tree 输出参数，保存解析出的语句；输入结束或遇到 EXIT 时置空。
+     * @return 0 表示成功，非 0 表示语法错误。
+     */
+    int next(std::shared_ptr<ast::TreeNode> &parse_tree);
+
+private:
+    yyscan_t scanner_ = nullptr;
+    YY_BUFFER_STATE buffer_ = nullptr;
+    RdParser rd_parser_;
+};
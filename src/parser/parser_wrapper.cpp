@@ -5,31 +5,32 @@ extern int yylex(yy::parser::semantic_type *yylval, yy::parser::location_type *y
 extern YY_BUFFER_STATE yy_scan_string(const char *yy_str, yyscan_t yyscanner);
 extern void yy_delete_buffer(YY_BUFFER_STATE buffer, yyscan_t yyscanner);
 
-// Thread-local scanner to support legacy no-arg APIs used by some call sites
-static thread_local yyscan_t tls_scanner = nullptr;
-
-int yyparse(yyscan_t yyscanner) {
-    yy::parser parser(yyscanner);
+int yyparse(yyscan_t yyscanner, std::shared_ptr<ast::TreeNode> &parse_tree) {
+    parse_tree = nullptr;
+    yy::parser parser(yyscanner, parse_tree);
     return parser.parse();
 }
 
-int yyparse() {
-    if (!tls_scanner) {
-        yylex_init(&tls_scanner);
+SqlParser::SqlParser(const char *sql) : rd_parser_(sql) {
+    if (!handwritten) {
+        yylex_init(&scanner_);
+        buffer_ = ::yy_scan_string(sql, scanner_);
     }
-    yy::parser parser(tls_scanner);
-    return parser.parse();
 }
 
-YY_BUFFER_STATE yy_scan_string(const char *yy_str) {
-    if (!tls_scanner) {
-        yylex_init(&tls_scanner);
+SqlParser::~SqlParser() {
+    if (scanner_ == nullptr) {
+        return;
+    }
+    if (buffer_ != nullptr) {
+        ::yy_delete_buffer(buffer_, scanner_);
     }
-    return ::yy_scan_string(yy_str, tls_scanner);
+    yylex_destroy(scanner_);
 }
 
-void yy_delete_buffer(YY_BUFFER_STATE buffer) {
-    if (buffer) {
-        ::yy_delete_buffer(buffer, tls_scanner);
+int SqlParser::next(std::shared_ptr<ast::TreeNode> &parse_tree) {
+    if (scanner_ == nullptr) {
+        return rd_parser_.next(parse_tree);
     }
+    return yyparse(scanner_, parse_tree);
 }
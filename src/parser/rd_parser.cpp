@@ -0,0 +1,862 @@
+#include "rd_parser.h"
+
+#include <strings.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "common/arena.h"
+
+using namespace ast;
+
+namespace
+{
+    struct Keyword
+    {
+        const char *name;
+        SqlTok kind;
+    };
+
+    const Keyword keywords[] = {
+        {"SELECT", SqlTok::SELECT}, {"UPDATE", SqlTok::UPDATE}, {"INSERT", SqlTok::INSERT}, {"DELETE", SqlTok::DELETE},
+        {"FROM", SqlTok::FROM}, {"WHERE", SqlTok::WHERE}, {"SET", SqlTok::SET}, {"INTO", SqlTok::INTO},
+        {"VALUES", SqlTok::VALUES}, {"AND", SqlTok::AND}, {"BEGIN", SqlTok::TXN_BEGIN}, {"COMMIT", SqlTok::TXN_COMMIT},
+        {"ROLLBACK", SqlTok::TXN_ROLLBACK}, {"ABORT", SqlTok::TXN_ABORT}, {"ORDER", SqlTok::ORDER}, {"BY", SqlTok::BY},
+        {"LIMIT", SqlTok::LIMIT}, {"OFFSET", SqlTok::OFFSET},
+        {"GROUP", SqlTok::GROUP}, {"COUNT", SqlTok::COUNT}, {"SUM", SqlTok::SUM}, {"MIN", SqlTok::MIN},
+        {"AS", SqlTok::AS}, {"JOIN", SqlTok::JOIN}, {"CREATE", SqlTok::CREATE}, {"TABLE", SqlTok::TABLE},
+        {"INDEX", SqlTok::INDEX}, {"INT", SqlTok::INT}, {"CHAR", SqlTok::CHAR}, {"FLOAT", SqlTok::FLOAT},
+        {"DATETIME", SqlTok::DATETIME}, {"DROP", SqlTok::DROP}, {"SHOW", SqlTok::SHOW}, {"TABLES", SqlTok::TABLES},
+        {"DESC", SqlTok::DESC}, {"MAX", SqlTok::MAX}, {"AVG", SqlTok::AVG}, {"HAVING", SqlTok::HAVING},
+        {"ASC", SqlTok::ASC}, {"HELP", SqlTok::HELP}, {"EXIT", SqlTok::EXIT}, {"STATIC_CHECKPOINT", SqlTok::STATIC_CHECKPOINT},
+        {"CRASH", SqlTok::CRASH}, {"LOAD", SqlTok::LOAD}, {"ANALYZE", SqlTok::ANALYZE}, {"ENABLE_NESTLOOP", SqlTok::ENABLE_NESTLOOP},
+        {"ENABLE_SORTMERGE", SqlTok::ENABLE_SORTMERGE}, {"ENABLE_HASHJOIN", SqlTok::ENABLE_HASHJOIN}, {"PARALLEL_DEGREE", SqlTok::PARALLEL_DEGREE}, {"PREPARE", SqlTok::PREPARE}, {"EXECUTE", SqlTok::EXECUTE},
+        {"TRUE", SqlTok::VALUE_BOOL}, {"FALSE", SqlTok::VALUE_BOOL}, {"IN", SqlTok::IN}, {"NOT", SqlTok::NOT},
+        {"OUTPUT_FILE", SqlTok::OUTPUT_FILE}, {"ON", SqlTok::ON}, {"OFF", SqlTok::OFF},
+    };
+
+    constexpr size_t MAX_KEYWORD_LEN = 17;
+
+    // 按长度分桶的关键字表，查找时只比较长度相同的关键字
+    struct KeywordTable
+    {
+        std::vector<Keyword> buckets[MAX_KEYWORD_LEN + 1];
+
+        KeywordTable()
+        {
+            for (auto &keyword : keywords)
+            {
+                buckets[strlen(keyword.name)].push_back(keyword);
+            }
+        }
+
+        SqlTok lookup(const char *begin, size_t len) const
+        {
+            if (len > MAX_KEYWORD_LEN)
+            {
+                return SqlTok::IDENTIFIER;
+            }
+            char first = begin[0] & ~0x20;
+            for (auto &keyword : buckets[len])
+            {
+                if (keyword.name[0] == first && strncasecmp(keyword.name, begin, len) == 0)
+                {
+                    return keyword.kind;
+                }
+            }
+            return SqlTok::IDENTIFIER;
+        }
+    };
+
+    const KeywordTable keyword_table;
+
+    inline bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+    inline bool is_alpha(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+}
+
+SqlToken SqlLexer::next()
+{
+    while (true)
+    {
+        const char *p = cur_;
+        switch (*p)
+        {
+        case '\0':
+            return make(SqlTok::END, p, 0);
+        case ' ':
+        case '\t':
+        case '\r':
+        case '\n':
+            cur_++;
+            continue;
+        case '-':
+            if (p[1] == '-')
+            {
+                // 单行注释
+                p += 2;
+                while (*p != '\0' && *p != '\n')
+                {
+                    p++;
+                }
+                cur_ = p;
+                continue;
+            }
+            return is_digit(p[1]) ? number(p) : make(SqlTok::SIGN_SUB, p, 1);
+        case '+':
+            return is_digit(p[1]) ? number(p) : make(SqlTok::SIGN_ADD, p, 1);
+        case '.':
+        case '/':
+        case '|':
+            if (size_t len = match_path(p))
+            {
+                return make(SqlTok::VALUE_PATH, p, len);
+            }
+            if (*p == '.')
+            {
+                return make(SqlTok::DOT, p, 1);
+            }
+            if (*p == '/' && p[1] == '*')
+            {
+                // 块注释，未闭合时一直忽略到输入结束
+                const char *end = strstr(p + 2, "*/");
+                cur_ = end != nullptr ? end + 2 : p + strlen(p);
+                continue;
+            }
+            break;
+        case '\'':
+        {
+            const char *end = strchr(p + 1, '\'');
+            if (end != nullptr)
+            {
+                return make(SqlTok::VALUE_STRING, p, end - p + 1);
+            }
+            break;
+        }
+        case '>':
+            return p[1] == '=' ? make(SqlTok::GEQ, p, 2) : make(SqlTok::GT, p, 1);
+        case '<':
+            if (p[1] == '=')
+            {
+                return make(SqlTok::LEQ, p, 2);
+            }
+            return p[1] == '>' ? make(SqlTok::NEQ, p, 2) : make(SqlTok::LT, p, 1);
+        case '!':
+            if (p[1] == '=')
+            {
+                return make(SqlTok::NEQ, p, 2);
+            }
+            break;
+        case ';':
+            return make(SqlTok::SEMICOLON, p, 1);
+        case '(':
+            return make(SqlTok::LPAREN, p, 1);
+        case ')':
+            return make(SqlTok::RPAREN, p, 1);
+        case ',':
+            return make(SqlTok::COMMA, p, 1);
+        case '*':
+            return make(SqlTok::STAR, p, 1);
+        case '=':
+            return make(SqlTok::EQ, p, 1);
+        case '?':
+            return make(SqlTok::QUESTION, p, 1);
+        default:
+            if (is_digit(*p))
+            {
+                return number(p);
+            }
+            if (is_alpha(*p))
+            {
+                return word(p);
+            }
+            break;
+        }
+        std::cerr << "Lexer Error: unexpected character " << *p << std::endl;
+        cur_ = p + 1;
+    }
+}
+
+SqlToken SqlLexer::number(const char *begin)
+{
+    const char *p = begin;
+    if (*p == '+' || *p == '-')
+    {
+        p++;
+    }
+    while (is_digit(*p))
+    {
+        p++;
+    }
+    if (*p != '.')
+    {
+        return make(SqlTok::VALUE_INT, begin, p - begin);
+    }
+    p++;
+    while (is_digit(*p))
+    {
+        p++;
+    }
+    return make(SqlTok::VALUE_FLOAT, begin, p - begin);
+}
+
+SqlToken SqlLexer::word(const char *begin)
+{
+    const char *p = begin + 1;
+    while (is_alpha(*p) || is_digit(*p) || *p == '_')
+    {
+        p++;
+    }
+    return make(keyword_table.lookup(begin, p - begin), begin, p - begin);
+}
+
+// value_path: [\.|\/][^ \t]+\.csv，返回最长匹配的长度，不匹配时返回 0
+size_t SqlLexer::match_path(const char *begin)
+{
+    const char *end = begin + 1;
+    while (*end != '\0' && *end != ' ' && *end != '\t')
+    {
+        end++;
+    }
+    if (end - begin < 6)
+    {
+        return 0;
+    }
+    for (const char *q = end - 4; q >= begin + 2; q--)
+    {
+        if (strncasecmp(q, ".csv", 4) == 0)
+        {
+            return q + 4 - begin;
+        }
+    }
+    return 0;
+}
+
+int RdParser::next(std::shared_ptr<TreeNode> &parse_tree)
+{
+    parse_tree = nullptr;
+    try
+    {
+        advance();
+        switch (tok_.kind)
+        {
+        case SqlTok::HELP:
+            parse_tree = make_arena_shared<Help>();
+            return 0;
+        case SqlTok::EXIT:
+        case SqlTok::END:
+            return 0;
+        case SqlTok::SET:
+            advance();
+            if (accept(SqlTok::OUTPUT_FILE))
+            {
+                // SET OUTPUT_FILE ON/OFF 不需要分号
+                if (tok_.kind != SqlTok::ON && tok_.kind != SqlTok::OFF)
+                {
+                    throw SyntaxError();
+                }
+                parse_tree = make_arena_shared<IoEnable>(tok_.kind == SqlTok::ON);
+                return 0;
+            }
+            else if (accept(SqlTok::PARALLEL_DEGREE))
+            {
+                expect(SqlTok::EQ);
+                parse_tree = make_arena_shared<SetStmt>(ParallelDegree, false, int_value());
+            }
+            else
+            {
+                SetKnobType knob;
+                if (accept(SqlTok::ENABLE_NESTLOOP))
+                {
+                    knob = EnableNestLoop;
+                }
+                else if (accept(SqlTok::ENABLE_HASHJOIN))
+                {
+                    knob = EnableHashJoin;
+                }
+                else
+                {
+                    expect(SqlTok::ENABLE_SORTMERGE);
+                    knob = EnableSortMerge;
+                }
+                expect(SqlTok::EQ);
+                if (tok_.kind != SqlTok::VALUE_BOOL)
+                {
+                    throw SyntaxError();
+                }
+                bool val = (tok_.begin[0] | 0x20) == 't';
+                advance();
+                parse_tree = make_arena_shared<SetStmt>(knob, val);
+            }
+            break;
+        default:
+            parse_tree = stmt();
+            break;
+        }
+        // 语句以分号结束，分号之后的内容留给下一次调用
+        if (tok_.kind != SqlTok::SEMICOLON)
+        {
+            throw SyntaxError();
+        }
+        return 0;
+    }
+    catch (SyntaxError &)
+    {
+        parse_tree = nullptr;
+        report_error();
+        return 1;
+    }
+}
+
+void RdParser::report_error() const
+{
+    int line = 1;
+    const char *line_begin = sql_;
+    for (const char *p = sql_; p < tok_.begin; p++)
+    {
+        if (*p == '\n')
+        {
+            line++;
+            line_begin = p + 1;
+        }
+    }
+    std::cerr << "Parser Error at line " << line << " column " << tok_.begin - line_begin + 1
+              << ": syntax error, unexpected '" << std::string(tok_.begin, tok_.len) << "'" << std::endl;
+}
+
+std::string RdParser::identifier()
+{
+    if (tok_.kind != SqlTok::IDENTIFIER)
+    {
+        throw SyntaxError();
+    }
+    std::string name(tok_.begin, tok_.len);
+    advance();
+    return name;
+}
+
+int RdParser::int_value()
+{
+    if (tok_.kind != SqlTok::VALUE_INT)
+    {
+        throw SyntaxError();
+    }
+    int val = atoi(tok_.begin);
+    advance();
+    return val;
+}
+
+std::shared_ptr<TreeNode> RdParser::stmt()
+{
+    switch (tok_.kind)
+    {
+    case SqlTok::SHOW:
+        advance();
+        if (accept(SqlTok::TABLES))
+        {
+            return make_arena_shared<ShowTables>();
+        }
+        expect(SqlTok::INDEX);
+        expect(SqlTok::FROM);
+        return make_arena_shared<DescIndex>(identifier());
+    case SqlTok::LOAD:
+    {
+        advance();
+        if (tok_.kind != SqlTok::VALUE_PATH)
+        {
+            throw SyntaxError();
+        }
+        std::string file_name(tok_.begin, tok_.len);
+        advance();
+        expect(SqlTok::INTO);
+        return make_arena_shared<LoadStmt>(std::move(file_name), identifier());
+    }
+    case SqlTok::ANALYZE:
+        advance();
+        if (tok_.kind == SqlTok::IDENTIFIER)
+        {
+            return make_arena_shared<AnalyzeStmt>(identifier());
+        }
+        return make_arena_shared<AnalyzeStmt>("");
+    case SqlTok::CREATE:
+    {
+        advance();
+        if (accept(SqlTok::STATIC_CHECKPOINT))
+        {
+            return make_arena_shared<CreateStaticCheckpoint>();
+        }
+        if (accept(SqlTok::INDEX))
+        {
+            std::string tab_name = identifier();
+            expect(SqlTok::LPAREN);
+            auto col_names = col_name_list();
+            expect(SqlTok::RPAREN);
+            return make_arena_shared<CreateIndex>(std::move(tab_name), std::move(col_names));
+        }
+        expect(SqlTok::TABLE);
+        std::string tab_name = identifier();
+        expect(SqlTok::LPAREN);
+        std::vector<std::shared_ptr<Field>> fields;
+        fields.reserve(8);
+        do
+        {
+            std::string col_name = identifier();
+            fields.emplace_back(make_arena_shared<ColDef>(std::move(col_name), type()));
+        } while (accept(SqlTok::COMMA));
+        expect(SqlTok::RPAREN);
+        return make_arena_shared<CreateTable>(std::move(tab_name), std::move(fields));
+    }
+    case SqlTok::DROP:
+    {
+        advance();
+        if (accept(SqlTok::TABLE))
+        {
+            return make_arena_shared<DropTable>(identifier());
+        }
+        expect(SqlTok::INDEX);
+        std::string tab_name = identifier();
+        expect(SqlTok::LPAREN);
+        auto col_names = col_name_list();
+        expect(SqlTok::RPAREN);
+        return make_arena_shared<DropIndex>(std::move(tab_name), std::move(col_names));
+    }
+    case SqlTok::DESC:
+        advance();
+        return make_arena_shared<DescTable>(identifier());
+    case SqlTok::TXN_BEGIN:
+        advance();
+        return make_arena_shared<TxnBegin>();
+    case SqlTok::TXN_COMMIT:
+        advance();
+        return make_arena_shared<TxnCommit>();
+    case SqlTok::TXN_ABORT:
+        advance();
+        return make_arena_shared<TxnAbort>();
+    case SqlTok::TXN_ROLLBACK:
+        advance();
+        return make_arena_shared<TxnRollback>();
+    case SqlTok::CRASH:
+        advance();
+        return make_arena_shared<CrashStmt>();
+    case SqlTok::PREPARE:
+    {
+        advance();
+        std::string name = identifier();
+        expect(SqlTok::AS);
+        return make_arena_shared<PrepareStmt>(std::move(name), dml());
+    }
+    case SqlTok::EXECUTE:
+    {
+        advance();
+        std::string name = identifier();
+        std::vector<std::shared_ptr<Value>> vals;
+        if (accept(SqlTok::LPAREN))
+        {
+            vals = value_list();
+            expect(SqlTok::RPAREN);
+        }
+        return make_arena_shared<ExecuteStmt>(std::move(name), std::move(vals));
+    }
+    default:
+        return dml();
+    }
+}
+
+std::shared_ptr<TreeNode> RdParser::dml()
+{
+    switch (tok_.kind)
+    {
+    case SqlTok::INSERT:
+    {
+        advance();
+        expect(SqlTok::INTO);
+        std::string tab_name = identifier();
+        expect(SqlTok::VALUES);
+        std::vector<std::vector<std::shared_ptr<Value>>> rows;
+        do
+        {
+            expect(SqlTok::LPAREN);
+            rows.emplace_back(value_list());
+            expect(SqlTok::RPAREN);
+        } while (accept(SqlTok::COMMA));
+        return make_arena_shared<InsertStmt>(std::move(tab_name), std::move(rows));
+    }
+    case SqlTok::DELETE:
+    {
+        advance();
+        expect(SqlTok::FROM);
+        std::string tab_name = identifier();
+        return make_arena_shared<DeleteStmt>(std::move(tab_name), opt_where_clause());
+    }
+    case SqlTok::UPDATE:
+    {
+        advance();
+        std::string tab_name = identifier();
+        expect(SqlTok::SET);
+        std::vector<std::shared_ptr<SetClause>> set_clauses;
+        set_clauses.reserve(4);
+        do
+        {
+            set_clauses.emplace_back(set_clause());
+        } while (accept(SqlTok::COMMA));
+        return make_arena_shared<UpdateStmt>(std::move(tab_name), std::move(set_clauses), opt_where_clause());
+    }
+    case SqlTok::SELECT:
+        return select_stmt();
+    default:
+        throw SyntaxError();
+    }
+}
+
+std::shared_ptr<TreeNode> RdParser::select_stmt()
+{
+    expect(SqlTok::SELECT);
+    std::vector<std::shared_ptr<Col>> cols;
+    if (!accept(SqlTok::STAR))
+    {
+        cols = col_list();
+    }
+    expect(SqlTok::FROM);
+    std::vector<std::string> tabs;
+    tabs.reserve(4);
+    do
+    {
+        tabs.emplace_back(identifier());
+    } while (accept(SqlTok::COMMA) || accept(SqlTok::JOIN));
+    auto conds = opt_where_clause();
+
+    std::shared_ptr<GroupBy> group_by;
+    if (accept(SqlTok::GROUP))
+    {
+        expect(SqlTok::BY);
+        group_by = make_arena_shared<GroupBy>(col_list());
+        if (accept(SqlTok::HAVING))
+        {
+            group_by->having_conds.reserve(4);
+            do
+            {
+                auto lhs = agg_func();
+                auto cmp = op();
+                group_by->having_conds.emplace_back(make_arena_shared<HavingCause>(std::move(lhs), cmp, expr()));
+            } while (accept(SqlTok::AND));
+        }
+    }
+
+    std::vector<std::shared_ptr<OrderBy>> order;
+    if (accept(SqlTok::ORDER))
+    {
+        expect(SqlTok::BY);
+        do
+        {
+            auto order_col = col();
+            OrderByDir dir = OrderBy_DEFAULT;
+            if (accept(SqlTok::ASC))
+            {
+                dir = OrderBy_ASC;
+            }
+            else if (accept(SqlTok::DESC))
+            {
+                dir = OrderBy_DESC;
+            }
+            order.emplace_back(make_arena_shared<OrderBy>(std::move(order_col), dir));
+        } while (accept(SqlTok::COMMA));
+    }
+
+    std::shared_ptr<Limit> limit;
+    if (accept(SqlTok::LIMIT))
+    {
+        int count = int_value();
+        int offset = accept(SqlTok::OFFSET) ? int_value() : 0;
+        limit = make_arena_shared<Limit>(count, offset);
+    }
+    return make_arena_shared<SelectStmt>(std::move(cols), std::move(tabs), std::move(conds), std::move(group_by), std::move(order), std::move(limit));
+}
+
+std::shared_ptr<TypeLen> RdParser::type()
+{
+    switch (tok_.kind)
+    {
+    case SqlTok::INT:
+        advance();
+        return make_arena_shared<TypeLen>(SV_TYPE_INT, sizeof(int));
+    case SqlTok::FLOAT:
+        advance();
+        return make_arena_shared<TypeLen>(SV_TYPE_FLOAT, sizeof(float));
+    case SqlTok::DATETIME:
+        advance();
+        return make_arena_shared<TypeLen>(SV_TYPE_DATETIME, 19);
+    case SqlTok::CHAR:
+    {
+        advance();
+        expect(SqlTok::LPAREN);
+        int len = int_value();
+        expect(SqlTok::RPAREN);
+        return make_arena_shared<TypeLen>(SV_TYPE_STRING, len);
+    }
+    default:
+        throw SyntaxError();
+    }
+}
+
+std::shared_ptr<Value> RdParser::value()
+{
+    std::shared_ptr<Value> val;
+    switch (tok_.kind)
+    {
+    case SqlTok::VALUE_INT:
+        // 整数 token 之后紧跟的一定不是数字，atoi 可以直接作用在输入缓冲区上
+        val = make_arena_shared<IntLit>(atoi(tok_.begin));
+        break;
+    case SqlTok::VALUE_FLOAT:
+    {
+        // atof 会越过 token 继续解析指数部分，拷贝到栈上截断
+        char buf[64];
+        if (tok_.len < sizeof(buf))
+        {
+            memcpy(buf, tok_.begin, tok_.len);
+            buf[tok_.len] = '\0';
+            val = make_arena_shared<FloatLit>(static_cast<float>(atof(buf)));
+        }
+        else
+        {
+            val = make_arena_shared<FloatLit>(static_cast<float>(atof(std::string(tok_.begin, tok_.len).c_str())));
+        }
+        break;
+    }
+    case SqlTok::VALUE_STRING:
+        val = make_arena_shared<StringLit>(std::string(tok_.begin + 1, tok_.len - 2));
+        break;
+    case SqlTok::VALUE_BOOL:
+        val = make_arena_shared<BoolLit>((tok_.begin[0] | 0x20) == 't');
+        break;
+    case SqlTok::QUESTION:
+        val = make_arena_shared<ParamLit>();
+        break;
+    default:
+        throw SyntaxError();
+    }
+    advance();
+    return val;
+}
+
+std::vector<std::shared_ptr<Value>> RdParser::value_list()
+{
+    std::vector<std::shared_ptr<Value>> vals;
+    vals.reserve(8);
+    do
+    {
+        vals.emplace_back(value());
+    } while (accept(SqlTok::COMMA));
+    return vals;
+}
+
+std::vector<std::string> RdParser::col_name_list()
+{
+    std::vector<std::string> col_names;
+    col_names.reserve(4);
+    do
+    {
+        col_names.emplace_back(identifier());
+    } while (accept(SqlTok::COMMA));
+    return col_names;
+}
+
+std::shared_ptr<Col> RdParser::col()
+{
+    if (tok_.kind != SqlTok::IDENTIFIER)
+    {
+        std::shared_ptr<Col> agg = agg_func();
+        if (accept(SqlTok::AS))
+        {
+            agg->alias = identifier();
+        }
+        return agg;
+    }
+    std::string name = identifier();
+    if (accept(SqlTok::DOT))
+    {
+        // tbName '.' colName 不支持别名
+        return make_arena_shared<Col>(std::move(name), identifier());
+    }
+    if (accept(SqlTok::AS))
+    {
+        return make_arena_shared<Col>("", std::move(name), identifier());
+    }
+    return make_arena_shared<Col>("", std::move(name));
+}
+
+std::shared_ptr<AggFunc> RdParser::agg_func()
+{
+    AggFuncType agg_type;
+    switch (tok_.kind)
+    {
+    case SqlTok::SUM:
+        agg_type = AggFuncType::SUM;
+        break;
+    case SqlTok::MIN:
+        agg_type = AggFuncType::MIN;
+        break;
+    case SqlTok::MAX:
+        agg_type = AggFuncType::MAX;
+        break;
+    case SqlTok::AVG:
+        agg_type = AggFuncType::AVG;
+        break;
+    case SqlTok::COUNT:
+        agg_type = AggFuncType::COUNT;
+        break;
+    default:
+        throw SyntaxError();
+    }
+    advance();
+    expect(SqlTok::LPAREN);
+    if (agg_type == AggFuncType::COUNT && accept(SqlTok::STAR))
+    {
+        expect(SqlTok::RPAREN);
+        return make_arena_shared<AggFunc>("", "*", AggFuncType::COUNT);
+    }
+    auto c = col();
+    expect(SqlTok::RPAREN);
+    return make_arena_shared<AggFunc>(std::move(c->tab_name), std::move(c->col_name), agg_type);
+}
+
+std::vector<std::shared_ptr<Col>> RdParser::col_list()
+{
+    std::vector<std::shared_ptr<Col>> cols;
+    cols.reserve(8);
+    do
+    {
+        cols.emplace_back(col());
+    } while (accept(SqlTok::COMMA));
+    return cols;
+}
+
+std::shared_ptr<Expr> RdParser::expr()
+{
+    switch (tok_.kind)
+    {
+    case SqlTok::VALUE_INT:
+    case SqlTok::VALUE_FLOAT:
+    case SqlTok::VALUE_STRING:
+    case SqlTok::VALUE_BOOL:
+    case SqlTok::QUESTION:
+        return value();
+    default:
+        return col();
+    }
+}
+
+SvCompOp RdParser::op()
+{
+    SvCompOp cmp;
+    switch (tok_.kind)
+    {
+    case SqlTok::EQ:
+        cmp = SV_OP_EQ;
+        break;
+    case SqlTok::LT:
+        cmp = SV_OP_LT;
+        break;
+    case SqlTok::GT:
+        cmp = SV_OP_GT;
+        break;
+    case SqlTok::NEQ:
+        cmp = SV_OP_NE;
+        break;
+    case SqlTok::LEQ:
+        cmp = SV_OP_LE;
+        break;
+    case SqlTok::GEQ:
+        cmp = SV_OP_GE;
+        break;
+    case SqlTok::IN:
+        cmp = SV_OP_IN;
+        break;
+    case SqlTok::NOT:
+        advance();
+        if (tok_.kind != SqlTok::IN)
+        {
+            throw SyntaxError();
+        }
+        cmp = SV_OP_NOT_IN;
+        break;
+    default:
+        throw SyntaxError();
+    }
+    advance();
+    return cmp;
+}
+
+std::shared_ptr<BinaryExpr> RdParser::condition()
+{
+    auto lhs = col();
+    auto cmp = op();
+    if (!accept(SqlTok::LPAREN))
+    {
+        return make_arena_shared<BinaryExpr>(std::move(lhs), cmp, expr());
+    }
+    std::shared_ptr<BinaryExpr> cond;
+    switch (tok_.kind)
+    {
+    case SqlTok::INSERT:
+    case SqlTok::DELETE:
+    case SqlTok::UPDATE:
+    case SqlTok::SELECT:
+    {
+        auto subquery = dml();
+        expect(SqlTok::RPAREN);
+        // 与 yacc.y 一致：子查询不是 SELECT 时由 SubQueryExpr 抛出 RMDBError
+        cond = make_arena_shared<SubQueryExpr>(std::move(lhs), cmp, std::move(subquery));
+        break;
+    }
+    default:
+    {
+        auto vals = value_list();
+        expect(SqlTok::RPAREN);
+        cond = make_arena_shared<SubQueryExpr>(std::move(lhs), cmp, std::move(vals));
+        break;
+    }
+    }
+    return cond;
+}
+
+std::vector<std::shared_ptr<BinaryExpr>> RdParser::opt_where_clause()
+{
+    std::vector<std::shared_ptr<BinaryExpr>> conds;
+    if (accept(SqlTok::WHERE))
+    {
+        conds.reserve(4);
+        do
+        {
+            conds.emplace_back(condition());
+        } while (accept(SqlTok::AND));
+    }
+    return conds;
+}
+
+std::shared_ptr<SetClause> RdParser::set_clause()
+{
+    std::string col_name = identifier();
+    expect(SqlTok::EQ);
+    if (tok_.kind != SqlTok::IDENTIFIER)
+    {
+        return make_arena_shared<SetClause>(std::move(col_name), value());
+    }
+    // colName '=' colName [op] value，右侧的列名不参与构造
+    advance();
+    int self_op = 4;
+    if (accept(SqlTok::SIGN_ADD))
+    {
+        self_op = 0;
+    }
+    else if (accept(SqlTok::SIGN_SUB))
+    {
+        self_op = 1;
+    }
+    else if (accept(SqlTok::STAR))
+    {
+        self_op = 2;
+    }
+    return make_arena_shared<SetClause>(std::move(col_name), value(), self_op);
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ast.h"
+
+// 手写递归下降解析器使用的词法单元，与 lex.l 中的 token 一一对应
+enum class SqlTok
+{
+    END,
+    IDENTIFIER,
+    VALUE_INT,
+    VALUE_FLOAT,
+    VALUE_STRING,
+    VALUE_BOOL,
+    VALUE_PATH,
+
+    // keywords
+    SHOW, TABLES, CREATE, TABLE, DROP, DESC, INSERT, INTO, VALUES, DELETE, FROM, ASC, ORDER, BY, LIMIT, OFFSET,
+    WHERE, UPDATE, SET, SELECT, INT, CHAR, FLOAT, DATETIME, INDEX, AND, JOIN, EXIT, HELP,
+    TXN_BEGIN, TXN_COMMIT, TXN_ABORT, TXN_ROLLBACK, ENABLE_NESTLOOP, ENABLE_SORTMERGE, ENABLE_HASHJOIN, PARALLEL_DEGREE, STATIC_CHECKPOINT, CRASH,
+    MAX, MIN, AVG, COUNT, SUM, GROUP, HAVING, AS, IN, NOT, LOAD, ANALYZE, PREPARE, EXECUTE, OUTPUT_FILE, ON, OFF,
+
+    // operators
+    SIGN_ADD, SIGN_SUB, LEQ, NEQ, GEQ,
+    SEMICOLON, LPAREN, RPAREN, COMMA, STAR, EQ, GT, LT, DOT, QUESTION
+};
+
+// 词法单元直接指向输入缓冲区，不做任何拷贝
+struct SqlToken
+{
+    SqlTok kind = SqlTok::END;
+    const char *begin = nullptr;
+    size_t len = 0;
+};
+
+// 与 lex.l 等价的零拷贝词法分析器：关键字大小写不敏感，标识符保留原样，
+// 数字按最长匹配区分整数和浮点数，非法字符报错后跳过
+class SqlLexer
+{
+public:
+    explicit SqlLexer(const char *sql) : cur_(sql) {}
+
+    SqlToken next();
+
+private:
+    SqlToken make(SqlTok kind, const char *begin, size_t len)
+    {
+        cur_ = begin + len;
+        return SqlToken{kind, begin, len};
+    }
+
+    SqlToken number(const char *begin);
+    SqlToken word(const char *begin);
+    static size_t match_path(const char *begin);
+
+    const char *cur_;
+};
+
+// 手写的递归下降 SQL 解析器，文法与 yacc.y 相同，生成同样的 ast:: 节点。
+// 每次 next() 解析一条语句，遇到 EOF 或 EXIT 时 parse_tree 置空；语法错误返回非 0
+class RdParser
+{
+public:
+    explicit RdParser(const char *sql) : sql_(sql), lexer_(sql) {}
+
+    int next(std::shared_ptr<ast::TreeNode> &parse_tree);
+
+private:
+    struct SyntaxError
+    {
+    };
+
+    void advance() { tok_ = lexer_.next(); }
+
+    bool accept(SqlTok kind)
+    {
+        if (tok_.kind != kind)
+        {
+            return false;
+        }
+        advance();
+        return true;
+    }
+
+    void expect(SqlTok kind)
+    {
+        if (!accept(kind))
+        {
+            throw SyntaxError();
+        }
+    }
+
+    std::string identifier();
+    int int_value();
+
+    std::shared_ptr<ast::TreeNode> stmt();
+    std::shared_ptr<ast::TreeNode> dml();
+    std::shared_ptr<ast::TreeNode> select_stmt();
+    std::shared_ptr<ast::TypeLen> type();
+    std::shared_ptr<ast::Value> value();
+    std::vector<std::shared_ptr<ast::Value>> value_list();
+    std::vector<std::string> col_name_list();
+    std::shared_ptr<ast::Col> col();
+    std::shared_ptr<ast::AggFunc> agg_func();
+    std::vector<std::shared_ptr<ast::Col>> col_list();
+    std::shared_ptr<ast::Expr> expr();
+    ast::SvCompOp op();
+    std::shared_ptr<ast::BinaryExpr> condition();
+    std::vector<std::shared_ptr<ast::BinaryExpr>> opt_where_clause();
+    std::shared_ptr<ast::SetClause> set_clause();
+
+    void report_error() const;
+
+    const char *sql_;
+    SqlLexer lexer_;
+    SqlToken tok_;
+};
@@ -1,4 +1,3 @@
-
 #undef NDEBUG
 
 #include <cassert>
@@ -11,12 +10,12 @@ int main()
     for (auto &sql : sqls)
     {
         std::cout << sql << std::endl;
-        YY_BUFFER_STATE buf = yy_scan_string(sql.c_str());
-        assert(yyparse() == 0);
-        if (ast::parse_tree != nullptr)
+        SqlParser parser(sql.c_str());
+        std::shared_ptr<ast::TreeNode> parse_tree;
+        assert(parser.next(parse_tree) == 0);
+        if (parse_tree != nullptr)
         {
-            ast::TreePrinter::print(ast::parse_tree);
-            yy_delete_buffer(buf);
+            ast::TreePrinter::print(parse_tree);
             std::cout << std::endl;
         }
         else
@@ -24,6 +23,5 @@ int main()
             std::cout << "exit/EOF" << std::endl;
         }
     }
-    ast::parse_tree.reset();
     return 0;
 }
@@ -0,0 +1,381 @@
+#undef NDEBUG
+
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "parser.h"
+
+// 差分测试：同一条输入分别交给 bison 解析器和手写的 RdParser，
+// 逐条比较返回码和语法树的完整结构
+// 用法：test_rd_parser [语料目录...]，目录下所有 .sql 文件按行作为输入
+
+using namespace ast;
+
+static void dump(const std::shared_ptr<TreeNode> &node, std::ostream &os);
+
+template <typename T>
+static void dump_list(const std::vector<std::shared_ptr<T>> &nodes, std::ostream &os)
+{
+    os << '[';
+    for (auto &node : nodes)
+    {
+        dump(node, os);
+        os << ',';
+    }
+    os << ']';
+}
+
+static void dump(const std::shared_ptr<TreeNode> &node, std::ostream &os)
+{
+    if (node == nullptr)
+    {
+        os << "null";
+        return;
+    }
+    os << node->type << '(';
+    switch (node->type)
+    {
+    case TypeLenNode:
+    {
+        auto x = std::static_pointer_cast<TypeLen>(node);
+        os << x->type << ' ' << x->len;
+        break;
+    }
+    case ColDefNode:
+    {
+        auto x = std::static_pointer_cast<ColDef>(node);
+        os << x->col_name << ' ';
+        dump(x->type_len, os);
+        break;
+    }
+    case CreateTableNode:
+    {
+        auto x = std::static_pointer_cast<CreateTable>(node);
+        os << x->tab_name << ' ';
+        dump_list(x->fields, os);
+        break;
+    }
+    case DropTableNode:
+        os << std::static_pointer_cast<DropTable>(node)->tab_name;
+        break;
+    case DescTableNode:
+        os << std::static_pointer_cast<DescTable>(node)->tab_name;
+        break;
+    case DescIndexNode:
+        os << std::static_pointer_cast<DescIndex>(node)->tab_name;
+        break;
+    case AnalyzeStmtNode:
+        os << std::static_pointer_cast<AnalyzeStmt>(node)->tab_name;
+        break;
+    case CreateIndexNode:
+    case DropIndexNode:
+    {
+        auto &tab_name = node->type == CreateIndexNode ? std::static_pointer_cast<CreateIndex>(node)->tab_name : std::static_pointer_cast<DropIndex>(node)->tab_name;
+        auto &col_names = node->type == CreateIndexNode ? std::static_pointer_cast<CreateIndex>(node)->col_names : std::static_pointer_cast<DropIndex>(node)->col_names;
+        os << tab_name;
+        for (auto &col_name : col_names)
+        {
+            os << ' ' << col_name;
+        }
+        break;
+    }
+    case IoEnableNode:
+        os << std::static_pointer_cast<IoEnable>(node)->set_io_enable;
+        break;
+    case IntLitNode:
+        os << std::static_pointer_cast<IntLit>(node)->val;
+        break;
+    case FloatLitNode:
+        os << std::hexfloat << std::static_pointer_cast<FloatLit>(node)->val << std::defaultfloat;
+        break;
+    case StringLitNode:
+        os << '\'' << std::static_pointer_cast<StringLit>(node)->val << '\'';
+        break;
+    case BoolLitNode:
+        os << std::static_pointer_cast<BoolLit>(node)->val;
+        break;
+    case ColNode:
+    {
+        auto x = std::static_pointer_cast<Col>(node);
+        os << x->tab_name << '.' << x->col_name << " as " << x->alias;
+        break;
+    }
+    case AggFuncNode:
+    {
+        auto x = std::static_pointer_cast<AggFunc>(node);
+        os << x->type << ' ' << x->tab_name << '.' << x->col_name << " as " << x->alias;
+        break;
+    }
+    case SetClauseNode:
+    {
+        auto x = std::static_pointer_cast<SetClause>(node);
+        os << x->col_name << ' ' << x->op << ' ' << x->self_update << ' ';
+        dump(x->val, os);
+        break;
+    }
+    case BinaryExprNode:
+    case SubQueryExprNode:
+    {
+        auto x = std::static_pointer_cast<BinaryExpr>(node);
+        dump(x->lhs, os);
+        os << ' ' << x->op << ' ';
+        dump(x->rhs, os);
+        if (node->type == SubQueryExprNode)
+        {
+            auto sub = std::static_pointer_cast<SubQueryExpr>(node);
+            dump(sub->subquery, os);
+            dump_list(sub->vals, os);
+        }
+        break;
+    }
+    case OrderByNode:
+    {
+        auto x = std::static_pointer_cast<OrderBy>(node);
+        dump(x->cols, os);
+        os << ' ' << x->orderby_dir;
+        break;
+    }
+    case LimitNode:
+    {
+        auto x = std::static_pointer_cast<Limit>(node);
+        os << x->count << ' ' << x->offset;
+        break;
+    }
+    case HavingCauseNode:
+    {
+        auto x = std::static_pointer_cast<HavingCause>(node);
+        dump(x->lhs, os);
+        os << ' ' << x->op << ' ';
+        dump(x->rhs, os);
+        break;
+    }
+    case GroupByNode:
+    {
+        auto x = std::static_pointer_cast<GroupBy>(node);
+        dump_list(x->cols, os);
+        dump_list(x->having_conds, os);
+        break;
+    }
+    case InsertStmtNode:
+    {
+        auto x = std::static_pointer_cast<InsertStmt>(node);
+        os << x->tab_name;
+        for (auto &row : x->rows)
+        {
+            dump_list(row, os);
+        }
+        break;
+    }
+    case DeleteStmtNode:
+    {
+        auto x = std::static_pointer_cast<DeleteStmt>(node);
+        os << x->tab_name << ' ';
+        dump_list(x->conds, os);
+        break;
+    }
+    case UpdateStmtNode:
+    {
+        auto x = std::static_pointer_cast<UpdateStmt>(node);
+        os << x->tab_name << ' ';
+        dump_list(x->set_clauses, os);
+        dump_list(x->conds, os);
+        break;
+    }
+    case SelectStmtNode:
+    {
+        auto x = std::static_pointer_cast<SelectStmt>(node);
+        dump_list(x->cols, os);
+        for (auto &tab : x->tabs)
+        {
+            os << ' ' << tab;
+        }
+        dump_list(x->conds, os);
+        dump(x->group_by, os);
+        dump_list(x->order, os);
+        dump(x->limit, os);
+        os << x->has_sort << x->has_agg;
+        break;
+    }
+    case SetStmtNode:
+    {
+        auto x = std::static_pointer_cast<SetStmt>(node);
+        os << x->set_knob_type_ << ' ' << x->bool_val_ << ' ' << x->int_val_;
+        break;
+    }
+    case LoadStmtNode:
+    {
+        auto x = std::static_pointer_cast<LoadStmt>(node);
+        os << x->file_name << ' ' << x->tab_name;
+        break;
+    }
+    case PrepareStmtNode:
+    {
+        auto x = std::static_pointer_cast<PrepareStmt>(node);
+        os << x->name << ' ';
+        dump(x->stmt, os);
+        break;
+    }
+    case ExecuteStmtNode:
+    {
+        auto x = std::static_pointer_cast<ExecuteStmt>(node);
+        os << x->name << ' ';
+        dump_list(x->vals, os);
+        break;
+    }
+    default:
+        break;
+    }
+    os << ')';
+}
+
+// 依次解析输入中的所有语句，记录每一步的返回码和语法树
+template <typename Parser>
+static std::string parse_all(const std::string &sql)
+{
+    Parser parser(sql.c_str());
+    std::ostringstream os;
+    while (true)
+    {
+        std::shared_ptr<TreeNode> parse_tree;
+        int rc;
+        try
+        {
+            rc = parser.next(parse_tree);
+        }
+        catch (RMDBError &)
+        {
+            os << "RMDBError";
+            break;
+        }
+        os << rc << ':';
+        dump(parse_tree, os);
+        os << '\n';
+        if (rc != 0 || parse_tree == nullptr)
+        {
+            break;
+        }
+    }
+    return os.str();
+}
+
+static const std::vector<std::string> sqls = {
+    "select * from t;",
+    "SELECT id, t.name, score AS s FROM t WHERE id = 1 AND t.name <> 'a b' AND score >= 1.5;",
+    "select count(*), count(id) as c, sum(t.x), min(y), max(z) as m, avg(w) from t group by a, t.b having count(*) > 2 and sum(x) <= 10 order by a desc;",
+    "select a from t1, t2 join t3 where t1.a = t2.b and t2.b != t3.c order by t1.a asc;",
+    "select a from t order by a;",
+    "select a, b from t order by a desc, t.b, c asc;",
+    "select a from t order by a,;",
+    "select a from t order by a desc limit 20;",
+    "select * from t where a > 1 limit 5 offset 10;",
+    "select a from t limit;",
+    "select a from t where a in (1, 2, 3) and b not in ('x', 'y') and c = ?;",
+    "select a from t where a in (select b from s where b < 3);",
+    "select a from t where a in (delete from s);",
+    "insert into t values (1, -2, +3, 4.5, -0.25, 'str', true, FALSE);",
+    "insert into t values (1, 'a'), (2, 'b'), (3, 'c');",
+    "delete from t;",
+    "delete from t where a > -1;",
+    "update t set a = 1, b = 'x', c = c + 1, d = d - 2, e = e * 3, f = f -1, g = g 5 where id = 1;",
+    "update t1 set id=id-1;",
+    "create table t (id int, name char(20), score float, ts datetime);",
+    "create index t (a, b);",
+    "drop index t (a);",
+    "drop table t;",
+    "desc t;",
+    "show tables;",
+    "show index from t;",
+    "begin; commit; abort; rollback;",
+    "create static_checkpoint;",
+    "crash;",
+    "analyze;",
+    "ANALYZE t;",
+    "analyze t s;",
+    "load ./data/a.csv into t;",
+    "load /tmp/A.CSV into t;",
+    "set enable_nestloop = true;",
+    "set enable_sortmerge = false;",
+    "set enable_hashjoin = false;",
+    "set parallel_degree = 4;",
+    "set parallel_degree = true;",
+    "set output_file off",
+    "set output_file on;",
+    "help",
+    "help;",
+    "exit;",
+    "prepare q as select * from t where id = ? and name = ?;",
+    "prepare u as update t set a = ? where id = ?;",
+    "execute q(1, 'x');",
+    "execute q;",
+    "select a -- comment\n from t; /* block\n comment */ select b from s;",
+    "select a from t /* unterminated",
+    "select 1a from t;",
+    "select a from t where a = 1.;",
+    "select a from t where a = 1.5.3;",
+    "select a from t where a = 'unterminated;",
+    "select a from t where a = 5 / 2;",
+    "select a from t where a ! 2;",
+    "",
+    "   ",
+    ";",
+    "select from t;",
+    "select * from t where;",
+    "insert into t values ();",
+    "update t set a = b + c;",
+    "create table t ();",
+    "set x = true;",
+    "select * from t",
+    "SeLeCt * FrOm T wHeRe A = 1;",
+    "select selecta, _x from t;",
+};
+
+static int failures = 0;
+
+static void check(const std::string &sql)
+{
+    SqlParser::handwritten = false;
+    std::string expected = parse_all<SqlParser>(sql);
+    std::string actual = parse_all<RdParser>(sql);
+    if (expected != actual)
+    {
+        failures++;
+        std::cout << "MISMATCH: " << sql << "\n  bison: " << expected << "\n  rd:    " << actual << std::endl;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    size_t count = 0;
+    for (auto &sql : sqls)
+    {
+        check(sql);
+        count++;
+    }
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!std::filesystem::is_directory(argv[i]))
+        {
+            continue;
+        }
+        for (auto &entry : std::filesystem::recursive_directory_iterator(argv[i]))
+        {
+            if (entry.path().extension() != ".sql")
+            {
+                continue;
+            }
+            std::ifstream in(entry.path());
+            std::string line;
+            while (std::getline(in, line))
+            {
+                check(line);
+                count++;
+            }
+        }
+    }
+
+    std::cout << count << " inputs, " << failures << " mismatches" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -17,10 +17,13 @@ using namespace ast;
 // enable verbose syntax error message
 %define parse.error verbose
 %param {void *yyscanner}
+// 解析结果写到调用方提供的变量里，解析器本身不持有任何全局状态
+%parse-param {std::shared_ptr<ast::TreeNode> &parse_tree}
 
 // Make AST and STL types available in generated header
 %code requires {
   #include "ast.h"
+  #include "common/arena.h"
   #include <memory>
   #include <string>
   #include <vector>
@@ -39,9 +42,9 @@ using namespace ast;
 }
 
 // keywords
-%token SHOW TABLES CREATE TABLE DROP DESC INSERT INTO VALUES DELETE FROM ASC ORDER BY
-WHERE UPDATE SET SELECT INT CHAR FLOAT DATETIME INDEX AND JOIN EXIT HELP TXN_BEGIN TXN_COMMIT TXN_ABORT TXN_ROLLBACK ENABLE_NESTLOOP ENABLE_SORTMERGE STATIC_CHECKPOINT CRASH
-MAX MIN AVG COUNT SUM GROUP HAVING AS IN NOT LOAD SIGN_ADD SIGN_SUB
+%token SHOW TABLES CREATE TABLE DROP DESC INSERT INTO VALUES DELETE FROM ASC ORDER BY LIMIT OFFSET
+WHERE UPDATE SET SELECT INT CHAR FLOAT DATETIME INDEX AND JOIN EXIT HELP TXN_BEGIN TXN_COMMIT TXN_ABORT TXN_ROLLBACK ENABLE_NESTLOOP ENABLE_SORTMERGE ENABLE_HASHJOIN PARALLEL_DEGREE STATIC_CHECKPOINT CRASH
+MAX MIN AVG COUNT SUM GROUP HAVING AS IN NOT LOAD ANALYZE SIGN_ADD SIGN_SUB PREPARE EXECUTE
 // non-keywords
 %token LEQ NEQ GEQ T_EOF
 %token OUTPUT_FILE ON OFF
@@ -53,7 +56,7 @@ MAX MIN AVG COUNT SUM GROUP HAVING AS IN NOT LOAD SIGN_ADD SIGN_SUB
 %token <bool> VALUE_BOOL
 
 // specify types for non-terminal symbol
-%type <std::shared_ptr<ast::TreeNode>> stmt dbStmt ddl dml txnStmt setStmt crashStmt io_stmt
+%type <std::shared_ptr<ast::TreeNode>> stmt dbStmt ddl dml txnStmt setStmt crashStmt io_stmt prepareStmt
 %type <std::shared_ptr<ast::Field>> field
 %type <std::vector<std::shared_ptr<ast::Field>>> fieldList
 %type <std::shared_ptr<ast::TypeLen>> type
@@ -61,6 +64,7 @@ MAX MIN AVG COUNT SUM GROUP HAVING AS IN NOT LOAD SIGN_ADD SIGN_SUB
 %type <std::shared_ptr<ast::Expr>> expr
 %type <std::shared_ptr<ast::Value>> value
 %type <std::vector<std::shared_ptr<ast::Value>>> valueList
+%type <std::vector<std::vector<std::shared_ptr<ast::Value>>>> valueRows
 %type <std::string> tbName colName ALIAS fileName
 %type <std::vector<std::string>> tableList colNameList
 %type <std::shared_ptr<ast::Col>> col
@@ -73,7 +77,9 @@ MAX MIN AVG COUNT SUM GROUP HAVING AS IN NOT LOAD SIGN_ADD SIGN_SUB
 %type <std::vector<std::shared_ptr<ast::HavingCause>>> havingClause optHavingClause
 %type <std::shared_ptr<ast::HavingCause>> havingCondition
 %type <std::shared_ptr<ast::GroupBy>> optGroupByClause groupByClause
-%type <std::shared_ptr<ast::OrderBy>>  order_clause opt_order_clause
+%type <std::shared_ptr<ast::OrderBy>>  order_item
+%type <std::vector<std::shared_ptr<ast::OrderBy>>>  order_clause opt_order_clause
+%type <std::shared_ptr<ast::Limit>>  opt_limit_clause
 %type <ast::OrderByDir> opt_asc_desc
 %type <ast::SetKnobType> set_knob_type
 
@@ -86,7 +92,7 @@ start:
     }
     |   HELP
     {
-        parse_tree = std::make_shared<Help>();
+        parse_tree = make_arena_shared<Help>();
         YYACCEPT;
     }
     |   EXIT
@@ -113,109 +119,137 @@ stmt:
     |   txnStmt
     |   setStmt
     |   crashStmt
+    |   prepareStmt
     ;
 
 crashStmt:
         CRASH
     {
-        $$ = std::make_shared<CrashStmt>();
+        $$ = make_arena_shared<CrashStmt>();
+    }
+    ;
+
+prepareStmt:
+        PREPARE IDENTIFIER AS dml
+    {
+        $$ = make_arena_shared<PrepareStmt>(std::move($2), std::move($4));
+    }
+    |   EXECUTE IDENTIFIER
+    {
+        $$ = make_arena_shared<ExecuteStmt>(std::move($2), std::vector<std::shared_ptr<ast::Value>>{});
+    }
+    |   EXECUTE IDENTIFIER '(' valueList ')'
+    {
+        $$ = make_arena_shared<ExecuteStmt>(std::move($2), std::move($4));
     }
     ;
 
 txnStmt:
         TXN_BEGIN
     {
-        $$ = std::make_shared<TxnBegin>();
+        $$ = make_arena_shared<TxnBegin>();
     }
     |   TXN_COMMIT
     {
-        $$ = std::make_shared<TxnCommit>();
+        $$ = make_arena_shared<TxnCommit>();
     }
     |   TXN_ABORT
     {
-        $$ = std::make_shared<TxnAbort>();
+        $$ = make_arena_shared<TxnAbort>();
     }
     | TXN_ROLLBACK
     {
-        $$ = std::make_shared<TxnRollback>();
+        $$ = make_arena_shared<TxnRollback>();
     }
     ;
 
 dbStmt:
         SHOW TABLES
     {
-        $$ = std::make_shared<ShowTables>();
+        $$ = make_arena_shared<ShowTables>();
     }
     |   LOAD fileName INTO tbName
     {
-         $$ = std::make_shared<LoadStmt>(std::move($2), std::move($4));
+         $$ = make_arena_shared<LoadStmt>(std::move($2), std::move($4));
+    }
+    |   ANALYZE
+    {
+        $$ = make_arena_shared<AnalyzeStmt>("");
+    }
+    |   ANALYZE tbName
+    {
+        $$ = make_arena_shared<AnalyzeStmt>(std::move($2));
     }
     ;
 
 setStmt:
         SET set_knob_type '=' VALUE_BOOL
     {
-        $$ = std::make_shared<SetStmt>($2, $4);
+        $$ = make_arena_shared<SetStmt>($2, $4);
+    }
+    |   SET PARALLEL_DEGREE '=' VALUE_INT
+    {
+        $$ = make_arena_shared<SetStmt>(ParallelDegree, false, $4);
     }
     ;
 io_stmt:
         SET OUTPUT_FILE ON
     {
-        $$ = std::make_shared<IoEnable>(true);
+        $$ = make_arena_shared<IoEnable>(true);
     }
     |   SET OUTPUT_FILE OFF
     {
-        $$ = std::make_shared<IoEnable>(false);
+        $$ = make_arena_shared<IoEnable>(false);
     }
     ;
 
 ddl:
         CREATE TABLE tbName '(' fieldList ')'
     {
-        $$ = std::make_shared<CreateTable>(std::move($3), std::move($5));
+        $$ = make_arena_shared<CreateTable>(std::move($3), std::move($5));
     }
     |   DROP TABLE tbName
     {
-        $$ = std::make_shared<DropTable>(std::move($3));
+        $$ = make_arena_shared<DropTable>(std::move($3));
     }
     |   DESC tbName
     {
-        $$ = std::make_shared<DescTable>(std::move($2));
+        $$ = make_arena_shared<DescTable>(std::move($2));
     }
     |   CREATE INDEX tbName '(' colNameList ')'
     {
-        $$ = std::make_shared<CreateIndex>(std::move($3), std::move($5));
+        $$ = make_arena_shared<CreateIndex>(std::move($3), std::move($5));
     }
     |   DROP INDEX tbName '(' colNameList ')'
     {
-        $$ = std::make_shared<DropIndex>(std::move($3), std::move($5));
+        $$ = make_arena_shared<DropIndex>(std::move($3), std::move($5));
     }
     |  SHOW INDEX FROM tbName
     {
-    	$$ = std::make_shared<DescIndex>(std::move($4));
+    	$$ = make_arena_shared<DescIndex>(std::move($4));
     }
     |   CREATE STATIC_CHECKPOINT
     {
-        $$ = std::make_shared<CreateStaticCheckpoint>();
+        $$ = make_arena_shared<CreateStaticCheckpoint>();
     }
     ;
 
 dml:
-        INSERT INTO tbName VALUES '(' valueList ')'
+        INSERT INTO tbName VALUES valueRows
     {
-        $$ = std::make_shared<InsertStmt>(std::move($3), std::move($6));
+        $$ = make_arena_shared<InsertStmt>(std::move($3), std::move($5));
     }
     |   DELETE FROM tbName optWhereClause
     {
-        $$ = std::make_shared<DeleteStmt>(std::move($3), std::move($4));
+        $$ = make_arena_shared<DeleteStmt>(std::move($3), std::move($4));
     }
     |   UPDATE tbName SET setClauses optWhereClause
     {
-        $$ = std::make_shared<UpdateStmt>(std::move($2), std::move($4), std::move($5));
+        $$ = make_arena_shared<UpdateStmt>(std::move($2), std::move($4), std::move($5));
     }
-    |   SELECT selector FROM tableList optWhereClause optGroupByClause opt_order_clause
+    |   SELECT selector FROM tableList optWhereClause optGroupByClause opt_order_clause opt_limit_clause
     {
-	$$ = std::make_shared<SelectStmt>(std::move($2), std::move($4), std::move($5), std::move($6), std::move($7));
+	$$ = make_arena_shared<SelectStmt>(std::move($2), std::move($4), std::move($5), std::move($6), std::move($7), std::move($8));
     }
     ;
 
@@ -248,26 +282,26 @@ colNameList:
 field:
         colName type
     {
-        $$ = std::make_shared<ColDef>(std::move($1), std::move($2));
+        $$ = make_arena_shared<ColDef>(std::move($1), std::move($2));
     }
     ;
 
 type:
         INT
     {
-        $$ = std::make_shared<TypeLen>(SV_TYPE_INT, sizeof(int));
+        $$ = make_arena_shared<TypeLen>(SV_TYPE_INT, sizeof(int));
     }
     |   CHAR '(' VALUE_INT ')'
     {
-        $$ = std::make_shared<TypeLen>(SV_TYPE_STRING, $3);
+        $$ = make_arena_shared<TypeLen>(SV_TYPE_STRING, $3);
     }
     |   FLOAT
     {
-        $$ = std::make_shared<TypeLen>(SV_TYPE_FLOAT, sizeof(float));
+        $$ = make_arena_shared<TypeLen>(SV_TYPE_FLOAT, sizeof(float));
     }
     |   DATETIME
     {
-        $$ = std::make_shared<TypeLen>(SV_TYPE_DATETIME, 19);
+        $$ = make_arena_shared<TypeLen>(SV_TYPE_DATETIME, 19);
     }
     ;
 
@@ -284,44 +318,60 @@ valueList:
     }
     ;
 
+valueRows:
+        '(' valueList ')'
+    {
+        $$.emplace_back(std::move($2));
+    }
+    |   valueRows ',' '(' valueList ')'
+    {
+        $$ = std::move($1);
+        $$.emplace_back(std::move($4));
+    }
+    ;
+
 value:
         VALUE_INT
     {
-        $$ = std::make_shared<IntLit>(std::move($1));
+        $$ = make_arena_shared<IntLit>(std::move($1));
     }
     |   VALUE_FLOAT
     {
-        $$ = std::make_shared<FloatLit>(std::move($1));
+        $$ = make_arena_shared<FloatLit>(std::move($1));
     }
     |   VALUE_STRING
     {
-        $$ = std::make_shared<StringLit>(std::move($1));
+        $$ = make_arena_shared<StringLit>(std::move($1));
     }
     |   VALUE_BOOL
     {
-        $$ = std::make_shared<BoolLit>(std::move($1));
+        $$ = make_arena_shared<BoolLit>(std::move($1));
+    }
+    |   '?'
+    {
+        $$ = make_arena_shared<ParamLit>();
     }
     ;
 
 condition:
         col op expr
     {
-        $$ = std::make_shared<BinaryExpr>(std::move($1), $2, std::move($3));
+        $$ = make_arena_shared<BinaryExpr>(std::move($1), $2, std::move($3));
     }
     |   col op '(' dml ')'
     {
-	$$ = std::make_shared<SubQueryExpr>(std::move($1), $2, std::move($4));
+	$$ = make_arena_shared<SubQueryExpr>(std::move($1), $2, std::move($4));
     }
     |   col op '(' valueList ')'
     {
-	$$ = std::make_shared<SubQueryExpr>(std::move($1), $2, std::move($4));
+	$$ = make_arena_shared<SubQueryExpr>(std::move($1), $2, std::move($4));
     }
     ;
 
 havingCondition:
     aggFunc op expr
     {
-	$$ = std::make_shared<HavingCause>(std::move($1), $2, std::move($3));
+	$$ = make_arena_shared<HavingCause>(std::move($1), $2, std::move($3));
     }
     ;
 
@@ -352,11 +402,11 @@ whereClause:
 col:
         tbName '.' colName
     {
-        $$ = std::make_shared<Col>(std::move($1), std::move($3));
+        $$ = make_arena_shared<Col>(std::move($1), std::move($3));
     }
     |   colName
     {
-        $$ = std::make_shared<Col>("", std::move($1));
+        $$ = make_arena_shared<Col>("", std::move($1));
     }
     |   aggFunc
     {
@@ -364,7 +414,7 @@ col:
     }
     |   colName AS ALIAS
     {
-	$$ = std::make_shared<Col>("", std::move($1), std::move($3));
+	$$ = make_arena_shared<Col>("", std::move($1), std::move($3));
     }
     |   aggFunc AS ALIAS
     {
@@ -376,31 +426,31 @@ aggFunc:
         SUM '(' col ')'
     {
         auto c = std::move($3);
-        $$ = std::make_shared<AggFunc>(std::move(c->tab_name), std::move(c->col_name), AggFuncType::SUM);
+        $$ = make_arena_shared<AggFunc>(std::move(c->tab_name), std::move(c->col_name), AggFuncType::SUM);
     }
     |   MIN '(' col ')'
     {
         auto c = std::move($3);
-        $$ = std::make_shared<AggFunc>(std::move(c->tab_name), std::move(c->col_name), AggFuncType::MIN);
+        $$ = make_arena_shared<AggFunc>(std::move(c->tab_name), std::move(c->col_name), AggFuncType::MIN);
     }
     |   MAX '(' col ')'
     {
         auto c = std::move($3);
-        $$ = std::make_shared<AggFunc>(std::move(c->tab_name), std::move(c->col_name), AggFuncType::MAX);
+        $$ = make_arena_shared<AggFunc>(std::move(c->tab_name), std::move(c->col_name), AggFuncType::MAX);
     }
     |   AVG '(' col ')'
      {
          auto c = std::move($3);
-         $$ = std::make_shared<AggFunc>(std::move(c->tab_name), std::move(c->col_name), AggFuncType::AVG);
+         $$ = make_arena_shared<AggFunc>(std::move(c->tab_name), std::move(c->col_name), AggFuncType::AVG);
      }
     |   COUNT '(' col ')'
     {
         auto c = std::move($3);
-        $$ = std::make_shared<AggFunc>(std::move(c->tab_name), std::move(c->col_name), AggFuncType::COUNT);
+        $$ = make_arena_shared<AggFunc>(std::move(c->tab_name), std::move(c->col_name), AggFuncType::COUNT);
     }
     |   COUNT '(' '*' ')'
     {
-        $$ = std::make_shared<AggFunc>("", "*", AggFuncType::COUNT);
+        $$ = make_arena_shared<AggFunc>("", "*", AggFuncType::COUNT);
     }
     ;
 
@@ -433,7 +483,7 @@ optGroupByClause:
 groupByClause:
     GROUP BY colList
     {
-        $$ = std::make_shared<GroupBy>(std::move($3));
+        $$ = make_arena_shared<GroupBy>(std::move($3));
     }
     ;
 optHavingClause:
@@ -522,27 +572,27 @@ setClauses:
 setClause:
         colName '=' value
     {
-        $$ = std::make_shared<SetClause>(std::move($1), std::move($3));
+        $$ = make_arena_shared<SetClause>(std::move($1), std::move($3));
     }
     |   colName '=' colName  value
     {
-        $$ = std::make_shared<SetClause>(std::move($1), std::move($4), 4);
+        $$ = make_arena_shared<SetClause>(std::move($1), std::move($4), 4);
     }
     |   colName '=' colName SIGN_ADD value
     {
-        $$ = std::make_shared<SetClause>(std::move($1), std::move($5), 0);
+        $$ = make_arena_shared<SetClause>(std::move($1), std::move($5), 0);
     }
     |   colName '=' colName SIGN_SUB value
     {
-        $$ = std::make_shared<SetClause>(std::move($1), std::move($5), 1);
+        $$ = make_arena_shared<SetClause>(std::move($1), std::move($5), 1);
     }
     |   colName '=' colName '*' value
     {
-        $$ = std::make_shared<SetClause>(std::move($1), std::move($5), 2);
+        $$ = make_arena_shared<SetClause>(std::move($1), std::move($5), 2);
     }
     |   colName '=' colName '/' value
     {
-        $$ = std::make_shared<SetClause>(std::move($1), std::move($5), 3);
+        $$ = make_arena_shared<SetClause>(std::move($1), std::move($5), 3);
     }
     ;
 
@@ -582,17 +632,42 @@ opt_order_clause:
     }
     |   /* epsilon */ 
     { 
-        $$ = nullptr; 
     }
     ;
 
 order_clause:
+        order_item
+    {
+        $$.emplace_back(std::move($1));
+    }
+    |   order_clause ',' order_item
+    {
+        $$ = std::move($1);
+        $$.emplace_back(std::move($3));
+    }
+    ;
+
+order_item:
       col  opt_asc_desc 
     { 
-        $$ = std::make_shared<OrderBy>(std::move($1), $2);
+        $$ = make_arena_shared<OrderBy>(std::move($1), $2);
     }
     ;   
 
+opt_limit_clause:
+    LIMIT VALUE_INT
+    {
+        $$ = make_arena_shared<Limit>($2, 0);
+    }
+    |   LIMIT VALUE_INT OFFSET VALUE_INT
+    {
+        $$ = make_arena_shared<Limit>($2, $4);
+    }
+    |   /* epsilon */
+    {
+    }
+    ;
+
 opt_asc_desc:
     ASC          { $$ = OrderBy_ASC;     }
     |  DESC      { $$ = OrderBy_DESC;    }
@@ -602,6 +677,7 @@ opt_asc_desc:
 set_knob_type:
     ENABLE_NESTLOOP { $$ = EnableNestLoop; }
     |   ENABLE_SORTMERGE { $$ = EnableSortMerge; }
+    |   ENABLE_HASHJOIN { $$ = EnableHashJoin; }
     ;
 
 tbName: IDENTIFIER;
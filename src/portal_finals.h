@@ -4,6 +4,7 @@
 #include <cstring>
 #include <string>
 
+#include "common/arena.h"
 #include "common/common_finals.h"
 #include "execution/execution_group_finals.h"
 #include "execution/execution_scaler_group_finals.h"
@@ -11,8 +12,12 @@
 #include "execution/execution_sort_finals.h"
 #include "execution/executor_abstract_finals.h"
 #include "execution/executor_delete_finals.h"
+#include "execution/executor_empty_scan_finals.h"
+#include "execution/executor_hash_join_finals.h"
+#include "execution/executor_index_nestedloop_join_finals.h"
 #include "execution/executor_index_scan_finals.h"
 #include "execution/executor_insert_finals.h"
+#include "execution/executor_limit_finals.h"
 #include "execution/executor_nestedloop_join_finals.h"
 #include "execution/executor_projection_finals.h"
 #include "execution/executor_seq_scan_finals.h"
@@ -65,14 +70,15 @@ public:
             case T_Create_StaticCheckPoint:
             case T_Crash:
             case T_LoadData:
-            case T_IoEnable: {
-                return std::make_shared<PortalStmt>(PORTAL_CMD_UTILITY, std::vector<TabCol>(),
+            case T_IoEnable:
+            case T_Analyze: {
+                return make_arena_shared<PortalStmt>(PORTAL_CMD_UTILITY, std::vector<TabCol>(),
                                                     std::unique_ptr<AbstractExecutor>(), plan);
             }
 
             // SetKnobPlan tag
             case T_SetKnob: {
-                return std::make_shared<PortalStmt>(PORTAL_CMD_UTILITY, std::vector<TabCol>(),
+                return make_arena_shared<PortalStmt>(PORTAL_CMD_UTILITY, std::vector<TabCol>(),
                                                     std::unique_ptr<AbstractExecutor>(), plan);
             }
 
@@ -81,7 +87,7 @@ public:
             case T_DropTable:
             case T_CreateIndex:
             case T_DropIndex: {
-                return std::make_shared<PortalStmt>(PORTAL_MULTI_QUERY, std::vector<TabCol>(),
+                return make_arena_shared<PortalStmt>(PORTAL_MULTI_QUERY, std::vector<TabCol>(),
                                                     std::unique_ptr<AbstractExecutor>(), plan);
             }
 
@@ -90,7 +96,7 @@ public:
                 auto x = std::static_pointer_cast<DMLPlan>(plan);
                 std::shared_ptr<ProjectionPlan> p = std::static_pointer_cast<ProjectionPlan>(x->subplan_);
                 std::unique_ptr<AbstractExecutor> root = convert_plan_executor(p, context);
-                return std::make_shared<PortalStmt>(PORTAL_ONE_SELECT, std::move(p->sel_cols_), std::move(root), plan);
+                return make_arena_shared<PortalStmt>(PORTAL_ONE_SELECT, std::move(p->sel_cols_), std::move(root), plan);
             }
 
             case T_Update: {
@@ -102,7 +108,7 @@ public:
                 }
                 std::unique_ptr<AbstractExecutor> root = std::make_unique<UpdateExecutor>(
                     sm_manager_, x->tab_name_, std::move(x->set_clauses_), std::move(rids), context);
-                return std::make_shared<PortalStmt>(PORTAL_DML_WITHOUT_SELECT, std::vector<TabCol>(), std::move(root),
+                return make_arena_shared<PortalStmt>(PORTAL_DML_WITHOUT_SELECT, std::vector<TabCol>(), std::move(root),
                                                     plan);
             }
 
@@ -115,7 +121,7 @@ public:
                 }
                 std::unique_ptr<AbstractExecutor> root = std::make_unique<DeleteExecutor>(
                     sm_manager_, x->tab_name_, rids, context);
-                return std::make_shared<PortalStmt>(PORTAL_DML_WITHOUT_SELECT, std::vector<TabCol>(), std::move(root),
+                return make_arena_shared<PortalStmt>(PORTAL_DML_WITHOUT_SELECT, std::vector<TabCol>(), std::move(root),
                                                     plan);
             }
 
@@ -123,7 +129,7 @@ public:
                 auto x = std::static_pointer_cast<DMLPlan>(plan);
                 std::unique_ptr<AbstractExecutor> root = std::make_unique<InsertExecutor>(
                     sm_manager_, x->tab_name_, x->values_, context);
-                return std::make_shared<PortalStmt>(PORTAL_DML_WITHOUT_SELECT, std::vector<TabCol>(), std::move(root),
+                return make_arena_shared<PortalStmt>(PORTAL_DML_WITHOUT_SELECT, std::vector<TabCol>(), std::move(root),
                                                     plan);
             }
 
@@ -190,12 +196,16 @@ public:
                     return std::make_unique<SeqScanExecutor>(sm_manager_, x->tab_name_, x->conds_, context);
                 } else {
                     return std::make_unique<IndexScanExecutor>(sm_manager_, x->tab_name_, x->conds_, x->index_meta_,
-                                                               context);
+                                                               context, x->limit_);
                 }
             }
 
+            case T_EmptyScan:
+                return std::make_unique<EmptyScanExecutor>(sm_manager_, std::static_pointer_cast<ScanPlan>(plan)->tab_name_);
+
             case T_NestLoop:
-            case T_SortMerge: {
+            case T_SortMerge:
+            case T_HashJoin: {
                 auto x = std::static_pointer_cast<JoinPlan>(plan);
                 std::unique_ptr<AbstractExecutor> left = convert_plan_executor(x->left_, context);
                 std::unique_ptr<AbstractExecutor> right = convert_plan_executor(x->right_, context);
@@ -203,23 +213,40 @@ public:
                 if (x->tag == T_NestLoop)
                     join = std::make_unique<NestedLoopJoinExecutor>(std::move(left), std::move(right),
                                                                     std::move(x->conds_));
+                else if (x->tag == T_HashJoin)
+                    join = std::make_unique<HashJoinExecutor>(std::move(left), std::move(right), std::move(x->conds_),
+                                                              x->required_cols_);
                 else
                     join = std::make_unique<MergeJoinExecutor>(std::move(left), std::move(right), std::move(x->conds_),
                                                                x->left_join_col, x->right_join_col, x->tables);
                 return join;
             }
 
+            case T_IndexNestLoop: {
+                auto x = std::static_pointer_cast<JoinPlan>(plan);
+                auto inner = std::static_pointer_cast<ScanPlan>(x->right_);
+                return std::make_unique<IndexNestedLoopJoinExecutor>(sm_manager_, convert_plan_executor(x->left_, context),
+                                                                     inner->tab_name_, inner->conds_, inner->index_meta_,
+                                                                     std::move(x->conds_), context);
+            }
+
             case T_Sort: {
                 auto x = std::static_pointer_cast<SortPlan>(plan);
-                return std::make_unique<SortExecutor>(convert_plan_executor(x->subplan_, context), x->sel_col_);
+                return std::make_unique<SortExecutor>(convert_plan_executor(x->subplan_, context), x->keys_, context, x->limit_);
+            }
+
+            case T_Limit: {
+                auto x = std::static_pointer_cast<LimitPlan>(plan);
+                return std::make_unique<LimitExecutor>(convert_plan_executor(x->subplan_, context), x->limit_, x->offset_);
             }
 
             case T_Agg: {
                 auto x = std::static_pointer_cast<AggPlan>(plan);
-                if (x->sel_cols_.size() == 999)
-                    return std::make_unique<ScalerAggPlanExecutor>(convert_plan_executor(x->subplan_, context),
-                                                                   x->sel_cols_[0], context);
-                else
+                if (x->from_index_) {
+                    auto scan = std::static_pointer_cast<ScanPlan>(x->subplan_);
+                    return std::make_unique<ScalerAggPlanExecutor>(sm_manager_, scan->tab_name_, scan->conds_,
+                                                                   scan->index_meta_, x->sel_cols_, context);
+                } else
                     return std::make_unique<AggPlanExecutor>(convert_plan_executor(x->subplan_, context),
                                                              x->group_by_cols, x->sel_cols_, context);
             }
@@ -4,6 +4,7 @@
 #include <memory>
 #include <mutex>
 #include <unordered_set> // 鏇挎崲 vector
+#include <vector>
 
 #include "common/context_finals.h"
 #include "rm_defs_finals.h"
@@ -40,6 +41,16 @@ public:
     records_.insert(rid); // O(1) 平均复杂度
   }
 
+  // 多行插入时整批只加一次锁
+  void insert_records(const std::vector<char *> &rids) {
+    if (ban.load(std::memory_order_relaxed)) {
+      return;
+    }
+    std::lock_guard lk(mutex_);
+    records_.reserve(records_.size() + rids.size());
+    records_.insert(rids.begin(), rids.end());
+  }
+
   void delete_record(const char *rid) {
     if (ban.load(std::memory_order_relaxed)) {
       return;
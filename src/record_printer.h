@@ -26,14 +26,15 @@ public:
 
     void print_separator(Context *context) const
     {
+        auto buf = context->send_buf_;
+        char *dst = buf->reserve(num_cols * print_separator_str_len + 2);
         for (size_t i = 0; i < num_cols; i++)
         {
-            memcpy(context->data_send_ + *(context->offset_), print_separator_str, print_separator_str_len);
-            *(context->offset_) = *(context->offset_) + print_separator_str_len;
+            memcpy(dst, print_separator_str, print_separator_str_len);
+            dst += print_separator_str_len;
         }
-        std::string str = "+\n";
-        memcpy(context->data_send_ + *(context->offset_), str.c_str(), str.length());
-        *(context->offset_) = *(context->offset_) + str.length();
+        memcpy(dst, "+\n", 2);
+        buf->commit(num_cols * print_separator_str_len + 2);
     }
 
     static void print_record(const std::vector<std::string> &rec_str, Context *context)
@@ -42,10 +43,12 @@ public:
         {
             return;
         }
+        auto buf = context->send_buf_;
+        char *dst = buf->reserve(rec_str.size() * print_record_str_len + 2);
         for (const auto &col : rec_str)
         {
             // 先复制列的前缀框架
-            memcpy(context->data_send_ + *(context->offset_), print_record_str, print_record_str_len);
+            memcpy(dst, print_record_str, print_record_str_len);
             
             // 计算可用的显示宽度（减去边框字符）
             size_t available_width = print_record_str_len - 1;
@@ -58,13 +61,13 @@ public:
             
             // 右对齐显示字符串
             size_t start_pos = available_width - display_str.length();
-            memcpy(context->data_send_ + *(context->offset_) + start_pos, display_str.c_str(), display_str.length());
+            memcpy(dst + start_pos, display_str.c_str(), display_str.length());
             
-            *(context->offset_) = *(context->offset_) + print_record_str_len;
+            dst += print_record_str_len;
         }
-        std::string str = "|\n";
-        memcpy(context->data_send_ + *(context->offset_), str.c_str(), str.length());
-        *(context->offset_) = *(context->offset_) + str.length();
+        memcpy(dst, "|\n", 2);
+        buf->commit(rec_str.size() * print_record_str_len + 2);
+        buf->maybe_flush();
     }
 
     static void print_record_count(size_t num_rec, Context *context)
@@ -74,7 +77,6 @@ public:
             return;
         }
         std::string str = "Total record(s): " + std::to_string(num_rec) + '\n';
-        memcpy(context->data_send_ + *(context->offset_), str.c_str(), str.length());
-        *(context->offset_) = *(context->offset_) + str.length();
+        context->send_buf_->append(str.c_str(), str.length());
     }
 };
@@ -2,12 +2,14 @@
 
 #include <netinet/in.h>
 #include <sys/resource.h>
+#include <sys/un.h>
 #include <unistd.h>
 
 #include <atomic>
-#include <csetjmp>
+#include <cmath>
 #include <cstdlib>
 #include <iomanip>
+#include <limits>
 #include <regex>
 
 #include "analyze/analyze_finals.h"
@@ -19,11 +21,16 @@
 #include "storage/memory_pool_manager.h"
 #include "parser/parser_defs.h"
 #include "cahce/cache.h"
+#include "cahce/plan_cache.h"
+#include "common/output_log.h"
+#include "network/event_loop.h"
 
 #define SOCK_PORT 8765
 #define MAX_CONN_LIMIT 256
 
 static bool should_exit = false;
+// 非空时额外在该路径上监听 AF_UNIX 连接，本机客户端可以在其上切换到共享内存传输
+static std::string unix_socket_path;
 
 auto memory_pool_manager = std::make_unique<PoolManager>();
 auto sm_manager = std::make_unique<SmManager>(memory_pool_manager.get());
@@ -34,12 +41,9 @@ auto optimizer = std::make_unique<Optimizer>(planner.get());
 auto ql_manager = std::make_unique<QlManager>(sm_manager.get(), txn_manager.get(), planner.get());
 auto portal = std::make_unique<Portal>(sm_manager.get());
 auto analyze = std::make_unique<Analyze>(sm_manager.get());
-auto cache = std::make_unique<DBCahce>(sm_manager.get());
-
-// pthread_mutex_t *buffer_mutex;
-pthread_mutex_t *sockfd_mutex;
-
-static jmp_buf jmpbuf;
+auto cache = std::make_unique<DBCahce>(sm_manager.get(), ql_manager.get());
+auto plan_cache = std::make_unique<PlanCache>(sm_manager.get());
+auto output_log = std::make_unique<OutputLog>();
 
 int Context::MAX_OFFSET_LENGTH = BUFFER_LENGTH >> 1;
 
@@ -54,126 +58,235 @@ void SetTransaction(txn_id_t *txn_id, Context *context)
     }
 }
 
-bool run_sql_command(int &fd, int &txn_id, char *data_recv, char *data_send)
+// 出错时用错误信息替换已经生成的部分结果，output 为写入 output.txt 的内容
+static void write_error(Connection *conn, const char *msg, const char *output)
+{
+    conn->send_buf.discard();
+    conn->send_buf.append(msg, strlen(msg));
+
+    if (sm_manager->io_enabled_)
+    {
+        conn->output += output;
+    }
+}
+
+// 取出 "prepare name as" 之后到第一个 ';' 为止的语句文本
+static std::string prepared_body(const char *sql, const std::string &name)
+{
+    std::cmatch match;
+    std::regex pattern("\\bprepare\\s+" + name + "\\s+as\\s+", std::regex::icase);
+    if (!std::regex_search(sql, match, pattern))
+    {
+        throw RMDBError();
+    }
+    const char *begin = sql + match.position(0) + match.length(0);
+    const char *end = begin;
+    bool in_string = false;
+    while (*end != '\0' && (in_string || *end != ';'))
+    {
+        in_string ^= *end == '\'';
+        ++end;
+    }
+    return std::string(begin, end) + ";";
+}
+
+// 分析并优化 PREPARE 中的语句，计划保存在会话里，'?' 的类型取自对应的列
+static void prepare_statement(Connection *conn, const std::string &name, const std::shared_ptr<ast::TreeNode> &stmt,
+                              std::string sql, Context *context)
+{
+    PreparedStatement prepared;
+    prepared.sql = std::move(sql);
+    prepared.schema_version = sm_manager->schema_version_.load();
+
+    std::shared_ptr<Query> query = analyze->do_analyze(stmt);
+    query->prepared = true;
+    std::shared_ptr<Plan> plan = optimizer->plan_query(query, context);
+    if (!PlanCache::prepare(*query, plan, prepared))
+    {
+        throw RMDBError();
+    }
+    conn->prepared_stmts[name] = std::move(prepared);
+}
+
+// DDL 之后保存的计划可能已经失效，按原语句文本重新准备
+static void reprepare_statement(Connection *conn, const std::string &name, Context *context)
+{
+    std::string sql = conn->prepared_stmts[name].sql;
+    std::shared_ptr<ast::TreeNode> stmt;
+    int rc = SqlParser(sql.c_str()).next(stmt);
+    if (rc != 0 || stmt == nullptr)
+    {
+        throw RMDBError();
+    }
+    prepare_statement(conn, name, stmt, std::move(sql), context);
+}
+
+// 把 EXECUTE 的参数转换成 '?' 对应列的类型。保存的计划没有经过 QueryRewriter::fold_constants，
+// INT 列只接受能精确表示为整数的 FLOAT 值，其余跨类型的值直接拒绝，不做截断
+static Value execute_param(Value val, ColType type)
+{
+    if (val.type == type)
+    {
+        return val;
+    }
+    if (val.type == TYPE_INT && type == TYPE_FLOAT)
+    {
+        val.set_float(static_cast<float>(val.int_val));
+        return val;
+    }
+    if (val.type == TYPE_FLOAT && type == TYPE_INT)
+    {
+        double v = val.float_val;
+        if (v == std::floor(v) && v >= std::numeric_limits<int>::min() && v <= std::numeric_limits<int>::max())
+        {
+            val.set_int(static_cast<int>(v));
+            return val;
+        }
+    }
+    throw RMDBError();
+}
+
+// 按类型检查 EXECUTE 的参数，并绑定到保存的计划副本上
+static std::shared_ptr<Plan> execute_statement(Connection *conn, const ast::ExecuteStmt &stmt, Context *context)
 {
-    if (strcmp(data_recv, "exit") == 0)
+    auto it = conn->prepared_stmts.find(stmt.name);
+    if (it == conn->prepared_stmts.end())
+    {
+        throw RMDBError();
+    }
+    if (it->second.schema_version != sm_manager->schema_version_.load())
+    {
+        reprepare_statement(conn, stmt.name, context);
+        it = conn->prepared_stmts.find(stmt.name);
+    }
+    const auto &prepared = it->second;
+    if (stmt.vals.size() != prepared.placeholders.size())
+    {
+        throw RMDBError();
+    }
+    std::vector<Value> params = prepared.params;
+    for (size_t i = 0; i < stmt.vals.size(); ++i)
+    {
+        auto &param = params[prepared.placeholders[i]];
+        param = execute_param(analyze->convert_sv_value(stmt.vals[i]), param.type);
+    }
+    return PlanCache::instantiate(prepared.plan, params);
+}
+
+bool run_sql_command(Connection *conn, const char *sql)
+{
+    bool framed = conn->mode == Connection::Mode::FRAMED || conn->mode == Connection::Mode::SHM;
+    if (!framed && strcmp(sql, "exit") == 0)
     {
         return false;
     }
 
-    memset(data_send, '\0', BUFFER_LENGTH);
-    int offset = 0;
+    // 本条语句的 AST、Query、Plan 都从连接的 Arena 分配，函数返回时整体回收
+    Arena::Scope arena_scope(&conn->arena);
+
+    auto *send_buf = &conn->send_buf;
+    send_buf->reset(conn->fd, framed, conn->shm != nullptr ? &conn->shm->response() : nullptr);
+    char status = protocol::STATUS_OK;
 
-    auto *context = new Context(lock_manager.get(), nullptr, data_send, &offset);
-    SetTransaction(&txn_id, context);
-    // Prepare parser resources outside try so we can clean up safely
-    yyscan_t scanner = nullptr;
-    YY_BUFFER_STATE buf = nullptr;
+    Context statement_context(lock_manager.get(), nullptr, send_buf, &conn->output);
+    statement_context.parallel_degree_ = conn->parallel_degree;
+    auto *context = &statement_context;
+    SetTransaction(&conn->txn_id, context);
     bool parse_ok = true;
+    PlanCacheKey plan_key;
+    std::shared_ptr<Plan> cached_plan;
 
     try
     {
-        // Fast path: try cache-based execution first (use SQL input, not data_send buffer)
-        if (cache->has_cache(data_recv, context))
+        // Fast path: try cache-based execution first (use SQL input, not send buffer)
+        if (cache->has_cache(const_cast<char *>(sql), context))
+        {
+            // 命中语句模板（点查、按主键更新/删除、多行插入等），跳过解析与优化
+        }
+        else if (plan_cache->make_key(sql, plan_key) && (cached_plan = plan_cache->lookup(plan_key)) != nullptr)
         {
-            // Cache path handled the operation (e.g., INSERT). Skip parsing and go to send/commit.
+            // 计划缓存命中，直接执行重新绑定字面量后的计划
+            std::shared_ptr<PortalStmt> portalStmt = portal->start(cached_plan, context);
+            portal->run(portalStmt, ql_manager.get(), &conn->txn_id, context);
         }
         else
         {
-            yylex_init(&scanner);
-            buf = yy_scan_string(data_recv, scanner);
+            SqlParser parser(sql);
+            std::shared_ptr<ast::TreeNode> parse_tree;
 
             while (true)
             {
-                int rc = yyparse(scanner);
+                int rc = parser.next(parse_tree);
                 if (rc != 0)
                 {
                     parse_ok = false;
                     break;
                 }
                 // Parser sets parse_tree to nullptr on T_EOF or EXIT
-                if (ast::parse_tree == nullptr)
+                if (parse_tree == nullptr)
                 {
                     break;
                 }
 
+                if (parse_tree->type == ast::PrepareStmtNode)
+                {
+                    auto x = std::static_pointer_cast<ast::PrepareStmt>(parse_tree);
+                    prepare_statement(conn, x->name, x->stmt, prepared_body(sql, x->name), context);
+                    continue;
+                }
+
                 // analyze, optimize, and execute
-                std::shared_ptr<Query> query = analyze->do_analyze(ast::parse_tree);
-                std::shared_ptr<Plan> plan = optimizer->plan_query(query, context);
+                std::shared_ptr<Plan> plan;
+                if (parse_tree->type == ast::ExecuteStmtNode)
+                {
+                    plan = execute_statement(conn, *std::static_pointer_cast<ast::ExecuteStmt>(parse_tree), context);
+                }
+                else
+                {
+                    std::shared_ptr<Query> query = analyze->do_analyze(parse_tree);
+                    if (!query->placeholders.empty())
+                    {
+                        // '?' 只能出现在 PREPARE 语句中
+                        throw RMDBError();
+                    }
+                    plan = optimizer->plan_query(query, context);
+                    if (!plan_key.sql.empty())
+                    {
+                        plan_cache->insert(plan_key, *query, plan);
+                    }
+                }
                 std::shared_ptr<PortalStmt> portalStmt = portal->start(plan, context);
-                portal->run(portalStmt, ql_manager.get(), &txn_id, context);
-
-                // reset for next statement
-                ast::parse_tree = nullptr;
+                portal->run(portalStmt, ql_manager.get(), &conn->txn_id, context);
             }
         }
     }
     catch (TransactionAbortException &e)
     {
-        std::string str = "abort\n";
-        memcpy(data_send, str.c_str(), str.length());
-        data_send[str.length()] = '\0';
-        offset = str.length();
-
+        write_error(conn, "abort\n", "abort\n");
+        status = protocol::STATUS_ABORT;
         txn_manager->abort(context->txn_);
-
-        if (sm_manager->io_enabled_)
-        {
-            std::fstream outfile;
-            outfile.open("output.txt", std::ios::out | std::ios::app);
-            outfile << str;
-            outfile.close();
-        }
     }
     catch (RMDBError &e)
     {
-    // Write failure to output file if enabled
-        if (sm_manager->io_enabled_)
-        {
-            std::fstream outfile;
-            outfile.open("output.txt", std::ios::out | std::ios::app);
-            outfile << "failure\n";
-            outfile.close();
-        }
-    // Also return a generic failure line to client buffer
-    const char *msg = "failure";
-    size_t len = strlen(msg);
-    memcpy(data_send, msg, len);
-    data_send[len] = '\n';
-    data_send[len + 1] = '\0';
-    offset = static_cast<int>(len + 1);
+        write_error(conn, "failure\n", "failure\n");
+        status = protocol::STATUS_FAILURE;
     }
 
-    // cleanup scanner buffer after finishing all statements (if created)
-    if (buf != nullptr && scanner != nullptr)
-    {
-        yy_delete_buffer(buf, scanner);
-    }
-    if (scanner != nullptr)
+    if (!parse_ok)
     {
-        yylex_destroy(scanner);
+        write_error(conn, "parse error\n", "failure\n");
+        status = protocol::STATUS_PARSE_ERROR;
     }
+    conn->parallel_degree = context->parallel_degree_;
 
-    if (!parse_ok)
+    // 先提交 output.txt 的内容再回复客户端，文件中的顺序与客户端看到的完成顺序一致
+    if (!conn->output.empty())
     {
-        // mark failure in output; also return a parse error to client
-        const char *ParseError = "parse error";
-        size_t len = strlen(ParseError);
-        memcpy(data_send, ParseError, len);
-        data_send[len] = '\n';
-        data_send[len + 1] = '\0';
-        offset = static_cast<int>(len + 1);
-
-        if (sm_manager->io_enabled_)
-        {
-            std::fstream outfile;
-            outfile.open("output.txt", std::ios::out | std::ios::app);
-            outfile << "failure\n";
-            outfile.close();
-        }
+        output_log->append(std::move(conn->output));
+        conn->output.clear();
     }
 
-    if (write(fd, data_send, offset + 1) == -1)
+    if (!send_buf->finish(status))
     {
         return false;
     }
@@ -181,46 +294,179 @@ bool run_sql_command(int &fd, int &txn_id, char *data_recv, char *data_send)
     {
         txn_manager->commit(context->txn_);
     }
-    delete context;
     return true;
 }
 
-void *client_handler(void *sock_fd)
+// 旧协议：一次 recv 即一条请求，请求以 '\0' 结尾，长度不超过 BUFFER_LENGTH
+static bool serve_legacy(Connection *conn)
 {
-    int fd = *((int *)sock_fd);
-    pthread_mutex_unlock(sockfd_mutex);
+    conn->inbox[conn->inbox_size] = '\0';
+    conn->inbox_size = 0;
+    return run_sql_command(conn, conn->inbox.data());
+}
 
-    char data_recv[BUFFER_LENGTH];
-    char data_send[BUFFER_LENGTH];
-    txn_id_t txn_id = INVALID_TXN_ID;
+// 映射客户端随第一次读取传来的共享内存，成功后经套接字回复 STATUS_OK 结束帧，之后的帧都走共享内存
+static bool attach_shm(Connection *conn)
+{
+    if (conn->mode != Connection::Mode::FRAMED || conn->passed_fd < 0)
+    {
+        return false;
+    }
+    conn->shm = shm::Channel::attach(conn->passed_fd);
+    close(conn->passed_fd);
+    conn->passed_fd = -1;
+    if (conn->shm == nullptr)
+    {
+        return false;
+    }
+    conn->mode = Connection::Mode::SHM;
+    char reply[protocol::FRAME_HEADER_SIZE + 1];
+    protocol::encode_header(reply, protocol::FRAME_END, 1);
+    reply[protocol::FRAME_HEADER_SIZE] = protocol::STATUS_OK;
+    return send(conn->fd, reply, sizeof(reply), MSG_NOSIGNAL) == static_cast<ssize_t>(sizeof(reply));
+}
 
-    while (true)
+// 分帧协议：处理接收缓冲区中所有完整的帧，剩余的半帧留到下一次可读事件
+static bool serve_framed(Connection *conn)
+{
+    size_t pos = 0;
+    bool keep = true;
+    while (keep && conn->inbox_size - pos >= protocol::FRAME_HEADER_SIZE)
     {
-        memset(data_recv, 0, BUFFER_LENGTH);
-        auto i_recvBytes = read(fd, data_recv, BUFFER_LENGTH);
-        if (i_recvBytes == 0)
+        char *frame = conn->inbox.data() + pos;
+        uint32_t len = protocol::decode_length(frame);
+        if (len > protocol::MAX_FRAME_PAYLOAD)
         {
-            return nullptr;
+            return false;
         }
-        if (i_recvBytes == -1)
+        size_t frame_size = protocol::FRAME_HEADER_SIZE + len;
+        if (conn->inbox_size - pos < frame_size)
         {
-            return nullptr;
+            // 为剩余部分和结尾的 '\0' 预留空间
+            if (conn->inbox.size() < frame_size + 1)
+            {
+                memmove(conn->inbox.data(), frame, conn->inbox_size - pos);
+                conn->inbox_size -= pos;
+                pos = 0;
+                conn->inbox.resize(frame_size + 1);
+            }
+            break;
+        }
+        char type = frame[4];
+        if (type == protocol::FRAME_SHM_ATTACH)
+        {
+            if (!attach_shm(conn))
+            {
+                return false;
+            }
+            pos += frame_size;
+            continue;
         }
-        if (!run_sql_command(fd, txn_id, data_recv, data_send))
+        // 'X' 关闭连接，未知帧类型视为协议错误同样关闭
+        if (type != protocol::FRAME_QUERY)
         {
-            return nullptr;
+            return false;
         }
+        // SQL 后面紧跟下一帧（或缓冲区末尾的空闲字节），临时写入 '\0' 交给解析器，执行完再恢复
+        char *sql = frame + protocol::FRAME_HEADER_SIZE;
+        char saved = sql[len];
+        sql[len] = '\0';
+        keep = run_sql_command(conn, sql);
+        sql[len] = saved;
+        pos += frame_size;
     }
+    memmove(conn->inbox.data(), conn->inbox.data() + pos, conn->inbox_size - pos);
+    conn->inbox_size -= pos;
+    return keep;
 }
 
-void start_server()
+// 共享内存连接：套接字上只有门铃，请求帧从共享内存搬进接收缓冲区后按分帧协议处理
+static bool serve_shm(Connection *conn)
+{
+    char bells[256];
+    auto n = recv(conn->fd, bells, sizeof(bells), MSG_DONTWAIT);
+    if (n == 0 || (n == -1 && errno != EAGAIN && errno != EWOULDBLOCK))
+    {
+        return false;
+    }
+    auto &ring = conn->shm->request();
+    size_t avail = ring.readable();
+    if (avail > ring.capacity())
+    {
+        return false;
+    }
+    auto &inbox = conn->inbox;
+    if (inbox.size() < conn->inbox_size + avail + 1)
+    {
+        inbox.resize(conn->inbox_size + avail + 1);
+    }
+    conn->inbox_size += ring.read_some(inbox.data() + conn->inbox_size, avail);
+    return serve_framed(conn);
+}
+
+// 连接上的第一次读取用 recvmsg，AF_UNIX 客户端可能随 FRAME_SHM_ATTACH 传来共享内存 fd
+static ssize_t recv_first(Connection *conn, char *dst, size_t len)
 {
-    // buffer_mutex = (pthread_mutex_t *)malloc(sizeof(pthread_mutex_t));
-    sockfd_mutex = (pthread_mutex_t *)malloc(sizeof(pthread_mutex_t));
-    // pthread_mutex_init(buffer_mutex, nullptr);
-    pthread_mutex_init(sockfd_mutex, nullptr);
+    iovec iov{dst, len};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    auto n = recvmsg(conn->fd, &msg, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+    cmsghdr *cmsg = n > 0 ? CMSG_FIRSTHDR(&msg) : nullptr;
+    if (cmsg != nullptr && cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS &&
+        cmsg->cmsg_len == CMSG_LEN(sizeof(int)))
+    {
+        memcpy(&conn->passed_fd, CMSG_DATA(cmsg), sizeof(int));
+    }
+    return n;
+}
 
+// 在执行线程中处理一个就绪连接上的请求，返回 false 表示连接需要关闭
+bool serve_connection(Connection *conn)
+{
+    if (conn->mode == Connection::Mode::SHM)
+    {
+        return serve_shm(conn);
+    }
+
+    // 接收缓冲区末尾总是保留一个字节，用于给 SQL 补 '\0'
+    auto &inbox = conn->inbox;
+    if (conn->inbox_size + 1 == inbox.size())
+    {
+        inbox.resize(inbox.size() << 1);
+    }
+    char *dst = inbox.data() + conn->inbox_size;
+    size_t len = inbox.size() - 1 - conn->inbox_size;
+    auto i_recvBytes = conn->mode == Connection::Mode::UNKNOWN ? recv_first(conn, dst, len) : recv(conn->fd, dst, len, MSG_DONTWAIT);
+    if (i_recvBytes == 0)
+    {
+        return false;
+    }
+    if (i_recvBytes == -1)
+    {
+        // epoll 误唤醒时继续等待下一次可读事件
+        return errno == EAGAIN || errno == EWOULDBLOCK;
+    }
+    if (conn->mode == Connection::Mode::UNKNOWN)
+    {
+        // 分帧协议的第一个字节是长度的最高字节，总为 0
+        conn->mode = inbox[0] == '\0' ? Connection::Mode::FRAMED : Connection::Mode::LEGACY;
+    }
+    conn->inbox_size += i_recvBytes;
+    if (conn->mode == Connection::Mode::LEGACY)
+    {
+        return serve_legacy(conn);
+    }
+    return serve_framed(conn);
+}
+
+void start_server()
+{
     int sockfd_server;
+    int sockfd_unix = -1;
     int fd_temp;
     struct sockaddr_in s_addr_in;
 
@@ -245,41 +491,61 @@ void start_server()
         exit(0);
     }
 
-    while (!should_exit)
+    // 本机客户端可以改走 AF_UNIX 套接字，省去 TCP 回环协议栈的开销
+    if (!unix_socket_path.empty())
     {
-        pthread_t thread_id;
-        struct sockaddr_in s_addr_client
-        {
-        };
-        int client_length = sizeof(s_addr_client);
-
-        if (setjmp(jmpbuf))
+        sockfd_unix = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        struct sockaddr_un s_addr_un;
+        memset(&s_addr_un, 0, sizeof(s_addr_un));
+        s_addr_un.sun_family = AF_UNIX;
+        if (sockfd_unix == -1 || unix_socket_path.size() >= sizeof(s_addr_un.sun_path))
         {
-            break;
+            exit(0);
         }
-
-        pthread_mutex_lock(sockfd_mutex);
-        int sockfd = accept(sockfd_server, (struct sockaddr *)(&s_addr_client), (socklen_t *)(&client_length));
-        if (sockfd == -1)
+        memcpy(s_addr_un.sun_path, unix_socket_path.c_str(), unix_socket_path.size());
+        unlink(unix_socket_path.c_str());
+        if (bind(sockfd_unix, (struct sockaddr *)(&s_addr_un), sizeof(s_addr_un)) == -1 ||
+            listen(sockfd_unix, MAX_CONN_LIMIT) == -1)
         {
-            continue;
+            exit(0);
         }
+    }
 
-        if (pthread_create(&thread_id, nullptr, &client_handler, (void *)(&sockfd)) != 0)
-        {
-            break;
-        }
+    // 执行线程数等于核数；锁等待导致的停顿由 ExecutorPool::check_stall 临时扩容，上限为最大连接数，空闲后回落到核数
+    size_t num_workers = std::thread::hardware_concurrency();
+    EventLoop event_loop(num_workers, MAX_CONN_LIMIT, serve_connection);
+    if (!event_loop.add_listener(sockfd_server) || (sockfd_unix != -1 && !event_loop.add_listener(sockfd_unix)))
+    {
+        exit(0);
     }
+    event_loop.run(should_exit);
 }
 
 int main(int argc, char **argv)
 {
     std::string db_name = argv[1];
+    // rmdb <db_name> [--parser=handwritten|bison] [--unix-socket=<path>]
+    for (int i = 2; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--parser=handwritten") == 0)
+        {
+            SqlParser::handwritten = true;
+        }
+        else if (strcmp(argv[i], "--parser=bison") == 0)
+        {
+            SqlParser::handwritten = false;
+        }
+        else if (strncmp(argv[i], "--unix-socket=", 14) == 0)
+        {
+            unix_socket_path = argv[i] + 14;
+        }
+    }
     if (!sm_manager->is_dir(db_name))
     {
         sm_manager->create_db(db_name);
     }
     sm_manager->open_db(db_name);
+    output_log->open("output.txt");
 
     start_server();
     return 0;
@@ -4,6 +4,8 @@
 #include <unistd.h>
 
 #include <fstream>
+#include <mutex>
+#include <shared_mutex>
 
 #include "record/rm_scan_finals.h"
 #include "record_printer.h"
@@ -70,6 +72,8 @@ void SmManager::open_db(const std::string &db_name)
     std::fstream outfile;
     outfile.open("output.txt", std::ios::out | std::ios::app);
     outfile.close();
+
+    stats_.start([this] { refresh_stale_stats(); });
 }
 
 void SmManager::close_db()
@@ -79,6 +83,7 @@ void SmManager::close_db()
         throw RMDBError();
     }
 
+    stats_.stop();
     db_.name_.clear();
     db_.tabs_.clear();
 
@@ -90,11 +95,10 @@ void SmManager::close_db()
 
 void SmManager::show_tables(Context *context)
 {
-    std::fstream outfile;
+    auto &output = *context->output_;
     if (io_enabled_)
     {
-        outfile.open("output.txt", std::ios::out | std::ios::app);
-        outfile << "| Tables |\n";
+        output += "| Tables |\n";
     }
     RecordPrinter printer(1);
     printer.print_separator(context);
@@ -106,24 +110,16 @@ void SmManager::show_tables(Context *context)
         printer.print_record({tab->name_}, context);
         if (io_enabled_)
         {
-            outfile << "| " << tab->name_ << " |\n";
+            output += "| " + tab->name_ + " |\n";
         }
     }
     printer.print_separator(context);
-    if (io_enabled_)
-    {
-        outfile.close();
-    }
 }
 
 void SmManager::show_index(const std::string &tab_name, Context *context)
 {
     auto tab = db_.get_table(tab_name);
-    std::fstream outfile;
-    if (io_enabled_)
-    {
-        outfile.open("output.txt", std::ios::out | std::ios::app);
-    }
+    auto &output = *context->output_;
     RecordPrinter printer(1);
     printer.print_separator(context);
     printer.print_record({"index"}, context);
@@ -132,20 +128,16 @@ void SmManager::show_index(const std::string &tab_name, Context *context)
     {
         if (io_enabled_)
         {
-            outfile << "| " << tab->name_ << " | unique | (" << index.cols_[0].name;
+            output += "| " + tab->name_ + " | unique | (" + index.cols_[0].name;
             for (size_t i = 1; i < index.cols_.size(); ++i)
             {
-                outfile << "," << index.cols_[i].name;
+                output += "," + index.cols_[i].name;
             }
-            outfile << ") |\n";
+            output += ") |\n";
         }
         printer.print_record({get_index_name(tab_name, index.cols_)}, context);
     }
     printer.print_separator(context);
-    if (io_enabled_)
-    {
-        outfile.close();
-    }
 }
 
 void SmManager::desc_table(const std::string &tab_name, Context *context)
@@ -166,6 +158,7 @@ void SmManager::desc_table(const std::string &tab_name, Context *context)
 
 void SmManager::create_table(const std::string &tab_name, const std::vector<ColDef> &col_defs, Context *context)
 {
+    std::lock_guard lk(catalog_mutex_);
     if (db_.is_table(tab_name))
     {
         throw RMDBError();
@@ -184,19 +177,24 @@ void SmManager::create_table(const std::string &tab_name, const std::vector<ColD
     int record_size = curr_offset;
     fhs_[tab->fd_] = std::make_unique<RmFileHandle>(record_size, tab_name);
     db_.tabs_[tab_name] = std::move(tab);
+    schema_version_++;
 }
 
 void SmManager::drop_table(const std::string &tab_name, Context *context)
 {
+    std::lock_guard lk(catalog_mutex_);
     if (!db_.is_table(tab_name))
     {
         throw RMDBError();
     }
+    stats_.set(db_.get_table(tab_name)->fd_, nullptr);
     db_.tabs_.erase(tab_name);
+    schema_version_++;
 }
 
 void SmManager::create_index(const std::string &tab_name, const std::vector<std::string> &col_names, Context *context)
 {
+    std::lock_guard lk(catalog_mutex_);
     auto tab = db_.get_table(tab_name);
     if (tab->is_index(col_names))
     {
@@ -221,10 +219,12 @@ void SmManager::create_index(const std::string &tab_name, const std::vector<std:
     }
     ihs_[indexMeta.fd_] = std::move(ih);
     tab->push_back(indexMeta);
+    schema_version_++;
 }
 
 void SmManager::drop_index(const std::string &tab_name, const std::vector<std::string> &col_names, Context *context)
 {
+    std::lock_guard lk(catalog_mutex_);
     auto tab = db_.get_table(tab_name);
     if (!tab->is_index(col_names))
     {
@@ -232,6 +232,7 @@ void SmManager::drop_index(const std::string &tab_name, const std::vector<std::s
     }
     auto index_name = get_index_name(tab_name, col_names);
     tab->erase_index(index_name);
+    schema_version_++;
 }
 
 void SmManager::drop_index(const std::string &tab_name, const std::vector<ColMeta> &cols, Context *context)
@@ -256,6 +257,7 @@ void SmManager::load_csv_data(const std::string &csv_file_path, const std::strin
     // Skip the first line (header)
     std::string line;
     std::getline(file, line, '\n');
+    size_t rows = 0;
     for (;;)
     {
         std::getline(file, line, '\n');
@@ -301,7 +303,142 @@ void SmManager::load_csv_data(const std::string &csv_file_path, const std::strin
         {
             ihs_[index.fd_]->insert_entry(record_data);
         }
+        rows++;
     }
     fh_->ban=true;
+    stats_.note_modified(tab_->fd_, rows);
     file.close();
 }
+
+size_t SmManager::row_count(const TabMeta &tab) const
+{
+    auto fh = fhs_[tab.fd_].get();
+    if (fh->ban && !tab.indexes.empty())
+    {
+        auto ih = ihs_[tab.indexes.front().fd_].get();
+        std::shared_lock lk(ih->rw_mutex);
+        return ih->bp_tree_.size();
+    }
+    return fh->get_record_count();
+}
+
+std::vector<char> SmManager::snapshot_records(const TabMeta &tab) const
+{
+    auto fh = fhs_[tab.fd_].get();
+    size_t record_size = fh->record_size;
+    std::vector<char> snapshot;
+    // 持锁期间记录不会被提交的删除释放，锁内只做复制
+    auto copy = [&](auto begin, auto end, size_t rows)
+    {
+        snapshot.resize(rows * record_size);
+        char *dst = snapshot.data();
+        for (auto it = begin; it != end; ++it, dst += record_size)
+        {
+            std::memcpy(dst, *it, record_size);
+        }
+    };
+    if (fh->ban && !tab.indexes.empty())
+    {
+        auto ih = ihs_[tab.indexes.front().fd_].get();
+        std::shared_lock lk(ih->rw_mutex);
+        copy(ih->bp_tree_.begin(), ih->bp_tree_.end(), ih->bp_tree_.size());
+    }
+    else
+    {
+        std::lock_guard lk(fh->mutex_);
+        copy(fh->records_.begin(), fh->records_.end(), fh->records_.size());
+    }
+    return snapshot;
+}
+
+void SmManager::collect_stats(const std::string &tab_name)
+{
+    const TabMeta *tab;
+    std::vector<ColMeta> cols;
+    size_t record_size;
+    std::vector<char> snapshot;
+    {
+        std::lock_guard lk(catalog_mutex_);
+        if (!db_.is_table(tab_name))
+        {
+            return;
+        }
+        tab = db_.get_table(tab_name);
+        cols = tab->cols;
+        record_size = fhs_[tab->fd_]->record_size;
+        snapshot = snapshot_records(*tab);
+    }
+
+    // 不持有任何锁：在快照上计算 min/max、不同值个数和直方图
+    size_t rows = record_size == 0 ? 0 : snapshot.size() / record_size;
+    StatsManager::Builder builder(cols, rows);
+    for (size_t i = 0; i < rows; i++)
+    {
+        builder.add(snapshot.data() + i * record_size);
+    }
+    auto stats = builder.finish();
+
+    std::lock_guard lk(catalog_mutex_);
+    if (!db_.is_table(tab_name) || db_.get_table(tab_name) != tab)
+    {
+        // 收集期间表被删除或重建
+        return;
+    }
+    stats_.set(tab->fd_, std::move(stats));
+    // 代价估计变了，缓存的计划按新统计重新规划
+    schema_version_++;
+}
+
+void SmManager::analyze(const std::string &tab_name)
+{
+    if (!tab_name.empty())
+    {
+        {
+            std::lock_guard lk(catalog_mutex_);
+            if (!db_.is_table(tab_name))
+            {
+                throw RMDBError();
+            }
+        }
+        collect_stats(tab_name);
+        return;
+    }
+    for (auto &name : table_names())
+    {
+        collect_stats(name);
+    }
+}
+
+void SmManager::refresh_stale_stats()
+{
+    std::vector<std::string> stale;
+    {
+        std::lock_guard lk(catalog_mutex_);
+        for (auto &entry : db_.tabs_)
+        {
+            auto &tab = *entry.second;
+            auto stats = stats_.get(tab.fd_);
+            if (stats_.is_stale(tab.fd_, stats ? stats->rows : 0))
+            {
+                stale.push_back(entry.first);
+            }
+        }
+    }
+    // 逐表收集，每张表只在复制记录时持有 catalog_mutex_ 和表锁
+    for (auto &name : stale)
+    {
+        collect_stats(name);
+    }
+}
+
+std::vector<std::string> SmManager::table_names()
+{
+    std::lock_guard lk(catalog_mutex_);
+    std::vector<std::string> names;
+    names.reserve(db_.tabs_.size());
+    for (auto &entry : db_.tabs_)
+    {
+        names.push_back(entry.first);
+    }
+    return names;
+}
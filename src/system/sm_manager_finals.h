@@ -1,8 +1,11 @@
 #pragma once
 
+#include <atomic>
+
 #include "common/context_finals.h"
 #include "index/ix_index_handle_finals.h"
 #include "record/rm_file_handle_finals.h"
+#include "sm_stats_finals.h"
 #include "storage/memory_pool_manager.h"
 #include "../deps/parallel_hashmap/phmap.h"
 class Context;
@@ -28,6 +31,9 @@ public:
 
   bool io_enabled_ = true;
 
+  // 每次 DDL、修改优化器开关或替换统计信息时加一，缓存的执行计划版本不一致即失效
+  std::atomic<uint64_t> schema_version_{0};
+
   static bool is_dir(const std::string &db_name);
 
   void create_db(const std::string &db_name);
@@ -61,4 +67,28 @@ public:
 
   void load_csv_data(const std::string &csv_file_path,
                      const std::string &tab_name);
+
+  // 表的当前行数；records_ 停止维护（ban）时以第一个索引为准，与顺序扫描一致
+  size_t row_count(const TabMeta &tab) const;
+
+  // ANALYZE [table]：tab_name 为空时收集所有表
+  void analyze(const std::string &tab_name);
+
+  // 后台线程调用：重新收集变更行数超过阈值的表
+  void refresh_stale_stats();
+
+  // DDL 与收集统计信息互斥，避免后台线程遍历 db_.tabs_ 时表被删除
+  std::mutex catalog_mutex_;
+
+  // 后台线程会访问上面的成员，放在最后保证最先析构
+  StatsManager stats_;
+
+private:
+  // 先在 catalog_mutex_ 和表锁内复制记录，锁外构造统计信息，再确认表仍存在后替换
+  void collect_stats(const std::string &tab_name);
+
+  // 调用方持有 catalog_mutex_
+  std::vector<char> snapshot_records(const TabMeta &tab) const;
+
+  std::vector<std::string> table_names();
 };
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/value_finals.h"
+
+// 优化器使用的统计信息。ANALYZE 扫描整张表重建每列的最小/最大值、等深直方图和不同值个数（HyperLogLog 估计），
+// 之后插入/删除只累加变更行数，后台线程发现变更超过阈值的表时重新收集。
+// 统计信息建好后只读，按 fd 用 shared_ptr 原子替换，规划器读取时不加锁。
+
+// 单列统计，数值统一映射成保序的 double：字符串取前 8 字节按大端解释
+struct ColStats {
+    double min = 0;
+    double max = 0;
+    double ndv = 1;              // 不同值个数
+    std::vector<double> bounds;  // 等深直方图的桶边界，bounds.size() - 1 个桶，每桶行数相同
+
+    // 等于 v 的行占比
+    double eq_fraction(double v) const {
+        if (bounds.empty() || v < min || v > max) {
+            return 0;
+        }
+        return 1.0 / ndv;
+    }
+
+    // 小于 v 的行占比，桶内按均匀分布插值
+    double lt_fraction(double v) const {
+        if (bounds.empty() || v <= min) {
+            return 0;
+        }
+        if (v > max) {
+            return 1;
+        }
+        size_t buckets = bounds.size() - 1;
+        if (buckets == 0) {
+            return 0;
+        }
+        size_t b = std::upper_bound(bounds.begin(), bounds.end(), v) - bounds.begin();
+        b = std::min(std::max<size_t>(b, 1), buckets);
+        double lo = bounds[b - 1], hi = bounds[b];
+        double in_bucket = hi > lo ? (v - lo) / (hi - lo) : 0.5;
+        return std::min(1.0, (static_cast<double>(b - 1) + in_bucket) / static_cast<double>(buckets));
+    }
+};
+
+struct TabStats {
+    double rows = 0;
+    std::vector<ColStats> cols;  // 与 TabMeta::cols 一一对应
+};
+
+class StatsManager {
+public:
+    static constexpr size_t HISTOGRAM_BUCKETS = 64;
+    static constexpr int HLL_BITS = 10;
+    // 构造直方图的采样行数上限
+    static constexpr size_t SAMPLE_ROWS = 1 << 16;
+    static constexpr auto REFRESH_INTERVAL = std::chrono::seconds(1);
+    // 变更行数超过上次收集时行数的 STALE_FRACTION 且不少于 STALE_MIN_ROWS 行时重新收集
+    static constexpr double STALE_FRACTION = 0.2;
+    static constexpr uint64_t STALE_MIN_ROWS = 1000;
+
+    StatsManager() = default;
+
+    ~StatsManager() { stop(); }
+
+    StatsManager(const StatsManager &) = delete;
+    StatsManager &operator=(const StatsManager &) = delete;
+
+    // 列值映射为保序的 double
+    static double to_number(const char *data, const ColMeta &col) {
+        switch (col.type) {
+            case TYPE_INT: {
+                int v;
+                std::memcpy(&v, data, sizeof(int));
+                return v;
+            }
+            case TYPE_FLOAT: {
+                float v;
+                std::memcpy(&v, data, sizeof(float));
+                return v;
+            }
+            default: {
+                uint64_t v = 0;
+                size_t n = std::min<size_t>(col.len, sizeof(v));
+                for (size_t i = 0; i < sizeof(v); i++) {
+                    v = (v << 8) | (i < n ? static_cast<unsigned char>(data[i]) : 0);
+                }
+                return static_cast<double>(v);
+            }
+        }
+    }
+
+    // 逐行收集一张表的统计。add() 在持有表锁时调用，只更新 min/max、HyperLogLog 寄存器并按固定步长采样，
+    // 排序和构造直方图放到 finish() 里在锁外完成
+    class Builder {
+    public:
+        Builder(const std::vector<ColMeta> &cols, size_t rows)
+            : cols_(cols), step_(std::max<size_t>(1, rows / SAMPLE_ROWS)), samples_(cols.size()),
+              registers_(cols.size(), std::vector<uint8_t>(size_t{1} << HLL_BITS)) {
+            stats_ = std::make_shared<TabStats>();
+            stats_->cols.resize(cols.size());
+        }
+
+        void add(const char *record) {
+            bool sample = rows_ % step_ == 0;
+            for (size_t c = 0; c < cols_.size(); c++) {
+                auto &col = cols_[c];
+                const char *data = record + col.offset;
+                double v = to_number(data, col);
+                auto &col_stats = stats_->cols[c];
+                col_stats.min = rows_ == 0 ? v : std::min(col_stats.min, v);
+                col_stats.max = rows_ == 0 ? v : std::max(col_stats.max, v);
+                if (sample) {
+                    samples_[c].push_back(v);
+                }
+                uint64_t h = hash_bytes(data, col.type == TYPE_STRING ? strnlen(data, col.len) : col.len);
+                size_t idx = h >> (64 - HLL_BITS);
+                uint64_t rest = h << HLL_BITS;
+                auto rank = static_cast<uint8_t>(rest == 0 ? 64 - HLL_BITS + 1 : __builtin_clzll(rest) + 1);
+                registers_[c][idx] = std::max(registers_[c][idx], rank);
+            }
+            rows_++;
+        }
+
+        std::shared_ptr<const TabStats> finish() {
+            stats_->rows = static_cast<double>(rows_);
+            for (size_t c = 0; rows_ != 0 && c < cols_.size(); c++) {
+                auto &col_stats = stats_->cols[c];
+                auto &values = samples_[c];
+                col_stats.ndv = std::min(estimate_ndv(registers_[c]), stats_->rows);
+                std::sort(values.begin(), values.end());
+                size_t buckets = std::min(HISTOGRAM_BUCKETS, values.size());
+                col_stats.bounds.resize(buckets + 1);
+                for (size_t b = 0; b < buckets; b++) {
+                    col_stats.bounds[b] = values[b * values.size() / buckets];
+                }
+                col_stats.bounds.front() = col_stats.min;
+                col_stats.bounds.back() = col_stats.max;
+            }
+            return std::move(stats_);
+        }
+
+    private:
+        const std::vector<ColMeta> &cols_;
+        size_t step_;
+        size_t rows_ = 0;
+        std::vector<std::vector<double>> samples_;
+        std::vector<std::vector<uint8_t>> registers_;
+        std::shared_ptr<TabStats> stats_;
+    };
+
+    std::shared_ptr<const TabStats> get(int fd) const { return std::atomic_load(&slots_[fd].stats); }
+
+    void set(int fd, std::shared_ptr<const TabStats> stats) {
+        slots_[fd].modified.store(0, std::memory_order_relaxed);
+        std::atomic_store(&slots_[fd].stats, std::move(stats));
+    }
+
+    void note_modified(int fd, size_t rows) { slots_[fd].modified.fetch_add(rows, std::memory_order_relaxed); }
+
+    // 自上次收集以来变更的行数是否已经足以让统计信息失真
+    bool is_stale(int fd, double rows) const {
+        auto modified = slots_[fd].modified.load(std::memory_order_relaxed);
+        return modified >= STALE_MIN_ROWS && static_cast<double>(modified) >= rows * STALE_FRACTION;
+    }
+
+    // 后台线程每 REFRESH_INTERVAL 调用一次 refresh
+    void start(std::function<void()> refresh) {
+        if (worker_.joinable()) {
+            return;
+        }
+        stop_ = false;
+        worker_ = std::thread([this, refresh = std::move(refresh)] {
+            std::unique_lock lk(mutex_);
+            while (!cv_.wait_for(lk, REFRESH_INTERVAL, [this] { return stop_; })) {
+                lk.unlock();
+                refresh();
+                lk.lock();
+            }
+        });
+    }
+
+    void stop() {
+        if (!worker_.joinable()) {
+            return;
+        }
+        {
+            std::lock_guard lk(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_one();
+        worker_.join();
+    }
+
+private:
+    struct Slot {
+        std::shared_ptr<const TabStats> stats;
+        std::atomic<uint64_t> modified{0};
+    };
+
+    static uint64_t hash_bytes(const char *data, size_t len) {
+        uint64_t h = 1469598103934665603ULL;
+        for (size_t i = 0; i < len; i++) {
+            h = (h ^ static_cast<unsigned char>(data[i])) * 1099511628211ULL;
+        }
+        // FNV 的高位分布不够均匀，再做一次 murmur3 的 fmix64
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    static double estimate_ndv(const std::vector<uint8_t> &registers) {
+        const double m = static_cast<double>(registers.size());
+        double sum = 0;
+        size_t zeros = 0;
+        for (auto r : registers) {
+            sum += std::ldexp(1.0, -r);
+            zeros += r == 0;
+        }
+        double estimate = 0.7213 / (1 + 1.079 / m) * m * m / sum;
+        // 基数较小时用线性计数修正
+        if (estimate <= 2.5 * m && zeros != 0) {
+            estimate = m * std::log(m / static_cast<double>(zeros));
+        }
+        return std::max(estimate, 1.0);
+    }
+
+    Slot slots_[MAX_TABLE_NUMBER];
+
+    std::thread worker_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stop_ = false;
+};
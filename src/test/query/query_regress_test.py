@@ -0,0 +1,81 @@
+import os;
+import sys;
+import time;
+# test : query regression
+# 每个用例为 query_sql/<name>_test.sql 与 query_sql/<name>_answer.txt，
+# 用例中有 ORDER BY / LIMIT，输出按行逐一比较，顺序也必须一致
+TESTS = ["limit_query", "plan_cache_query", "join_batch_query", "prepare_query", "order_query", "minmax_query"]
+
+# current dir is root/build
+def get_test_name(name):
+    return "../src/test/query/query_sql/"+name+"_test.sql"
+
+def get_output_name(name):
+    return "../src/test/query/query_sql/"+name+"_answer.txt"
+
+def read_lines(path):
+    lines = []
+    hand = open(path,"r")
+    for line in hand :
+        line = line.strip('\n')
+        if line == "":
+            continue
+        lines.append(line)
+    hand.close()
+    return lines
+
+def build():
+    # change dir to root
+    os.chdir("../../../")
+    if os.path.exists("./build"):
+        os.system("rm -rf build")
+    os.mkdir("./build")
+    os.chdir("./build")
+    os.system("cmake ..")
+    os.system("make rmdb -j4")
+    os.system("make query_test -j4")
+    os.chdir("..")
+
+
+def run(names):
+    # dir is root/build
+    os.chdir("./build")
+    failed = 0
+
+    for name in names:
+        database_name = "query_test_db"
+        if os.path.exists(database_name):
+            os.system("rm -rf " + database_name)
+
+        os.system("./bin/rmdb " + database_name + "&")
+        # The server takes a few seconds to establish the connection, so the client should wait for a while.
+        time.sleep(3)
+        ret = os.system("./bin/query_test " + get_test_name(name))
+        if(ret != 0):
+            print("Error. Stopping")
+            exit(1)
+
+        expected = read_lines(get_output_name(name))
+        actual = read_lines(database_name + "/output.txt")
+        if expected == actual :
+            print('In query regression test '+name,'passed')
+        else :
+            failed += 1
+            for i in range(max(len(expected), len(actual))):
+                want = expected[i] if i < len(expected) else "<none>"
+                got = actual[i] if i < len(actual) else "<none>"
+                if want != got:
+                    print('In query regression test '+name,'Mismatch at line '+str(i+1)+': expected "'+want+'", got "'+got+'"')
+                    break
+        # close server
+        os.system("ps -ef | grep rmdb | grep -v grep | awk '{print $2}' | xargs kill -9")
+        os.system("rm -rf ./" + database_name)
+
+    os.chdir("../../")
+    print("failed: " + str(failed) + "/" + str(len(names)))
+    if failed != 0:
+        exit(1)
+
+if __name__ == "__main__":
+    build()
+    run(sys.argv[1:] if len(sys.argv) > 1 else TESTS)
@@ -0,0 +1,134 @@
+create table a (id int, k int);
+create table b (id int, v int);
+create table c (k int, w int);
+create table d (k int, w int);
+create index a(id);
+create index b(id);
+insert into a values (0, 0), (1, 1), (2, 2), (3, 3), (4, 4), (5, 5), (6, 6), (7, 7), (8, 8), (9, 9), (10, 0), (11, 1), (12, 2), (13, 3), (14, 4), (15, 5), (16, 6), (17, 7), (18, 8), (19, 9), (20, 0), (21, 1), (22, 2), (23, 3), (24, 4), (25, 5), (26, 6), (27, 7), (28, 8), (29, 9), (30, 0), (31, 1), (32, 2), (33, 3), (34, 4), (35, 5), (36, 6), (37, 7), (38, 8), (39, 9), (40, 0), (41, 1), (42, 2), (43, 3), (44, 4), (45, 5), (46, 6), (47, 7), (48, 8), (49, 9);
+insert into a values (50, 0), (51, 1), (52, 2), (53, 3), (54, 4), (55, 5), (56, 6), (57, 7), (58, 8), (59, 9), (60, 0), (61, 1), (62, 2), (63, 3), (64, 4), (65, 5), (66, 6), (67, 7), (68, 8), (69, 9), (70, 0), (71, 1), (72, 2), (73, 3), (74, 4), (75, 5), (76, 6), (77, 7), (78, 8), (79, 9), (80, 0), (81, 1), (82, 2), (83, 3), (84, 4), (85, 5), (86, 6), (87, 7), (88, 8), (89, 9), (90, 0), (91, 1), (92, 2), (93, 3), (94, 4), (95, 5), (96, 6), (97, 7), (98, 8), (99, 9);
+insert into a values (100, 0), (101, 1), (102, 2), (103, 3), (104, 4), (105, 5), (106, 6), (107, 7), (108, 8), (109, 9), (110, 0), (111, 1), (112, 2), (113, 3), (114, 4), (115, 5), (116, 6), (117, 7), (118, 8), (119, 9), (120, 0), (121, 1), (122, 2), (123, 3), (124, 4), (125, 5), (126, 6), (127, 7), (128, 8), (129, 9), (130, 0), (131, 1), (132, 2), (133, 3), (134, 4), (135, 5), (136, 6), (137, 7), (138, 8), (139, 9), (140, 0), (141, 1), (142, 2), (143, 3), (144, 4), (145, 5), (146, 6), (147, 7), (148, 8), (149, 9);
+insert into a values (150, 0), (151, 1), (152, 2), (153, 3), (154, 4), (155, 5), (156, 6), (157, 7), (158, 8), (159, 9), (160, 0), (161, 1), (162, 2), (163, 3), (164, 4), (165, 5), (166, 6), (167, 7), (168, 8), (169, 9), (170, 0), (171, 1), (172, 2), (173, 3), (174, 4), (175, 5), (176, 6), (177, 7), (178, 8), (179, 9), (180, 0), (181, 1), (182, 2), (183, 3), (184, 4), (185, 5), (186, 6), (187, 7), (188, 8), (189, 9), (190, 0), (191, 1), (192, 2), (193, 3), (194, 4), (195, 5), (196, 6), (197, 7), (198, 8), (199, 9);
+insert into a values (200, 0), (201, 1), (202, 2), (203, 3), (204, 4), (205, 5), (206, 6), (207, 7), (208, 8), (209, 9), (210, 0), (211, 1), (212, 2), (213, 3), (214, 4), (215, 5), (216, 6), (217, 7), (218, 8), (219, 9), (220, 0), (221, 1), (222, 2), (223, 3), (224, 4), (225, 5), (226, 6), (227, 7), (228, 8), (229, 9), (230, 0), (231, 1), (232, 2), (233, 3), (234, 4), (235, 5), (236, 6), (237, 7), (238, 8), (239, 9), (240, 0), (241, 1), (242, 2), (243, 3), (244, 4), (245, 5), (246, 6), (247, 7), (248, 8), (249, 9);
+insert into a values (250, 0), (251, 1), (252, 2), (253, 3), (254, 4), (255, 5), (256, 6), (257, 7), (258, 8), (259, 9), (260, 0), (261, 1), (262, 2), (263, 3), (264, 4), (265, 5), (266, 6), (267, 7), (268, 8), (269, 9), (270, 0), (271, 1), (272, 2), (273, 3), (274, 4), (275, 5), (276, 6), (277, 7), (278, 8), (279, 9), (280, 0), (281, 1), (282, 2), (283, 3), (284, 4), (285, 5), (286, 6), (287, 7), (288, 8), (289, 9), (290, 0), (291, 1), (292, 2), (293, 3), (294, 4), (295, 5), (296, 6), (297, 7), (298, 8), (299, 9);
+insert into a values (300, 0), (301, 1), (302, 2), (303, 3), (304, 4), (305, 5), (306, 6), (307, 7), (308, 8), (309, 9), (310, 0), (311, 1), (312, 2), (313, 3), (314, 4), (315, 5), (316, 6), (317, 7), (318, 8), (319, 9), (320, 0), (321, 1), (322, 2), (323, 3), (324, 4), (325, 5), (326, 6), (327, 7), (328, 8), (329, 9), (330, 0), (331, 1), (332, 2), (333, 3), (334, 4), (335, 5), (336, 6), (337, 7), (338, 8), (339, 9), (340, 0), (341, 1), (342, 2), (343, 3), (344, 4), (345, 5), (346, 6), (347, 7), (348, 8), (349, 9);
+insert into a values (350, 0), (351, 1), (352, 2), (353, 3), (354, 4), (355, 5), (356, 6), (357, 7), (358, 8), (359, 9), (360, 0), (361, 1), (362, 2), (363, 3), (364, 4), (365, 5), (366, 6), (367, 7), (368, 8), (369, 9), (370, 0), (371, 1), (372, 2), (373, 3), (374, 4), (375, 5), (376, 6), (377, 7), (378, 8), (379, 9), (380, 0), (381, 1), (382, 2), (383, 3), (384, 4), (385, 5), (386, 6), (387, 7), (388, 8), (389, 9), (390, 0), (391, 1), (392, 2), (393, 3), (394, 4), (395, 5), (396, 6), (397, 7), (398, 8), (399, 9);
+insert into a values (400, 0), (401, 1), (402, 2), (403, 3), (404, 4), (405, 5), (406, 6), (407, 7), (408, 8), (409, 9), (410, 0), (411, 1), (412, 2), (413, 3), (414, 4), (415, 5), (416, 6), (417, 7), (418, 8), (419, 9), (420, 0), (421, 1), (422, 2), (423, 3), (424, 4), (425, 5), (426, 6), (427, 7), (428, 8), (429, 9), (430, 0), (431, 1), (432, 2), (433, 3), (434, 4), (435, 5), (436, 6), (437, 7), (438, 8), (439, 9), (440, 0), (441, 1), (442, 2), (443, 3), (444, 4), (445, 5), (446, 6), (447, 7), (448, 8), (449, 9);
+insert into a values (450, 0), (451, 1), (452, 2), (453, 3), (454, 4), (455, 5), (456, 6), (457, 7), (458, 8), (459, 9), (460, 0), (461, 1), (462, 2), (463, 3), (464, 4), (465, 5), (466, 6), (467, 7), (468, 8), (469, 9), (470, 0), (471, 1), (472, 2), (473, 3), (474, 4), (475, 5), (476, 6), (477, 7), (478, 8), (479, 9), (480, 0), (481, 1), (482, 2), (483, 3), (484, 4), (485, 5), (486, 6), (487, 7), (488, 8), (489, 9), (490, 0), (491, 1), (492, 2), (493, 3), (494, 4), (495, 5), (496, 6), (497, 7), (498, 8), (499, 9);
+insert into a values (500, 0), (501, 1), (502, 2), (503, 3), (504, 4), (505, 5), (506, 6), (507, 7), (508, 8), (509, 9), (510, 0), (511, 1), (512, 2), (513, 3), (514, 4), (515, 5), (516, 6), (517, 7), (518, 8), (519, 9), (520, 0), (521, 1), (522, 2), (523, 3), (524, 4), (525, 5), (526, 6), (527, 7), (528, 8), (529, 9), (530, 0), (531, 1), (532, 2), (533, 3), (534, 4), (535, 5), (536, 6), (537, 7), (538, 8), (539, 9), (540, 0), (541, 1), (542, 2), (543, 3), (544, 4), (545, 5), (546, 6), (547, 7), (548, 8), (549, 9);
+insert into a values (550, 0), (551, 1), (552, 2), (553, 3), (554, 4), (555, 5), (556, 6), (557, 7), (558, 8), (559, 9), (560, 0), (561, 1), (562, 2), (563, 3), (564, 4), (565, 5), (566, 6), (567, 7), (568, 8), (569, 9), (570, 0), (571, 1), (572, 2), (573, 3), (574, 4), (575, 5), (576, 6), (577, 7), (578, 8), (579, 9), (580, 0), (581, 1), (582, 2), (583, 3), (584, 4), (585, 5), (586, 6), (587, 7), (588, 8), (589, 9), (590, 0), (591, 1), (592, 2), (593, 3), (594, 4), (595, 5), (596, 6), (597, 7), (598, 8), (599, 9);
+insert into a values (600, 0), (601, 1), (602, 2), (603, 3), (604, 4), (605, 5), (606, 6), (607, 7), (608, 8), (609, 9), (610, 0), (611, 1), (612, 2), (613, 3), (614, 4), (615, 5), (616, 6), (617, 7), (618, 8), (619, 9), (620, 0), (621, 1), (622, 2), (623, 3), (624, 4), (625, 5), (626, 6), (627, 7), (628, 8), (629, 9), (630, 0), (631, 1), (632, 2), (633, 3), (634, 4), (635, 5), (636, 6), (637, 7), (638, 8), (639, 9), (640, 0), (641, 1), (642, 2), (643, 3), (644, 4), (645, 5), (646, 6), (647, 7), (648, 8), (649, 9);
+insert into a values (650, 0), (651, 1), (652, 2), (653, 3), (654, 4), (655, 5), (656, 6), (657, 7), (658, 8), (659, 9), (660, 0), (661, 1), (662, 2), (663, 3), (664, 4), (665, 5), (666, 6), (667, 7), (668, 8), (669, 9), (670, 0), (671, 1), (672, 2), (673, 3), (674, 4), (675, 5), (676, 6), (677, 7), (678, 8), (679, 9), (680, 0), (681, 1), (682, 2), (683, 3), (684, 4), (685, 5), (686, 6), (687, 7), (688, 8), (689, 9), (690, 0), (691, 1), (692, 2), (693, 3), (694, 4), (695, 5), (696, 6), (697, 7), (698, 8), (699, 9);
+insert into a values (700, 0), (701, 1), (702, 2), (703, 3), (704, 4), (705, 5), (706, 6), (707, 7), (708, 8), (709, 9), (710, 0), (711, 1), (712, 2), (713, 3), (714, 4), (715, 5), (716, 6), (717, 7), (718, 8), (719, 9), (720, 0), (721, 1), (722, 2), (723, 3), (724, 4), (725, 5), (726, 6), (727, 7), (728, 8), (729, 9), (730, 0), (731, 1), (732, 2), (733, 3), (734, 4), (735, 5), (736, 6), (737, 7), (738, 8), (739, 9), (740, 0), (741, 1), (742, 2), (743, 3), (744, 4), (745, 5), (746, 6), (747, 7), (748, 8), (749, 9);
+insert into a values (750, 0), (751, 1), (752, 2), (753, 3), (754, 4), (755, 5), (756, 6), (757, 7), (758, 8), (759, 9), (760, 0), (761, 1), (762, 2), (763, 3), (764, 4), (765, 5), (766, 6), (767, 7), (768, 8), (769, 9), (770, 0), (771, 1), (772, 2), (773, 3), (774, 4), (775, 5), (776, 6), (777, 7), (778, 8), (779, 9), (780, 0), (781, 1), (782, 2), (783, 3), (784, 4), (785, 5), (786, 6), (787, 7), (788, 8), (789, 9), (790, 0), (791, 1), (792, 2), (793, 3), (794, 4), (795, 5), (796, 6), (797, 7), (798, 8), (799, 9);
+insert into a values (800, 0), (801, 1), (802, 2), (803, 3), (804, 4), (805, 5), (806, 6), (807, 7), (808, 8), (809, 9), (810, 0), (811, 1), (812, 2), (813, 3), (814, 4), (815, 5), (816, 6), (817, 7), (818, 8), (819, 9), (820, 0), (821, 1), (822, 2), (823, 3), (824, 4), (825, 5), (826, 6), (827, 7), (828, 8), (829, 9), (830, 0), (831, 1), (832, 2), (833, 3), (834, 4), (835, 5), (836, 6), (837, 7), (838, 8), (839, 9), (840, 0), (841, 1), (842, 2), (843, 3), (844, 4), (845, 5), (846, 6), (847, 7), (848, 8), (849, 9);
+insert into a values (850, 0), (851, 1), (852, 2), (853, 3), (854, 4), (855, 5), (856, 6), (857, 7), (858, 8), (859, 9), (860, 0), (861, 1), (862, 2), (863, 3), (864, 4), (865, 5), (866, 6), (867, 7), (868, 8), (869, 9), (870, 0), (871, 1), (872, 2), (873, 3), (874, 4), (875, 5), (876, 6), (877, 7), (878, 8), (879, 9), (880, 0), (881, 1), (882, 2), (883, 3), (884, 4), (885, 5), (886, 6), (887, 7), (888, 8), (889, 9), (890, 0), (891, 1), (892, 2), (893, 3), (894, 4), (895, 5), (896, 6), (897, 7), (898, 8), (899, 9);
+insert into a values (900, 0), (901, 1), (902, 2), (903, 3), (904, 4), (905, 5), (906, 6), (907, 7), (908, 8), (909, 9), (910, 0), (911, 1), (912, 2), (913, 3), (914, 4), (915, 5), (916, 6), (917, 7), (918, 8), (919, 9), (920, 0), (921, 1), (922, 2), (923, 3), (924, 4), (925, 5), (926, 6), (927, 7), (928, 8), (929, 9), (930, 0), (931, 1), (932, 2), (933, 3), (934, 4), (935, 5), (936, 6), (937, 7), (938, 8), (939, 9), (940, 0), (941, 1), (942, 2), (943, 3), (944, 4), (945, 5), (946, 6), (947, 7), (948, 8), (949, 9);
+insert into a values (950, 0), (951, 1), (952, 2), (953, 3), (954, 4), (955, 5), (956, 6), (957, 7), (958, 8), (959, 9), (960, 0), (961, 1), (962, 2), (963, 3), (964, 4), (965, 5), (966, 6), (967, 7), (968, 8), (969, 9), (970, 0), (971, 1), (972, 2), (973, 3), (974, 4), (975, 5), (976, 6), (977, 7), (978, 8), (979, 9), (980, 0), (981, 1), (982, 2), (983, 3), (984, 4), (985, 5), (986, 6), (987, 7), (988, 8), (989, 9), (990, 0), (991, 1), (992, 2), (993, 3), (994, 4), (995, 5), (996, 6), (997, 7), (998, 8), (999, 9);
+insert into a values (1000, 0), (1001, 1), (1002, 2), (1003, 3), (1004, 4), (1005, 5), (1006, 6), (1007, 7), (1008, 8), (1009, 9), (1010, 0), (1011, 1), (1012, 2), (1013, 3), (1014, 4), (1015, 5), (1016, 6), (1017, 7), (1018, 8), (1019, 9), (1020, 0), (1021, 1), (1022, 2), (1023, 3), (1024, 4), (1025, 5), (1026, 6), (1027, 7), (1028, 8), (1029, 9), (1030, 0), (1031, 1), (1032, 2), (1033, 3), (1034, 4), (1035, 5), (1036, 6), (1037, 7), (1038, 8), (1039, 9), (1040, 0), (1041, 1), (1042, 2), (1043, 3), (1044, 4), (1045, 5), (1046, 6), (1047, 7), (1048, 8), (1049, 9);
+insert into a values (1050, 0), (1051, 1), (1052, 2), (1053, 3), (1054, 4), (1055, 5), (1056, 6), (1057, 7), (1058, 8), (1059, 9), (1060, 0), (1061, 1), (1062, 2), (1063, 3), (1064, 4), (1065, 5), (1066, 6), (1067, 7), (1068, 8), (1069, 9), (1070, 0), (1071, 1), (1072, 2), (1073, 3), (1074, 4), (1075, 5), (1076, 6), (1077, 7), (1078, 8), (1079, 9), (1080, 0), (1081, 1), (1082, 2), (1083, 3), (1084, 4), (1085, 5), (1086, 6), (1087, 7), (1088, 8), (1089, 9), (1090, 0), (1091, 1), (1092, 2), (1093, 3), (1094, 4), (1095, 5), (1096, 6), (1097, 7), (1098, 8), (1099, 9);
+insert into a values (1100, 0), (1101, 1), (1102, 2), (1103, 3), (1104, 4), (1105, 5), (1106, 6), (1107, 7), (1108, 8), (1109, 9), (1110, 0), (1111, 1), (1112, 2), (1113, 3), (1114, 4), (1115, 5), (1116, 6), (1117, 7), (1118, 8), (1119, 9), (1120, 0), (1121, 1), (1122, 2), (1123, 3), (1124, 4), (1125, 5), (1126, 6), (1127, 7), (1128, 8), (1129, 9), (1130, 0), (1131, 1), (1132, 2), (1133, 3), (1134, 4), (1135, 5), (1136, 6), (1137, 7), (1138, 8), (1139, 9), (1140, 0), (1141, 1), (1142, 2), (1143, 3), (1144, 4), (1145, 5), (1146, 6), (1147, 7), (1148, 8), (1149, 9);
+insert into a values (1150, 0), (1151, 1), (1152, 2), (1153, 3), (1154, 4), (1155, 5), (1156, 6), (1157, 7), (1158, 8), (1159, 9), (1160, 0), (1161, 1), (1162, 2), (1163, 3), (1164, 4), (1165, 5), (1166, 6), (1167, 7), (1168, 8), (1169, 9), (1170, 0), (1171, 1), (1172, 2), (1173, 3), (1174, 4), (1175, 5), (1176, 6), (1177, 7), (1178, 8), (1179, 9), (1180, 0), (1181, 1), (1182, 2), (1183, 3), (1184, 4), (1185, 5), (1186, 6), (1187, 7), (1188, 8), (1189, 9), (1190, 0), (1191, 1), (1192, 2), (1193, 3), (1194, 4), (1195, 5), (1196, 6), (1197, 7), (1198, 8), (1199, 9);
+insert into a values (1200, 0), (1201, 1), (1202, 2), (1203, 3), (1204, 4), (1205, 5), (1206, 6), (1207, 7), (1208, 8), (1209, 9), (1210, 0), (1211, 1), (1212, 2), (1213, 3), (1214, 4), (1215, 5), (1216, 6), (1217, 7), (1218, 8), (1219, 9), (1220, 0), (1221, 1), (1222, 2), (1223, 3), (1224, 4), (1225, 5), (1226, 6), (1227, 7), (1228, 8), (1229, 9), (1230, 0), (1231, 1), (1232, 2), (1233, 3), (1234, 4), (1235, 5), (1236, 6), (1237, 7), (1238, 8), (1239, 9), (1240, 0), (1241, 1), (1242, 2), (1243, 3), (1244, 4), (1245, 5), (1246, 6), (1247, 7), (1248, 8), (1249, 9);
+insert into a values (1250, 0), (1251, 1), (1252, 2), (1253, 3), (1254, 4), (1255, 5), (1256, 6), (1257, 7), (1258, 8), (1259, 9), (1260, 0), (1261, 1), (1262, 2), (1263, 3), (1264, 4), (1265, 5), (1266, 6), (1267, 7), (1268, 8), (1269, 9), (1270, 0), (1271, 1), (1272, 2), (1273, 3), (1274, 4), (1275, 5), (1276, 6), (1277, 7), (1278, 8), (1279, 9), (1280, 0), (1281, 1), (1282, 2), (1283, 3), (1284, 4), (1285, 5), (1286, 6), (1287, 7), (1288, 8), (1289, 9), (1290, 0), (1291, 1), (1292, 2), (1293, 3), (1294, 4), (1295, 5), (1296, 6), (1297, 7), (1298, 8), (1299, 9);
+insert into a values (1300, 0), (1301, 1), (1302, 2), (1303, 3), (1304, 4), (1305, 5), (1306, 6), (1307, 7), (1308, 8), (1309, 9), (1310, 0), (1311, 1), (1312, 2), (1313, 3), (1314, 4), (1315, 5), (1316, 6), (1317, 7), (1318, 8), (1319, 9), (1320, 0), (1321, 1), (1322, 2), (1323, 3), (1324, 4), (1325, 5), (1326, 6), (1327, 7), (1328, 8), (1329, 9), (1330, 0), (1331, 1), (1332, 2), (1333, 3), (1334, 4), (1335, 5), (1336, 6), (1337, 7), (1338, 8), (1339, 9), (1340, 0), (1341, 1), (1342, 2), (1343, 3), (1344, 4), (1345, 5), (1346, 6), (1347, 7), (1348, 8), (1349, 9);
+insert into a values (1350, 0), (1351, 1), (1352, 2), (1353, 3), (1354, 4), (1355, 5), (1356, 6), (1357, 7), (1358, 8), (1359, 9), (1360, 0), (1361, 1), (1362, 2), (1363, 3), (1364, 4), (1365, 5), (1366, 6), (1367, 7), (1368, 8), (1369, 9), (1370, 0), (1371, 1), (1372, 2), (1373, 3), (1374, 4), (1375, 5), (1376, 6), (1377, 7), (1378, 8), (1379, 9), (1380, 0), (1381, 1), (1382, 2), (1383, 3), (1384, 4), (1385, 5), (1386, 6), (1387, 7), (1388, 8), (1389, 9), (1390, 0), (1391, 1), (1392, 2), (1393, 3), (1394, 4), (1395, 5), (1396, 6), (1397, 7), (1398, 8), (1399, 9);
+insert into a values (1400, 0), (1401, 1), (1402, 2), (1403, 3), (1404, 4), (1405, 5), (1406, 6), (1407, 7), (1408, 8), (1409, 9), (1410, 0), (1411, 1), (1412, 2), (1413, 3), (1414, 4), (1415, 5), (1416, 6), (1417, 7), (1418, 8), (1419, 9), (1420, 0), (1421, 1), (1422, 2), (1423, 3), (1424, 4), (1425, 5), (1426, 6), (1427, 7), (1428, 8), (1429, 9), (1430, 0), (1431, 1), (1432, 2), (1433, 3), (1434, 4), (1435, 5), (1436, 6), (1437, 7), (1438, 8), (1439, 9), (1440, 0), (1441, 1), (1442, 2), (1443, 3), (1444, 4), (1445, 5), (1446, 6), (1447, 7), (1448, 8), (1449, 9);
+insert into a values (1450, 0), (1451, 1), (1452, 2), (1453, 3), (1454, 4), (1455, 5), (1456, 6), (1457, 7), (1458, 8), (1459, 9), (1460, 0), (1461, 1), (1462, 2), (1463, 3), (1464, 4), (1465, 5), (1466, 6), (1467, 7), (1468, 8), (1469, 9), (1470, 0), (1471, 1), (1472, 2), (1473, 3), (1474, 4), (1475, 5), (1476, 6), (1477, 7), (1478, 8), (1479, 9), (1480, 0), (1481, 1), (1482, 2), (1483, 3), (1484, 4), (1485, 5), (1486, 6), (1487, 7), (1488, 8), (1489, 9), (1490, 0), (1491, 1), (1492, 2), (1493, 3), (1494, 4), (1495, 5), (1496, 6), (1497, 7), (1498, 8), (1499, 9);
+insert into a values (1500, 0), (1501, 1), (1502, 2), (1503, 3), (1504, 4), (1505, 5), (1506, 6), (1507, 7), (1508, 8), (1509, 9), (1510, 0), (1511, 1), (1512, 2), (1513, 3), (1514, 4), (1515, 5), (1516, 6), (1517, 7), (1518, 8), (1519, 9), (1520, 0), (1521, 1), (1522, 2), (1523, 3), (1524, 4), (1525, 5), (1526, 6), (1527, 7), (1528, 8), (1529, 9), (1530, 0), (1531, 1), (1532, 2), (1533, 3), (1534, 4), (1535, 5), (1536, 6), (1537, 7), (1538, 8), (1539, 9), (1540, 0), (1541, 1), (1542, 2), (1543, 3), (1544, 4), (1545, 5), (1546, 6), (1547, 7), (1548, 8), (1549, 9);
+insert into a values (1550, 0), (1551, 1), (1552, 2), (1553, 3), (1554, 4), (1555, 5), (1556, 6), (1557, 7), (1558, 8), (1559, 9), (1560, 0), (1561, 1), (1562, 2), (1563, 3), (1564, 4), (1565, 5), (1566, 6), (1567, 7), (1568, 8), (1569, 9), (1570, 0), (1571, 1), (1572, 2), (1573, 3), (1574, 4), (1575, 5), (1576, 6), (1577, 7), (1578, 8), (1579, 9), (1580, 0), (1581, 1), (1582, 2), (1583, 3), (1584, 4), (1585, 5), (1586, 6), (1587, 7), (1588, 8), (1589, 9), (1590, 0), (1591, 1), (1592, 2), (1593, 3), (1594, 4), (1595, 5), (1596, 6), (1597, 7), (1598, 8), (1599, 9);
+insert into a values (1600, 0), (1601, 1), (1602, 2), (1603, 3), (1604, 4), (1605, 5), (1606, 6), (1607, 7), (1608, 8), (1609, 9), (1610, 0), (1611, 1), (1612, 2), (1613, 3), (1614, 4), (1615, 5), (1616, 6), (1617, 7), (1618, 8), (1619, 9), (1620, 0), (1621, 1), (1622, 2), (1623, 3), (1624, 4), (1625, 5), (1626, 6), (1627, 7), (1628, 8), (1629, 9), (1630, 0), (1631, 1), (1632, 2), (1633, 3), (1634, 4), (1635, 5), (1636, 6), (1637, 7), (1638, 8), (1639, 9), (1640, 0), (1641, 1), (1642, 2), (1643, 3), (1644, 4), (1645, 5), (1646, 6), (1647, 7), (1648, 8), (1649, 9);
+insert into a values (1650, 0), (1651, 1), (1652, 2), (1653, 3), (1654, 4), (1655, 5), (1656, 6), (1657, 7), (1658, 8), (1659, 9), (1660, 0), (1661, 1), (1662, 2), (1663, 3), (1664, 4), (1665, 5), (1666, 6), (1667, 7), (1668, 8), (1669, 9), (1670, 0), (1671, 1), (1672, 2), (1673, 3), (1674, 4), (1675, 5), (1676, 6), (1677, 7), (1678, 8), (1679, 9), (1680, 0), (1681, 1), (1682, 2), (1683, 3), (1684, 4), (1685, 5), (1686, 6), (1687, 7), (1688, 8), (1689, 9), (1690, 0), (1691, 1), (1692, 2), (1693, 3), (1694, 4), (1695, 5), (1696, 6), (1697, 7), (1698, 8), (1699, 9);
+insert into a values (1700, 0), (1701, 1), (1702, 2), (1703, 3), (1704, 4), (1705, 5), (1706, 6), (1707, 7), (1708, 8), (1709, 9), (1710, 0), (1711, 1), (1712, 2), (1713, 3), (1714, 4), (1715, 5), (1716, 6), (1717, 7), (1718, 8), (1719, 9), (1720, 0), (1721, 1), (1722, 2), (1723, 3), (1724, 4), (1725, 5), (1726, 6), (1727, 7), (1728, 8), (1729, 9), (1730, 0), (1731, 1), (1732, 2), (1733, 3), (1734, 4), (1735, 5), (1736, 6), (1737, 7), (1738, 8), (1739, 9), (1740, 0), (1741, 1), (1742, 2), (1743, 3), (1744, 4), (1745, 5), (1746, 6), (1747, 7), (1748, 8), (1749, 9);
+insert into a values (1750, 0), (1751, 1), (1752, 2), (1753, 3), (1754, 4), (1755, 5), (1756, 6), (1757, 7), (1758, 8), (1759, 9), (1760, 0), (1761, 1), (1762, 2), (1763, 3), (1764, 4), (1765, 5), (1766, 6), (1767, 7), (1768, 8), (1769, 9), (1770, 0), (1771, 1), (1772, 2), (1773, 3), (1774, 4), (1775, 5), (1776, 6), (1777, 7), (1778, 8), (1779, 9), (1780, 0), (1781, 1), (1782, 2), (1783, 3), (1784, 4), (1785, 5), (1786, 6), (1787, 7), (1788, 8), (1789, 9), (1790, 0), (1791, 1), (1792, 2), (1793, 3), (1794, 4), (1795, 5), (1796, 6), (1797, 7), (1798, 8), (1799, 9);
+insert into a values (1800, 0), (1801, 1), (1802, 2), (1803, 3), (1804, 4), (1805, 5), (1806, 6), (1807, 7), (1808, 8), (1809, 9), (1810, 0), (1811, 1), (1812, 2), (1813, 3), (1814, 4), (1815, 5), (1816, 6), (1817, 7), (1818, 8), (1819, 9), (1820, 0), (1821, 1), (1822, 2), (1823, 3), (1824, 4), (1825, 5), (1826, 6), (1827, 7), (1828, 8), (1829, 9), (1830, 0), (1831, 1), (1832, 2), (1833, 3), (1834, 4), (1835, 5), (1836, 6), (1837, 7), (1838, 8), (1839, 9), (1840, 0), (1841, 1), (1842, 2), (1843, 3), (1844, 4), (1845, 5), (1846, 6), (1847, 7), (1848, 8), (1849, 9);
+insert into a values (1850, 0), (1851, 1), (1852, 2), (1853, 3), (1854, 4), (1855, 5), (1856, 6), (1857, 7), (1858, 8), (1859, 9), (1860, 0), (1861, 1), (1862, 2), (1863, 3), (1864, 4), (1865, 5), (1866, 6), (1867, 7), (1868, 8), (1869, 9), (1870, 0), (1871, 1), (1872, 2), (1873, 3), (1874, 4), (1875, 5), (1876, 6), (1877, 7), (1878, 8), (1879, 9), (1880, 0), (1881, 1), (1882, 2), (1883, 3), (1884, 4), (1885, 5), (1886, 6), (1887, 7), (1888, 8), (1889, 9), (1890, 0), (1891, 1), (1892, 2), (1893, 3), (1894, 4), (1895, 5), (1896, 6), (1897, 7), (1898, 8), (1899, 9);
+insert into a values (1900, 0), (1901, 1), (1902, 2), (1903, 3), (1904, 4), (1905, 5), (1906, 6), (1907, 7), (1908, 8), (1909, 9), (1910, 0), (1911, 1), (1912, 2), (1913, 3), (1914, 4), (1915, 5), (1916, 6), (1917, 7), (1918, 8), (1919, 9), (1920, 0), (1921, 1), (1922, 2), (1923, 3), (1924, 4), (1925, 5), (1926, 6), (1927, 7), (1928, 8), (1929, 9), (1930, 0), (1931, 1), (1932, 2), (1933, 3), (1934, 4), (1935, 5), (1936, 6), (1937, 7), (1938, 8), (1939, 9), (1940, 0), (1941, 1), (1942, 2), (1943, 3), (1944, 4), (1945, 5), (1946, 6), (1947, 7), (1948, 8), (1949, 9);
+insert into a values (1950, 0), (1951, 1), (1952, 2), (1953, 3), (1954, 4), (1955, 5), (1956, 6), (1957, 7), (1958, 8), (1959, 9), (1960, 0), (1961, 1), (1962, 2), (1963, 3), (1964, 4), (1965, 5), (1966, 6), (1967, 7), (1968, 8), (1969, 9), (1970, 0), (1971, 1), (1972, 2), (1973, 3), (1974, 4), (1975, 5), (1976, 6), (1977, 7), (1978, 8), (1979, 9), (1980, 0), (1981, 1), (1982, 2), (1983, 3), (1984, 4), (1985, 5), (1986, 6), (1987, 7), (1988, 8), (1989, 9), (1990, 0), (1991, 1), (1992, 2), (1993, 3), (1994, 4), (1995, 5), (1996, 6), (1997, 7), (1998, 8), (1999, 9);
+insert into a values (2000, 0), (2001, 1), (2002, 2), (2003, 3), (2004, 4), (2005, 5), (2006, 6), (2007, 7), (2008, 8), (2009, 9), (2010, 0), (2011, 1), (2012, 2), (2013, 3), (2014, 4), (2015, 5), (2016, 6), (2017, 7), (2018, 8), (2019, 9), (2020, 0), (2021, 1), (2022, 2), (2023, 3), (2024, 4), (2025, 5), (2026, 6), (2027, 7), (2028, 8), (2029, 9), (2030, 0), (2031, 1), (2032, 2), (2033, 3), (2034, 4), (2035, 5), (2036, 6), (2037, 7), (2038, 8), (2039, 9), (2040, 0), (2041, 1), (2042, 2), (2043, 3), (2044, 4), (2045, 5), (2046, 6), (2047, 7), (2048, 8), (2049, 9);
+insert into a values (2050, 0), (2051, 1), (2052, 2), (2053, 3), (2054, 4), (2055, 5), (2056, 6), (2057, 7), (2058, 8), (2059, 9), (2060, 0), (2061, 1), (2062, 2), (2063, 3), (2064, 4), (2065, 5), (2066, 6), (2067, 7), (2068, 8), (2069, 9), (2070, 0), (2071, 1), (2072, 2), (2073, 3), (2074, 4), (2075, 5), (2076, 6), (2077, 7), (2078, 8), (2079, 9), (2080, 0), (2081, 1), (2082, 2), (2083, 3), (2084, 4), (2085, 5), (2086, 6), (2087, 7), (2088, 8), (2089, 9), (2090, 0), (2091, 1), (2092, 2), (2093, 3), (2094, 4), (2095, 5), (2096, 6), (2097, 7), (2098, 8), (2099, 9);
+insert into a values (2100, 0), (2101, 1), (2102, 2), (2103, 3), (2104, 4), (2105, 5), (2106, 6), (2107, 7), (2108, 8), (2109, 9), (2110, 0), (2111, 1), (2112, 2), (2113, 3), (2114, 4), (2115, 5), (2116, 6), (2117, 7), (2118, 8), (2119, 9), (2120, 0), (2121, 1), (2122, 2), (2123, 3), (2124, 4), (2125, 5), (2126, 6), (2127, 7), (2128, 8), (2129, 9), (2130, 0), (2131, 1), (2132, 2), (2133, 3), (2134, 4), (2135, 5), (2136, 6), (2137, 7), (2138, 8), (2139, 9), (2140, 0), (2141, 1), (2142, 2), (2143, 3), (2144, 4), (2145, 5), (2146, 6), (2147, 7), (2148, 8), (2149, 9);
+insert into a values (2150, 0), (2151, 1), (2152, 2), (2153, 3), (2154, 4), (2155, 5), (2156, 6), (2157, 7), (2158, 8), (2159, 9), (2160, 0), (2161, 1), (2162, 2), (2163, 3), (2164, 4), (2165, 5), (2166, 6), (2167, 7), (2168, 8), (2169, 9), (2170, 0), (2171, 1), (2172, 2), (2173, 3), (2174, 4), (2175, 5), (2176, 6), (2177, 7), (2178, 8), (2179, 9), (2180, 0), (2181, 1), (2182, 2), (2183, 3), (2184, 4), (2185, 5), (2186, 6), (2187, 7), (2188, 8), (2189, 9), (2190, 0), (2191, 1), (2192, 2), (2193, 3), (2194, 4), (2195, 5), (2196, 6), (2197, 7), (2198, 8), (2199, 9);
+insert into a values (2200, 0), (2201, 1), (2202, 2), (2203, 3), (2204, 4), (2205, 5), (2206, 6), (2207, 7), (2208, 8), (2209, 9), (2210, 0), (2211, 1), (2212, 2), (2213, 3), (2214, 4), (2215, 5), (2216, 6), (2217, 7), (2218, 8), (2219, 9), (2220, 0), (2221, 1), (2222, 2), (2223, 3), (2224, 4), (2225, 5), (2226, 6), (2227, 7), (2228, 8), (2229, 9), (2230, 0), (2231, 1), (2232, 2), (2233, 3), (2234, 4), (2235, 5), (2236, 6), (2237, 7), (2238, 8), (2239, 9), (2240, 0), (2241, 1), (2242, 2), (2243, 3), (2244, 4), (2245, 5), (2246, 6), (2247, 7), (2248, 8), (2249, 9);
+insert into a values (2250, 0), (2251, 1), (2252, 2), (2253, 3), (2254, 4), (2255, 5), (2256, 6), (2257, 7), (2258, 8), (2259, 9), (2260, 0), (2261, 1), (2262, 2), (2263, 3), (2264, 4), (2265, 5), (2266, 6), (2267, 7), (2268, 8), (2269, 9), (2270, 0), (2271, 1), (2272, 2), (2273, 3), (2274, 4), (2275, 5), (2276, 6), (2277, 7), (2278, 8), (2279, 9), (2280, 0), (2281, 1), (2282, 2), (2283, 3), (2284, 4), (2285, 5), (2286, 6), (2287, 7), (2288, 8), (2289, 9), (2290, 0), (2291, 1), (2292, 2), (2293, 3), (2294, 4), (2295, 5), (2296, 6), (2297, 7), (2298, 8), (2299, 9);
+insert into a values (2300, 0), (2301, 1), (2302, 2), (2303, 3), (2304, 4), (2305, 5), (2306, 6), (2307, 7), (2308, 8), (2309, 9), (2310, 0), (2311, 1), (2312, 2), (2313, 3), (2314, 4), (2315, 5), (2316, 6), (2317, 7), (2318, 8), (2319, 9), (2320, 0), (2321, 1), (2322, 2), (2323, 3), (2324, 4), (2325, 5), (2326, 6), (2327, 7), (2328, 8), (2329, 9), (2330, 0), (2331, 1), (2332, 2), (2333, 3), (2334, 4), (2335, 5), (2336, 6), (2337, 7), (2338, 8), (2339, 9), (2340, 0), (2341, 1), (2342, 2), (2343, 3), (2344, 4), (2345, 5), (2346, 6), (2347, 7), (2348, 8), (2349, 9);
+insert into a values (2350, 0), (2351, 1), (2352, 2), (2353, 3), (2354, 4), (2355, 5), (2356, 6), (2357, 7), (2358, 8), (2359, 9), (2360, 0), (2361, 1), (2362, 2), (2363, 3), (2364, 4), (2365, 5), (2366, 6), (2367, 7), (2368, 8), (2369, 9), (2370, 0), (2371, 1), (2372, 2), (2373, 3), (2374, 4), (2375, 5), (2376, 6), (2377, 7), (2378, 8), (2379, 9), (2380, 0), (2381, 1), (2382, 2), (2383, 3), (2384, 4), (2385, 5), (2386, 6), (2387, 7), (2388, 8), (2389, 9), (2390, 0), (2391, 1), (2392, 2), (2393, 3), (2394, 4), (2395, 5), (2396, 6), (2397, 7), (2398, 8), (2399, 9);
+insert into a values (2400, 0), (2401, 1), (2402, 2), (2403, 3), (2404, 4), (2405, 5), (2406, 6), (2407, 7), (2408, 8), (2409, 9), (2410, 0), (2411, 1), (2412, 2), (2413, 3), (2414, 4), (2415, 5), (2416, 6), (2417, 7), (2418, 8), (2419, 9), (2420, 0), (2421, 1), (2422, 2), (2423, 3), (2424, 4), (2425, 5), (2426, 6), (2427, 7), (2428, 8), (2429, 9), (2430, 0), (2431, 1), (2432, 2), (2433, 3), (2434, 4), (2435, 5), (2436, 6), (2437, 7), (2438, 8), (2439, 9), (2440, 0), (2441, 1), (2442, 2), (2443, 3), (2444, 4), (2445, 5), (2446, 6), (2447, 7), (2448, 8), (2449, 9);
+insert into a values (2450, 0), (2451, 1), (2452, 2), (2453, 3), (2454, 4), (2455, 5), (2456, 6), (2457, 7), (2458, 8), (2459, 9), (2460, 0), (2461, 1), (2462, 2), (2463, 3), (2464, 4), (2465, 5), (2466, 6), (2467, 7), (2468, 8), (2469, 9), (2470, 0), (2471, 1), (2472, 2), (2473, 3), (2474, 4), (2475, 5), (2476, 6), (2477, 7), (2478, 8), (2479, 9), (2480, 0), (2481, 1), (2482, 2), (2483, 3), (2484, 4), (2485, 5), (2486, 6), (2487, 7), (2488, 8), (2489, 9), (2490, 0), (2491, 1), (2492, 2), (2493, 3), (2494, 4), (2495, 5), (2496, 6), (2497, 7), (2498, 8), (2499, 9);
+insert into a values (2500, 0), (2501, 1), (2502, 2), (2503, 3), (2504, 4), (2505, 5), (2506, 6), (2507, 7), (2508, 8), (2509, 9), (2510, 0), (2511, 1), (2512, 2), (2513, 3), (2514, 4), (2515, 5), (2516, 6), (2517, 7), (2518, 8), (2519, 9), (2520, 0), (2521, 1), (2522, 2), (2523, 3), (2524, 4), (2525, 5), (2526, 6), (2527, 7), (2528, 8), (2529, 9), (2530, 0), (2531, 1), (2532, 2), (2533, 3), (2534, 4), (2535, 5), (2536, 6), (2537, 7), (2538, 8), (2539, 9), (2540, 0), (2541, 1), (2542, 2), (2543, 3), (2544, 4), (2545, 5), (2546, 6), (2547, 7), (2548, 8), (2549, 9);
+insert into a values (2550, 0), (2551, 1), (2552, 2), (2553, 3), (2554, 4), (2555, 5), (2556, 6), (2557, 7), (2558, 8), (2559, 9), (2560, 0), (2561, 1), (2562, 2), (2563, 3), (2564, 4), (2565, 5), (2566, 6), (2567, 7), (2568, 8), (2569, 9), (2570, 0), (2571, 1), (2572, 2), (2573, 3), (2574, 4), (2575, 5), (2576, 6), (2577, 7), (2578, 8), (2579, 9), (2580, 0), (2581, 1), (2582, 2), (2583, 3), (2584, 4), (2585, 5), (2586, 6), (2587, 7), (2588, 8), (2589, 9), (2590, 0), (2591, 1), (2592, 2), (2593, 3), (2594, 4), (2595, 5), (2596, 6), (2597, 7), (2598, 8), (2599, 9);
+insert into a values (2600, 0), (2601, 1), (2602, 2), (2603, 3), (2604, 4), (2605, 5), (2606, 6), (2607, 7), (2608, 8), (2609, 9), (2610, 0), (2611, 1), (2612, 2), (2613, 3), (2614, 4), (2615, 5), (2616, 6), (2617, 7), (2618, 8), (2619, 9), (2620, 0), (2621, 1), (2622, 2), (2623, 3), (2624, 4), (2625, 5), (2626, 6), (2627, 7), (2628, 8), (2629, 9), (2630, 0), (2631, 1), (2632, 2), (2633, 3), (2634, 4), (2635, 5), (2636, 6), (2637, 7), (2638, 8), (2639, 9), (2640, 0), (2641, 1), (2642, 2), (2643, 3), (2644, 4), (2645, 5), (2646, 6), (2647, 7), (2648, 8), (2649, 9);
+insert into a values (2650, 0), (2651, 1), (2652, 2), (2653, 3), (2654, 4), (2655, 5), (2656, 6), (2657, 7), (2658, 8), (2659, 9), (2660, 0), (2661, 1), (2662, 2), (2663, 3), (2664, 4), (2665, 5), (2666, 6), (2667, 7), (2668, 8), (2669, 9), (2670, 0), (2671, 1), (2672, 2), (2673, 3), (2674, 4), (2675, 5), (2676, 6), (2677, 7), (2678, 8), (2679, 9), (2680, 0), (2681, 1), (2682, 2), (2683, 3), (2684, 4), (2685, 5), (2686, 6), (2687, 7), (2688, 8), (2689, 9), (2690, 0), (2691, 1), (2692, 2), (2693, 3), (2694, 4), (2695, 5), (2696, 6), (2697, 7), (2698, 8), (2699, 9);
+insert into a values (2700, 0), (2701, 1), (2702, 2), (2703, 3), (2704, 4), (2705, 5), (2706, 6), (2707, 7), (2708, 8), (2709, 9), (2710, 0), (2711, 1), (2712, 2), (2713, 3), (2714, 4), (2715, 5), (2716, 6), (2717, 7), (2718, 8), (2719, 9), (2720, 0), (2721, 1), (2722, 2), (2723, 3), (2724, 4), (2725, 5), (2726, 6), (2727, 7), (2728, 8), (2729, 9), (2730, 0), (2731, 1), (2732, 2), (2733, 3), (2734, 4), (2735, 5), (2736, 6), (2737, 7), (2738, 8), (2739, 9), (2740, 0), (2741, 1), (2742, 2), (2743, 3), (2744, 4), (2745, 5), (2746, 6), (2747, 7), (2748, 8), (2749, 9);
+insert into a values (2750, 0), (2751, 1), (2752, 2), (2753, 3), (2754, 4), (2755, 5), (2756, 6), (2757, 7), (2758, 8), (2759, 9), (2760, 0), (2761, 1), (2762, 2), (2763, 3), (2764, 4), (2765, 5), (2766, 6), (2767, 7), (2768, 8), (2769, 9), (2770, 0), (2771, 1), (2772, 2), (2773, 3), (2774, 4), (2775, 5), (2776, 6), (2777, 7), (2778, 8), (2779, 9), (2780, 0), (2781, 1), (2782, 2), (2783, 3), (2784, 4), (2785, 5), (2786, 6), (2787, 7), (2788, 8), (2789, 9), (2790, 0), (2791, 1), (2792, 2), (2793, 3), (2794, 4), (2795, 5), (2796, 6), (2797, 7), (2798, 8), (2799, 9);
+insert into a values (2800, 0), (2801, 1), (2802, 2), (2803, 3), (2804, 4), (2805, 5), (2806, 6), (2807, 7), (2808, 8), (2809, 9), (2810, 0), (2811, 1), (2812, 2), (2813, 3), (2814, 4), (2815, 5), (2816, 6), (2817, 7), (2818, 8), (2819, 9), (2820, 0), (2821, 1), (2822, 2), (2823, 3), (2824, 4), (2825, 5), (2826, 6), (2827, 7), (2828, 8), (2829, 9), (2830, 0), (2831, 1), (2832, 2), (2833, 3), (2834, 4), (2835, 5), (2836, 6), (2837, 7), (2838, 8), (2839, 9), (2840, 0), (2841, 1), (2842, 2), (2843, 3), (2844, 4), (2845, 5), (2846, 6), (2847, 7), (2848, 8), (2849, 9);
+insert into a values (2850, 0), (2851, 1), (2852, 2), (2853, 3), (2854, 4), (2855, 5), (2856, 6), (2857, 7), (2858, 8), (2859, 9), (2860, 0), (2861, 1), (2862, 2), (2863, 3), (2864, 4), (2865, 5), (2866, 6), (2867, 7), (2868, 8), (2869, 9), (2870, 0), (2871, 1), (2872, 2), (2873, 3), (2874, 4), (2875, 5), (2876, 6), (2877, 7), (2878, 8), (2879, 9), (2880, 0), (2881, 1), (2882, 2), (2883, 3), (2884, 4), (2885, 5), (2886, 6), (2887, 7), (2888, 8), (2889, 9), (2890, 0), (2891, 1), (2892, 2), (2893, 3), (2894, 4), (2895, 5), (2896, 6), (2897, 7), (2898, 8), (2899, 9);
+insert into a values (2900, 0), (2901, 1), (2902, 2), (2903, 3), (2904, 4), (2905, 5), (2906, 6), (2907, 7), (2908, 8), (2909, 9), (2910, 0), (2911, 1), (2912, 2), (2913, 3), (2914, 4), (2915, 5), (2916, 6), (2917, 7), (2918, 8), (2919, 9), (2920, 0), (2921, 1), (2922, 2), (2923, 3), (2924, 4), (2925, 5), (2926, 6), (2927, 7), (2928, 8), (2929, 9), (2930, 0), (2931, 1), (2932, 2), (2933, 3), (2934, 4), (2935, 5), (2936, 6), (2937, 7), (2938, 8), (2939, 9), (2940, 0), (2941, 1), (2942, 2), (2943, 3), (2944, 4), (2945, 5), (2946, 6), (2947, 7), (2948, 8), (2949, 9);
+insert into a values (2950, 0), (2951, 1), (2952, 2), (2953, 3), (2954, 4), (2955, 5), (2956, 6), (2957, 7), (2958, 8), (2959, 9), (2960, 0), (2961, 1), (2962, 2), (2963, 3), (2964, 4), (2965, 5), (2966, 6), (2967, 7), (2968, 8), (2969, 9), (2970, 0), (2971, 1), (2972, 2), (2973, 3), (2974, 4), (2975, 5), (2976, 6), (2977, 7), (2978, 8), (2979, 9), (2980, 0), (2981, 1), (2982, 2), (2983, 3), (2984, 4), (2985, 5), (2986, 6), (2987, 7), (2988, 8), (2989, 9), (2990, 0), (2991, 1), (2992, 2), (2993, 3), (2994, 4), (2995, 5), (2996, 6), (2997, 7), (2998, 8), (2999, 9);
+insert into b values (0, 0), (1, 2), (2, 4), (3, 6), (4, 8), (5, 10), (6, 12), (7, 14), (8, 16), (9, 18), (10, 20), (11, 22), (12, 24), (13, 26), (14, 28), (15, 30), (16, 32), (17, 34), (18, 36), (19, 38), (20, 40), (21, 42), (22, 44), (23, 46), (24, 48), (25, 50), (26, 52), (27, 54), (28, 56), (29, 58), (30, 60), (31, 62), (32, 64), (33, 66), (34, 68), (35, 70), (36, 72), (37, 74), (38, 76), (39, 78), (40, 80), (41, 82), (42, 84), (43, 86), (44, 88), (45, 90), (46, 92), (47, 94), (48, 96), (49, 98);
+insert into b values (50, 100), (51, 102), (52, 104), (53, 106), (54, 108), (55, 110), (56, 112), (57, 114), (58, 116), (59, 118), (60, 120), (61, 122), (62, 124), (63, 126), (64, 128), (65, 130), (66, 132), (67, 134), (68, 136), (69, 138), (70, 140), (71, 142), (72, 144), (73, 146), (74, 148), (75, 150), (76, 152), (77, 154), (78, 156), (79, 158), (80, 160), (81, 162), (82, 164), (83, 166), (84, 168), (85, 170), (86, 172), (87, 174), (88, 176), (89, 178), (90, 180), (91, 182), (92, 184), (93, 186), (94, 188), (95, 190), (96, 192), (97, 194), (98, 196), (99, 198);
+insert into b values (100, 200), (101, 202), (102, 204), (103, 206), (104, 208), (105, 210), (106, 212), (107, 214), (108, 216), (109, 218), (110, 220), (111, 222), (112, 224), (113, 226), (114, 228), (115, 230), (116, 232), (117, 234), (118, 236), (119, 238), (120, 240), (121, 242), (122, 244), (123, 246), (124, 248), (125, 250), (126, 252), (127, 254), (128, 256), (129, 258), (130, 260), (131, 262), (132, 264), (133, 266), (134, 268), (135, 270), (136, 272), (137, 274), (138, 276), (139, 278), (140, 280), (141, 282), (142, 284), (143, 286), (144, 288), (145, 290), (146, 292), (147, 294), (148, 296), (149, 298);
+insert into b values (150, 300), (151, 302), (152, 304), (153, 306), (154, 308), (155, 310), (156, 312), (157, 314), (158, 316), (159, 318), (160, 320), (161, 322), (162, 324), (163, 326), (164, 328), (165, 330), (166, 332), (167, 334), (168, 336), (169, 338), (170, 340), (171, 342), (172, 344), (173, 346), (174, 348), (175, 350), (176, 352), (177, 354), (178, 356), (179, 358), (180, 360), (181, 362), (182, 364), (183, 366), (184, 368), (185, 370), (186, 372), (187, 374), (188, 376), (189, 378), (190, 380), (191, 382), (192, 384), (193, 386), (194, 388), (195, 390), (196, 392), (197, 394), (198, 396), (199, 398);
+insert into b values (200, 400), (201, 402), (202, 404), (203, 406), (204, 408), (205, 410), (206, 412), (207, 414), (208, 416), (209, 418), (210, 420), (211, 422), (212, 424), (213, 426), (214, 428), (215, 430), (216, 432), (217, 434), (218, 436), (219, 438), (220, 440), (221, 442), (222, 444), (223, 446), (224, 448), (225, 450), (226, 452), (227, 454), (228, 456), (229, 458), (230, 460), (231, 462), (232, 464), (233, 466), (234, 468), (235, 470), (236, 472), (237, 474), (238, 476), (239, 478), (240, 480), (241, 482), (242, 484), (243, 486), (244, 488), (245, 490), (246, 492), (247, 494), (248, 496), (249, 498);
+insert into b values (250, 500), (251, 502), (252, 504), (253, 506), (254, 508), (255, 510), (256, 512), (257, 514), (258, 516), (259, 518), (260, 520), (261, 522), (262, 524), (263, 526), (264, 528), (265, 530), (266, 532), (267, 534), (268, 536), (269, 538), (270, 540), (271, 542), (272, 544), (273, 546), (274, 548), (275, 550), (276, 552), (277, 554), (278, 556), (279, 558), (280, 560), (281, 562), (282, 564), (283, 566), (284, 568), (285, 570), (286, 572), (287, 574), (288, 576), (289, 578), (290, 580), (291, 582), (292, 584), (293, 586), (294, 588), (295, 590), (296, 592), (297, 594), (298, 596), (299, 598);
+insert into b values (300, 600), (301, 602), (302, 604), (303, 606), (304, 608), (305, 610), (306, 612), (307, 614), (308, 616), (309, 618), (310, 620), (311, 622), (312, 624), (313, 626), (314, 628), (315, 630), (316, 632), (317, 634), (318, 636), (319, 638), (320, 640), (321, 642), (322, 644), (323, 646), (324, 648), (325, 650), (326, 652), (327, 654), (328, 656), (329, 658), (330, 660), (331, 662), (332, 664), (333, 666), (334, 668), (335, 670), (336, 672), (337, 674), (338, 676), (339, 678), (340, 680), (341, 682), (342, 684), (343, 686), (344, 688), (345, 690), (346, 692), (347, 694), (348, 696), (349, 698);
+insert into b values (350, 700), (351, 702), (352, 704), (353, 706), (354, 708), (355, 710), (356, 712), (357, 714), (358, 716), (359, 718), (360, 720), (361, 722), (362, 724), (363, 726), (364, 728), (365, 730), (366, 732), (367, 734), (368, 736), (369, 738), (370, 740), (371, 742), (372, 744), (373, 746), (374, 748), (375, 750), (376, 752), (377, 754), (378, 756), (379, 758), (380, 760), (381, 762), (382, 764), (383, 766), (384, 768), (385, 770), (386, 772), (387, 774), (388, 776), (389, 778), (390, 780), (391, 782), (392, 784), (393, 786), (394, 788), (395, 790), (396, 792), (397, 794), (398, 796), (399, 798);
+insert into b values (400, 800), (401, 802), (402, 804), (403, 806), (404, 808), (405, 810), (406, 812), (407, 814), (408, 816), (409, 818), (410, 820), (411, 822), (412, 824), (413, 826), (414, 828), (415, 830), (416, 832), (417, 834), (418, 836), (419, 838), (420, 840), (421, 842), (422, 844), (423, 846), (424, 848), (425, 850), (426, 852), (427, 854), (428, 856), (429, 858), (430, 860), (431, 862), (432, 864), (433, 866), (434, 868), (435, 870), (436, 872), (437, 874), (438, 876), (439, 878), (440, 880), (441, 882), (442, 884), (443, 886), (444, 888), (445, 890), (446, 892), (447, 894), (448, 896), (449, 898);
+insert into b values (450, 900), (451, 902), (452, 904), (453, 906), (454, 908), (455, 910), (456, 912), (457, 914), (458, 916), (459, 918), (460, 920), (461, 922), (462, 924), (463, 926), (464, 928), (465, 930), (466, 932), (467, 934), (468, 936), (469, 938), (470, 940), (471, 942), (472, 944), (473, 946), (474, 948), (475, 950), (476, 952), (477, 954), (478, 956), (479, 958), (480, 960), (481, 962), (482, 964), (483, 966), (484, 968), (485, 970), (486, 972), (487, 974), (488, 976), (489, 978), (490, 980), (491, 982), (492, 984), (493, 986), (494, 988), (495, 990), (496, 992), (497, 994), (498, 996), (499, 998);
+insert into b values (500, 1000), (501, 1002), (502, 1004), (503, 1006), (504, 1008), (505, 1010), (506, 1012), (507, 1014), (508, 1016), (509, 1018), (510, 1020), (511, 1022), (512, 1024), (513, 1026), (514, 1028), (515, 1030), (516, 1032), (517, 1034), (518, 1036), (519, 1038), (520, 1040), (521, 1042), (522, 1044), (523, 1046), (524, 1048), (525, 1050), (526, 1052), (527, 1054), (528, 1056), (529, 1058), (530, 1060), (531, 1062), (532, 1064), (533, 1066), (534, 1068), (535, 1070), (536, 1072), (537, 1074), (538, 1076), (539, 1078), (540, 1080), (541, 1082), (542, 1084), (543, 1086), (544, 1088), (545, 1090), (546, 1092), (547, 1094), (548, 1096), (549, 1098);
+insert into b values (550, 1100), (551, 1102), (552, 1104), (553, 1106), (554, 1108), (555, 1110), (556, 1112), (557, 1114), (558, 1116), (559, 1118), (560, 1120), (561, 1122), (562, 1124), (563, 1126), (564, 1128), (565, 1130), (566, 1132), (567, 1134), (568, 1136), (569, 1138), (570, 1140), (571, 1142), (572, 1144), (573, 1146), (574, 1148), (575, 1150), (576, 1152), (577, 1154), (578, 1156), (579, 1158), (580, 1160), (581, 1162), (582, 1164), (583, 1166), (584, 1168), (585, 1170), (586, 1172), (587, 1174), (588, 1176), (589, 1178), (590, 1180), (591, 1182), (592, 1184), (593, 1186), (594, 1188), (595, 1190), (596, 1192), (597, 1194), (598, 1196), (599, 1198);
+insert into b values (600, 1200), (601, 1202), (602, 1204), (603, 1206), (604, 1208), (605, 1210), (606, 1212), (607, 1214), (608, 1216), (609, 1218), (610, 1220), (611, 1222), (612, 1224), (613, 1226), (614, 1228), (615, 1230), (616, 1232), (617, 1234), (618, 1236), (619, 1238), (620, 1240), (621, 1242), (622, 1244), (623, 1246), (624, 1248), (625, 1250), (626, 1252), (627, 1254), (628, 1256), (629, 1258), (630, 1260), (631, 1262), (632, 1264), (633, 1266), (634, 1268), (635, 1270), (636, 1272), (637, 1274), (638, 1276), (639, 1278), (640, 1280), (641, 1282), (642, 1284), (643, 1286), (644, 1288), (645, 1290), (646, 1292), (647, 1294), (648, 1296), (649, 1298);
+insert into b values (650, 1300), (651, 1302), (652, 1304), (653, 1306), (654, 1308), (655, 1310), (656, 1312), (657, 1314), (658, 1316), (659, 1318), (660, 1320), (661, 1322), (662, 1324), (663, 1326), (664, 1328), (665, 1330), (666, 1332), (667, 1334), (668, 1336), (669, 1338), (670, 1340), (671, 1342), (672, 1344), (673, 1346), (674, 1348), (675, 1350), (676, 1352), (677, 1354), (678, 1356), (679, 1358), (680, 1360), (681, 1362), (682, 1364), (683, 1366), (684, 1368), (685, 1370), (686, 1372), (687, 1374), (688, 1376), (689, 1378), (690, 1380), (691, 1382), (692, 1384), (693, 1386), (694, 1388), (695, 1390), (696, 1392), (697, 1394), (698, 1396), (699, 1398);
+insert into b values (700, 1400), (701, 1402), (702, 1404), (703, 1406), (704, 1408), (705, 1410), (706, 1412), (707, 1414), (708, 1416), (709, 1418), (710, 1420), (711, 1422), (712, 1424), (713, 1426), (714, 1428), (715, 1430), (716, 1432), (717, 1434), (718, 1436), (719, 1438), (720, 1440), (721, 1442), (722, 1444), (723, 1446), (724, 1448), (725, 1450), (726, 1452), (727, 1454), (728, 1456), (729, 1458), (730, 1460), (731, 1462), (732, 1464), (733, 1466), (734, 1468), (735, 1470), (736, 1472), (737, 1474), (738, 1476), (739, 1478), (740, 1480), (741, 1482), (742, 1484), (743, 1486), (744, 1488), (745, 1490), (746, 1492), (747, 1494), (748, 1496), (749, 1498);
+insert into b values (750, 1500), (751, 1502), (752, 1504), (753, 1506), (754, 1508), (755, 1510), (756, 1512), (757, 1514), (758, 1516), (759, 1518), (760, 1520), (761, 1522), (762, 1524), (763, 1526), (764, 1528), (765, 1530), (766, 1532), (767, 1534), (768, 1536), (769, 1538), (770, 1540), (771, 1542), (772, 1544), (773, 1546), (774, 1548), (775, 1550), (776, 1552), (777, 1554), (778, 1556), (779, 1558), (780, 1560), (781, 1562), (782, 1564), (783, 1566), (784, 1568), (785, 1570), (786, 1572), (787, 1574), (788, 1576), (789, 1578), (790, 1580), (791, 1582), (792, 1584), (793, 1586), (794, 1588), (795, 1590), (796, 1592), (797, 1594), (798, 1596), (799, 1598);
+insert into b values (800, 1600), (801, 1602), (802, 1604), (803, 1606), (804, 1608), (805, 1610), (806, 1612), (807, 1614), (808, 1616), (809, 1618), (810, 1620), (811, 1622), (812, 1624), (813, 1626), (814, 1628), (815, 1630), (816, 1632), (817, 1634), (818, 1636), (819, 1638), (820, 1640), (821, 1642), (822, 1644), (823, 1646), (824, 1648), (825, 1650), (826, 1652), (827, 1654), (828, 1656), (829, 1658), (830, 1660), (831, 1662), (832, 1664), (833, 1666), (834, 1668), (835, 1670), (836, 1672), (837, 1674), (838, 1676), (839, 1678), (840, 1680), (841, 1682), (842, 1684), (843, 1686), (844, 1688), (845, 1690), (846, 1692), (847, 1694), (848, 1696), (849, 1698);
+insert into b values (850, 1700), (851, 1702), (852, 1704), (853, 1706), (854, 1708), (855, 1710), (856, 1712), (857, 1714), (858, 1716), (859, 1718), (860, 1720), (861, 1722), (862, 1724), (863, 1726), (864, 1728), (865, 1730), (866, 1732), (867, 1734), (868, 1736), (869, 1738), (870, 1740), (871, 1742), (872, 1744), (873, 1746), (874, 1748), (875, 1750), (876, 1752), (877, 1754), (878, 1756), (879, 1758), (880, 1760), (881, 1762), (882, 1764), (883, 1766), (884, 1768), (885, 1770), (886, 1772), (887, 1774), (888, 1776), (889, 1778), (890, 1780), (891, 1782), (892, 1784), (893, 1786), (894, 1788), (895, 1790), (896, 1792), (897, 1794), (898, 1796), (899, 1798);
+insert into b values (900, 1800), (901, 1802), (902, 1804), (903, 1806), (904, 1808), (905, 1810), (906, 1812), (907, 1814), (908, 1816), (909, 1818), (910, 1820), (911, 1822), (912, 1824), (913, 1826), (914, 1828), (915, 1830), (916, 1832), (917, 1834), (918, 1836), (919, 1838), (920, 1840), (921, 1842), (922, 1844), (923, 1846), (924, 1848), (925, 1850), (926, 1852), (927, 1854), (928, 1856), (929, 1858), (930, 1860), (931, 1862), (932, 1864), (933, 1866), (934, 1868), (935, 1870), (936, 1872), (937, 1874), (938, 1876), (939, 1878), (940, 1880), (941, 1882), (942, 1884), (943, 1886), (944, 1888), (945, 1890), (946, 1892), (947, 1894), (948, 1896), (949, 1898);
+insert into b values (950, 1900), (951, 1902), (952, 1904), (953, 1906), (954, 1908), (955, 1910), (956, 1912), (957, 1914), (958, 1916), (959, 1918), (960, 1920), (961, 1922), (962, 1924), (963, 1926), (964, 1928), (965, 1930), (966, 1932), (967, 1934), (968, 1936), (969, 1938), (970, 1940), (971, 1942), (972, 1944), (973, 1946), (974, 1948), (975, 1950), (976, 1952), (977, 1954), (978, 1956), (979, 1958), (980, 1960), (981, 1962), (982, 1964), (983, 1966), (984, 1968), (985, 1970), (986, 1972), (987, 1974), (988, 1976), (989, 1978), (990, 1980), (991, 1982), (992, 1984), (993, 1986), (994, 1988), (995, 1990), (996, 1992), (997, 1994), (998, 1996), (999, 1998);
+insert into b values (1000, 2000), (1001, 2002), (1002, 2004), (1003, 2006), (1004, 2008), (1005, 2010), (1006, 2012), (1007, 2014), (1008, 2016), (1009, 2018), (1010, 2020), (1011, 2022), (1012, 2024), (1013, 2026), (1014, 2028), (1015, 2030), (1016, 2032), (1017, 2034), (1018, 2036), (1019, 2038), (1020, 2040), (1021, 2042), (1022, 2044), (1023, 2046), (1024, 2048), (1025, 2050), (1026, 2052), (1027, 2054), (1028, 2056), (1029, 2058), (1030, 2060), (1031, 2062), (1032, 2064), (1033, 2066), (1034, 2068), (1035, 2070), (1036, 2072), (1037, 2074), (1038, 2076), (1039, 2078), (1040, 2080), (1041, 2082), (1042, 2084), (1043, 2086), (1044, 2088), (1045, 2090), (1046, 2092), (1047, 2094), (1048, 2096), (1049, 2098);
+insert into b values (1050, 2100), (1051, 2102), (1052, 2104), (1053, 2106), (1054, 2108), (1055, 2110), (1056, 2112), (1057, 2114), (1058, 2116), (1059, 2118), (1060, 2120), (1061, 2122), (1062, 2124), (1063, 2126), (1064, 2128), (1065, 2130), (1066, 2132), (1067, 2134), (1068, 2136), (1069, 2138), (1070, 2140), (1071, 2142), (1072, 2144), (1073, 2146), (1074, 2148), (1075, 2150), (1076, 2152), (1077, 2154), (1078, 2156), (1079, 2158), (1080, 2160), (1081, 2162), (1082, 2164), (1083, 2166), (1084, 2168), (1085, 2170), (1086, 2172), (1087, 2174), (1088, 2176), (1089, 2178), (1090, 2180), (1091, 2182), (1092, 2184), (1093, 2186), (1094, 2188), (1095, 2190), (1096, 2192), (1097, 2194), (1098, 2196), (1099, 2198);
+insert into b values (1100, 2200), (1101, 2202), (1102, 2204), (1103, 2206), (1104, 2208), (1105, 2210), (1106, 2212), (1107, 2214), (1108, 2216), (1109, 2218), (1110, 2220), (1111, 2222), (1112, 2224), (1113, 2226), (1114, 2228), (1115, 2230), (1116, 2232), (1117, 2234), (1118, 2236), (1119, 2238), (1120, 2240), (1121, 2242), (1122, 2244), (1123, 2246), (1124, 2248), (1125, 2250), (1126, 2252), (1127, 2254), (1128, 2256), (1129, 2258), (1130, 2260), (1131, 2262), (1132, 2264), (1133, 2266), (1134, 2268), (1135, 2270), (1136, 2272), (1137, 2274), (1138, 2276), (1139, 2278), (1140, 2280), (1141, 2282), (1142, 2284), (1143, 2286), (1144, 2288), (1145, 2290), (1146, 2292), (1147, 2294), (1148, 2296), (1149, 2298);
+insert into b values (1150, 2300), (1151, 2302), (1152, 2304), (1153, 2306), (1154, 2308), (1155, 2310), (1156, 2312), (1157, 2314), (1158, 2316), (1159, 2318), (1160, 2320), (1161, 2322), (1162, 2324), (1163, 2326), (1164, 2328), (1165, 2330), (1166, 2332), (1167, 2334), (1168, 2336), (1169, 2338), (1170, 2340), (1171, 2342), (1172, 2344), (1173, 2346), (1174, 2348), (1175, 2350), (1176, 2352), (1177, 2354), (1178, 2356), (1179, 2358), (1180, 2360), (1181, 2362), (1182, 2364), (1183, 2366), (1184, 2368), (1185, 2370), (1186, 2372), (1187, 2374), (1188, 2376), (1189, 2378), (1190, 2380), (1191, 2382), (1192, 2384), (1193, 2386), (1194, 2388), (1195, 2390), (1196, 2392), (1197, 2394), (1198, 2396), (1199, 2398);
+insert into b values (1200, 2400), (1201, 2402), (1202, 2404), (1203, 2406), (1204, 2408), (1205, 2410), (1206, 2412), (1207, 2414), (1208, 2416), (1209, 2418), (1210, 2420), (1211, 2422), (1212, 2424), (1213, 2426), (1214, 2428), (1215, 2430), (1216, 2432), (1217, 2434), (1218, 2436), (1219, 2438), (1220, 2440), (1221, 2442), (1222, 2444), (1223, 2446), (1224, 2448), (1225, 2450), (1226, 2452), (1227, 2454), (1228, 2456), (1229, 2458), (1230, 2460), (1231, 2462), (1232, 2464), (1233, 2466), (1234, 2468), (1235, 2470), (1236, 2472), (1237, 2474), (1238, 2476), (1239, 2478), (1240, 2480), (1241, 2482), (1242, 2484), (1243, 2486), (1244, 2488), (1245, 2490), (1246, 2492), (1247, 2494), (1248, 2496), (1249, 2498);
+insert into b values (1250, 2500), (1251, 2502), (1252, 2504), (1253, 2506), (1254, 2508), (1255, 2510), (1256, 2512), (1257, 2514), (1258, 2516), (1259, 2518), (1260, 2520), (1261, 2522), (1262, 2524), (1263, 2526), (1264, 2528), (1265, 2530), (1266, 2532), (1267, 2534), (1268, 2536), (1269, 2538), (1270, 2540), (1271, 2542), (1272, 2544), (1273, 2546), (1274, 2548), (1275, 2550), (1276, 2552), (1277, 2554), (1278, 2556), (1279, 2558), (1280, 2560), (1281, 2562), (1282, 2564), (1283, 2566), (1284, 2568), (1285, 2570), (1286, 2572), (1287, 2574), (1288, 2576), (1289, 2578), (1290, 2580), (1291, 2582), (1292, 2584), (1293, 2586), (1294, 2588), (1295, 2590), (1296, 2592), (1297, 2594), (1298, 2596), (1299, 2598);
+insert into b values (1300, 2600), (1301, 2602), (1302, 2604), (1303, 2606), (1304, 2608), (1305, 2610), (1306, 2612), (1307, 2614), (1308, 2616), (1309, 2618), (1310, 2620), (1311, 2622), (1312, 2624), (1313, 2626), (1314, 2628), (1315, 2630), (1316, 2632), (1317, 2634), (1318, 2636), (1319, 2638), (1320, 2640), (1321, 2642), (1322, 2644), (1323, 2646), (1324, 2648), (1325, 2650), (1326, 2652), (1327, 2654), (1328, 2656), (1329, 2658), (1330, 2660), (1331, 2662), (1332, 2664), (1333, 2666), (1334, 2668), (1335, 2670), (1336, 2672), (1337, 2674), (1338, 2676), (1339, 2678), (1340, 2680), (1341, 2682), (1342, 2684), (1343, 2686), (1344, 2688), (1345, 2690), (1346, 2692), (1347, 2694), (1348, 2696), (1349, 2698);
+insert into b values (1350, 2700), (1351, 2702), (1352, 2704), (1353, 2706), (1354, 2708), (1355, 2710), (1356, 2712), (1357, 2714), (1358, 2716), (1359, 2718), (1360, 2720), (1361, 2722), (1362, 2724), (1363, 2726), (1364, 2728), (1365, 2730), (1366, 2732), (1367, 2734), (1368, 2736), (1369, 2738), (1370, 2740), (1371, 2742), (1372, 2744), (1373, 2746), (1374, 2748), (1375, 2750), (1376, 2752), (1377, 2754), (1378, 2756), (1379, 2758), (1380, 2760), (1381, 2762), (1382, 2764), (1383, 2766), (1384, 2768), (1385, 2770), (1386, 2772), (1387, 2774), (1388, 2776), (1389, 2778), (1390, 2780), (1391, 2782), (1392, 2784), (1393, 2786), (1394, 2788), (1395, 2790), (1396, 2792), (1397, 2794), (1398, 2796), (1399, 2798);
+insert into b values (1400, 2800), (1401, 2802), (1402, 2804), (1403, 2806), (1404, 2808), (1405, 2810), (1406, 2812), (1407, 2814), (1408, 2816), (1409, 2818), (1410, 2820), (1411, 2822), (1412, 2824), (1413, 2826), (1414, 2828), (1415, 2830), (1416, 2832), (1417, 2834), (1418, 2836), (1419, 2838), (1420, 2840), (1421, 2842), (1422, 2844), (1423, 2846), (1424, 2848), (1425, 2850), (1426, 2852), (1427, 2854), (1428, 2856), (1429, 2858), (1430, 2860), (1431, 2862), (1432, 2864), (1433, 2866), (1434, 2868), (1435, 2870), (1436, 2872), (1437, 2874), (1438, 2876), (1439, 2878), (1440, 2880), (1441, 2882), (1442, 2884), (1443, 2886), (1444, 2888), (1445, 2890), (1446, 2892), (1447, 2894), (1448, 2896), (1449, 2898);
+insert into b values (1450, 2900), (1451, 2902), (1452, 2904), (1453, 2906), (1454, 2908), (1455, 2910), (1456, 2912), (1457, 2914), (1458, 2916), (1459, 2918), (1460, 2920), (1461, 2922), (1462, 2924), (1463, 2926), (1464, 2928), (1465, 2930), (1466, 2932), (1467, 2934), (1468, 2936), (1469, 2938), (1470, 2940), (1471, 2942), (1472, 2944), (1473, 2946), (1474, 2948), (1475, 2950), (1476, 2952), (1477, 2954), (1478, 2956), (1479, 2958), (1480, 2960), (1481, 2962), (1482, 2964), (1483, 2966), (1484, 2968), (1485, 2970), (1486, 2972), (1487, 2974), (1488, 2976), (1489, 2978), (1490, 2980), (1491, 2982), (1492, 2984), (1493, 2986), (1494, 2988), (1495, 2990), (1496, 2992), (1497, 2994), (1498, 2996), (1499, 2998);
+insert into b values (1500, 3000), (1501, 3002), (1502, 3004), (1503, 3006), (1504, 3008), (1505, 3010), (1506, 3012), (1507, 3014), (1508, 3016), (1509, 3018), (1510, 3020), (1511, 3022), (1512, 3024), (1513, 3026), (1514, 3028), (1515, 3030), (1516, 3032), (1517, 3034), (1518, 3036), (1519, 3038), (1520, 3040), (1521, 3042), (1522, 3044), (1523, 3046), (1524, 3048), (1525, 3050), (1526, 3052), (1527, 3054), (1528, 3056), (1529, 3058), (1530, 3060), (1531, 3062), (1532, 3064), (1533, 3066), (1534, 3068), (1535, 3070), (1536, 3072), (1537, 3074), (1538, 3076), (1539, 3078), (1540, 3080), (1541, 3082), (1542, 3084), (1543, 3086), (1544, 3088), (1545, 3090), (1546, 3092), (1547, 3094), (1548, 3096), (1549, 3098);
+insert into b values (1550, 3100), (1551, 3102), (1552, 3104), (1553, 3106), (1554, 3108), (1555, 3110), (1556, 3112), (1557, 3114), (1558, 3116), (1559, 3118), (1560, 3120), (1561, 3122), (1562, 3124), (1563, 3126), (1564, 3128), (1565, 3130), (1566, 3132), (1567, 3134), (1568, 3136), (1569, 3138), (1570, 3140), (1571, 3142), (1572, 3144), (1573, 3146), (1574, 3148), (1575, 3150), (1576, 3152), (1577, 3154), (1578, 3156), (1579, 3158), (1580, 3160), (1581, 3162), (1582, 3164), (1583, 3166), (1584, 3168), (1585, 3170), (1586, 3172), (1587, 3174), (1588, 3176), (1589, 3178), (1590, 3180), (1591, 3182), (1592, 3184), (1593, 3186), (1594, 3188), (1595, 3190), (1596, 3192), (1597, 3194), (1598, 3196), (1599, 3198);
+insert into b values (1600, 3200), (1601, 3202), (1602, 3204), (1603, 3206), (1604, 3208), (1605, 3210), (1606, 3212), (1607, 3214), (1608, 3216), (1609, 3218), (1610, 3220), (1611, 3222), (1612, 3224), (1613, 3226), (1614, 3228), (1615, 3230), (1616, 3232), (1617, 3234), (1618, 3236), (1619, 3238), (1620, 3240), (1621, 3242), (1622, 3244), (1623, 3246), (1624, 3248), (1625, 3250), (1626, 3252), (1627, 3254), (1628, 3256), (1629, 3258), (1630, 3260), (1631, 3262), (1632, 3264), (1633, 3266), (1634, 3268), (1635, 3270), (1636, 3272), (1637, 3274), (1638, 3276), (1639, 3278), (1640, 3280), (1641, 3282), (1642, 3284), (1643, 3286), (1644, 3288), (1645, 3290), (1646, 3292), (1647, 3294), (1648, 3296), (1649, 3298);
+insert into b values (1650, 3300), (1651, 3302), (1652, 3304), (1653, 3306), (1654, 3308), (1655, 3310), (1656, 3312), (1657, 3314), (1658, 3316), (1659, 3318), (1660, 3320), (1661, 3322), (1662, 3324), (1663, 3326), (1664, 3328), (1665, 3330), (1666, 3332), (1667, 3334), (1668, 3336), (1669, 3338), (1670, 3340), (1671, 3342), (1672, 3344), (1673, 3346), (1674, 3348), (1675, 3350), (1676, 3352), (1677, 3354), (1678, 3356), (1679, 3358), (1680, 3360), (1681, 3362), (1682, 3364), (1683, 3366), (1684, 3368), (1685, 3370), (1686, 3372), (1687, 3374), (1688, 3376), (1689, 3378), (1690, 3380), (1691, 3382), (1692, 3384), (1693, 3386), (1694, 3388), (1695, 3390), (1696, 3392), (1697, 3394), (1698, 3396), (1699, 3398);
+insert into b values (1700, 3400), (1701, 3402), (1702, 3404), (1703, 3406), (1704, 3408), (1705, 3410), (1706, 3412), (1707, 3414), (1708, 3416), (1709, 3418), (1710, 3420), (1711, 3422), (1712, 3424), (1713, 3426), (1714, 3428), (1715, 3430), (1716, 3432), (1717, 3434), (1718, 3436), (1719, 3438), (1720, 3440), (1721, 3442), (1722, 3444), (1723, 3446), (1724, 3448), (1725, 3450), (1726, 3452), (1727, 3454), (1728, 3456), (1729, 3458), (1730, 3460), (1731, 3462), (1732, 3464), (1733, 3466), (1734, 3468), (1735, 3470), (1736, 3472), (1737, 3474), (1738, 3476), (1739, 3478), (1740, 3480), (1741, 3482), (1742, 3484), (1743, 3486), (1744, 3488), (1745, 3490), (1746, 3492), (1747, 3494), (1748, 3496), (1749, 3498);
+insert into b values (1750, 3500), (1751, 3502), (1752, 3504), (1753, 3506), (1754, 3508), (1755, 3510), (1756, 3512), (1757, 3514), (1758, 3516), (1759, 3518), (1760, 3520), (1761, 3522), (1762, 3524), (1763, 3526), (1764, 3528), (1765, 3530), (1766, 3532), (1767, 3534), (1768, 3536), (1769, 3538), (1770, 3540), (1771, 3542), (1772, 3544), (1773, 3546), (1774, 3548), (1775, 3550), (1776, 3552), (1777, 3554), (1778, 3556), (1779, 3558), (1780, 3560), (1781, 3562), (1782, 3564), (1783, 3566), (1784, 3568), (1785, 3570), (1786, 3572), (1787, 3574), (1788, 3576), (1789, 3578), (1790, 3580), (1791, 3582), (1792, 3584), (1793, 3586), (1794, 3588), (1795, 3590), (1796, 3592), (1797, 3594), (1798, 3596), (1799, 3598);
+insert into b values (1800, 3600), (1801, 3602), (1802, 3604), (1803, 3606), (1804, 3608), (1805, 3610), (1806, 3612), (1807, 3614), (1808, 3616), (1809, 3618), (1810, 3620), (1811, 3622), (1812, 3624), (1813, 3626), (1814, 3628), (1815, 3630), (1816, 3632), (1817, 3634), (1818, 3636), (1819, 3638), (1820, 3640), (1821, 3642), (1822, 3644), (1823, 3646), (1824, 3648), (1825, 3650), (1826, 3652), (1827, 3654), (1828, 3656), (1829, 3658), (1830, 3660), (1831, 3662), (1832, 3664), (1833, 3666), (1834, 3668), (1835, 3670), (1836, 3672), (1837, 3674), (1838, 3676), (1839, 3678), (1840, 3680), (1841, 3682), (1842, 3684), (1843, 3686), (1844, 3688), (1845, 3690), (1846, 3692), (1847, 3694), (1848, 3696), (1849, 3698);
+insert into b values (1850, 3700), (1851, 3702), (1852, 3704), (1853, 3706), (1854, 3708), (1855, 3710), (1856, 3712), (1857, 3714), (1858, 3716), (1859, 3718), (1860, 3720), (1861, 3722), (1862, 3724), (1863, 3726), (1864, 3728), (1865, 3730), (1866, 3732), (1867, 3734), (1868, 3736), (1869, 3738), (1870, 3740), (1871, 3742), (1872, 3744), (1873, 3746), (1874, 3748), (1875, 3750), (1876, 3752), (1877, 3754), (1878, 3756), (1879, 3758), (1880, 3760), (1881, 3762), (1882, 3764), (1883, 3766), (1884, 3768), (1885, 3770), (1886, 3772), (1887, 3774), (1888, 3776), (1889, 3778), (1890, 3780), (1891, 3782), (1892, 3784), (1893, 3786), (1894, 3788), (1895, 3790), (1896, 3792), (1897, 3794), (1898, 3796), (1899, 3798);
+insert into b values (1900, 3800), (1901, 3802), (1902, 3804), (1903, 3806), (1904, 3808), (1905, 3810), (1906, 3812), (1907, 3814), (1908, 3816), (1909, 3818), (1910, 3820), (1911, 3822), (1912, 3824), (1913, 3826), (1914, 3828), (1915, 3830), (1916, 3832), (1917, 3834), (1918, 3836), (1919, 3838), (1920, 3840), (1921, 3842), (1922, 3844), (1923, 3846), (1924, 3848), (1925, 3850), (1926, 3852), (1927, 3854), (1928, 3856), (1929, 3858), (1930, 3860), (1931, 3862), (1932, 3864), (1933, 3866), (1934, 3868), (1935, 3870), (1936, 3872), (1937, 3874), (1938, 3876), (1939, 3878), (1940, 3880), (1941, 3882), (1942, 3884), (1943, 3886), (1944, 3888), (1945, 3890), (1946, 3892), (1947, 3894), (1948, 3896), (1949, 3898);
+insert into b values (1950, 3900), (1951, 3902), (1952, 3904), (1953, 3906), (1954, 3908), (1955, 3910), (1956, 3912), (1957, 3914), (1958, 3916), (1959, 3918), (1960, 3920), (1961, 3922), (1962, 3924), (1963, 3926), (1964, 3928), (1965, 3930), (1966, 3932), (1967, 3934), (1968, 3936), (1969, 3938), (1970, 3940), (1971, 3942), (1972, 3944), (1973, 3946), (1974, 3948), (1975, 3950), (1976, 3952), (1977, 3954), (1978, 3956), (1979, 3958), (1980, 3960), (1981, 3962), (1982, 3964), (1983, 3966), (1984, 3968), (1985, 3970), (1986, 3972), (1987, 3974), (1988, 3976), (1989, 3978), (1990, 3980), (1991, 3982), (1992, 3984), (1993, 3986), (1994, 3988), (1995, 3990), (1996, 3992), (1997, 3994), (1998, 3996), (1999, 3998);
+insert into b values (2000, 4000), (2001, 4002), (2002, 4004), (2003, 4006), (2004, 4008), (2005, 4010), (2006, 4012), (2007, 4014), (2008, 4016), (2009, 4018), (2010, 4020), (2011, 4022), (2012, 4024), (2013, 4026), (2014, 4028), (2015, 4030), (2016, 4032), (2017, 4034), (2018, 4036), (2019, 4038), (2020, 4040), (2021, 4042), (2022, 4044), (2023, 4046), (2024, 4048), (2025, 4050), (2026, 4052), (2027, 4054), (2028, 4056), (2029, 4058), (2030, 4060), (2031, 4062), (2032, 4064), (2033, 4066), (2034, 4068), (2035, 4070), (2036, 4072), (2037, 4074), (2038, 4076), (2039, 4078), (2040, 4080), (2041, 4082), (2042, 4084), (2043, 4086), (2044, 4088), (2045, 4090), (2046, 4092), (2047, 4094), (2048, 4096), (2049, 4098);
+insert into b values (2050, 4100), (2051, 4102), (2052, 4104), (2053, 4106), (2054, 4108), (2055, 4110), (2056, 4112), (2057, 4114), (2058, 4116), (2059, 4118), (2060, 4120), (2061, 4122), (2062, 4124), (2063, 4126), (2064, 4128), (2065, 4130), (2066, 4132), (2067, 4134), (2068, 4136), (2069, 4138), (2070, 4140), (2071, 4142), (2072, 4144), (2073, 4146), (2074, 4148), (2075, 4150), (2076, 4152), (2077, 4154), (2078, 4156), (2079, 4158), (2080, 4160), (2081, 4162), (2082, 4164), (2083, 4166), (2084, 4168), (2085, 4170), (2086, 4172), (2087, 4174), (2088, 4176), (2089, 4178), (2090, 4180), (2091, 4182), (2092, 4184), (2093, 4186), (2094, 4188), (2095, 4190), (2096, 4192), (2097, 4194), (2098, 4196), (2099, 4198);
+insert into b values (2100, 4200), (2101, 4202), (2102, 4204), (2103, 4206), (2104, 4208), (2105, 4210), (2106, 4212), (2107, 4214), (2108, 4216), (2109, 4218), (2110, 4220), (2111, 4222), (2112, 4224), (2113, 4226), (2114, 4228), (2115, 4230), (2116, 4232), (2117, 4234), (2118, 4236), (2119, 4238), (2120, 4240), (2121, 4242), (2122, 4244), (2123, 4246), (2124, 4248), (2125, 4250), (2126, 4252), (2127, 4254), (2128, 4256), (2129, 4258), (2130, 4260), (2131, 4262), (2132, 4264), (2133, 4266), (2134, 4268), (2135, 4270), (2136, 4272), (2137, 4274), (2138, 4276), (2139, 4278), (2140, 4280), (2141, 4282), (2142, 4284), (2143, 4286), (2144, 4288), (2145, 4290), (2146, 4292), (2147, 4294), (2148, 4296), (2149, 4298);
+insert into b values (2150, 4300), (2151, 4302), (2152, 4304), (2153, 4306), (2154, 4308), (2155, 4310), (2156, 4312), (2157, 4314), (2158, 4316), (2159, 4318), (2160, 4320), (2161, 4322), (2162, 4324), (2163, 4326), (2164, 4328), (2165, 4330), (2166, 4332), (2167, 4334), (2168, 4336), (2169, 4338), (2170, 4340), (2171, 4342), (2172, 4344), (2173, 4346), (2174, 4348), (2175, 4350), (2176, 4352), (2177, 4354), (2178, 4356), (2179, 4358), (2180, 4360), (2181, 4362), (2182, 4364), (2183, 4366), (2184, 4368), (2185, 4370), (2186, 4372), (2187, 4374), (2188, 4376), (2189, 4378), (2190, 4380), (2191, 4382), (2192, 4384), (2193, 4386), (2194, 4388), (2195, 4390), (2196, 4392), (2197, 4394), (2198, 4396), (2199, 4398);
+insert into b values (2200, 4400), (2201, 4402), (2202, 4404), (2203, 4406), (2204, 4408), (2205, 4410), (2206, 4412), (2207, 4414), (2208, 4416), (2209, 4418), (2210, 4420), (2211, 4422), (2212, 4424), (2213, 4426), (2214, 4428), (2215, 4430), (2216, 4432), (2217, 4434), (2218, 4436), (2219, 4438), (2220, 4440), (2221, 4442), (2222, 4444), (2223, 4446), (2224, 4448), (2225, 4450), (2226, 4452), (2227, 4454), (2228, 4456), (2229, 4458), (2230, 4460), (2231, 4462), (2232, 4464), (2233, 4466), (2234, 4468), (2235, 4470), (2236, 4472), (2237, 4474), (2238, 4476), (2239, 4478), (2240, 4480), (2241, 4482), (2242, 4484), (2243, 4486), (2244, 4488), (2245, 4490), (2246, 4492), (2247, 4494), (2248, 4496), (2249, 4498);
+insert into b values (2250, 4500), (2251, 4502), (2252, 4504), (2253, 4506), (2254, 4508), (2255, 4510), (2256, 4512), (2257, 4514), (2258, 4516), (2259, 4518), (2260, 4520), (2261, 4522), (2262, 4524), (2263, 4526), (2264, 4528), (2265, 4530), (2266, 4532), (2267, 4534), (2268, 4536), (2269, 4538), (2270, 4540), (2271, 4542), (2272, 4544), (2273, 4546), (2274, 4548), (2275, 4550), (2276, 4552), (2277, 4554), (2278, 4556), (2279, 4558), (2280, 4560), (2281, 4562), (2282, 4564), (2283, 4566), (2284, 4568), (2285, 4570), (2286, 4572), (2287, 4574), (2288, 4576), (2289, 4578), (2290, 4580), (2291, 4582), (2292, 4584), (2293, 4586), (2294, 4588), (2295, 4590), (2296, 4592), (2297, 4594), (2298, 4596), (2299, 4598);
+insert into b values (2300, 4600), (2301, 4602), (2302, 4604), (2303, 4606), (2304, 4608), (2305, 4610), (2306, 4612), (2307, 4614), (2308, 4616), (2309, 4618), (2310, 4620), (2311, 4622), (2312, 4624), (2313, 4626), (2314, 4628), (2315, 4630), (2316, 4632), (2317, 4634), (2318, 4636), (2319, 4638), (2320, 4640), (2321, 4642), (2322, 4644), (2323, 4646), (2324, 4648), (2325, 4650), (2326, 4652), (2327, 4654), (2328, 4656), (2329, 4658), (2330, 4660), (2331, 4662), (2332, 4664), (2333, 4666), (2334, 4668), (2335, 4670), (2336, 4672), (2337, 4674), (2338, 4676), (2339, 4678), (2340, 4680), (2341, 4682), (2342, 4684), (2343, 4686), (2344, 4688), (2345, 4690), (2346, 4692), (2347, 4694), (2348, 4696), (2349, 4698);
+insert into b values (2350, 4700), (2351, 4702), (2352, 4704), (2353, 4706), (2354, 4708), (2355, 4710), (2356, 4712), (2357, 4714), (2358, 4716), (2359, 4718), (2360, 4720), (2361, 4722), (2362, 4724), (2363, 4726), (2364, 4728), (2365, 4730), (2366, 4732), (2367, 4734), (2368, 4736), (2369, 4738), (2370, 4740), (2371, 4742), (2372, 4744), (2373, 4746), (2374, 4748), (2375, 4750), (2376, 4752), (2377, 4754), (2378, 4756), (2379, 4758), (2380, 4760), (2381, 4762), (2382, 4764), (2383, 4766), (2384, 4768), (2385, 4770), (2386, 4772), (2387, 4774), (2388, 4776), (2389, 4778), (2390, 4780), (2391, 4782), (2392, 4784), (2393, 4786), (2394, 4788), (2395, 4790), (2396, 4792), (2397, 4794), (2398, 4796), (2399, 4798);
+insert into b values (2400, 4800), (2401, 4802), (2402, 4804), (2403, 4806), (2404, 4808), (2405, 4810), (2406, 4812), (2407, 4814), (2408, 4816), (2409, 4818), (2410, 4820), (2411, 4822), (2412, 4824), (2413, 4826), (2414, 4828), (2415, 4830), (2416, 4832), (2417, 4834), (2418, 4836), (2419, 4838), (2420, 4840), (2421, 4842), (2422, 4844), (2423, 4846), (2424, 4848), (2425, 4850), (2426, 4852), (2427, 4854), (2428, 4856), (2429, 4858), (2430, 4860), (2431, 4862), (2432, 4864), (2433, 4866), (2434, 4868), (2435, 4870), (2436, 4872), (2437, 4874), (2438, 4876), (2439, 4878), (2440, 4880), (2441, 4882), (2442, 4884), (2443, 4886), (2444, 4888), (2445, 4890), (2446, 4892), (2447, 4894), (2448, 4896), (2449, 4898);
+insert into b values (2450, 4900), (2451, 4902), (2452, 4904), (2453, 4906), (2454, 4908), (2455, 4910), (2456, 4912), (2457, 4914), (2458, 4916), (2459, 4918), (2460, 4920), (2461, 4922), (2462, 4924), (2463, 4926), (2464, 4928), (2465, 4930), (2466, 4932), (2467, 4934), (2468, 4936), (2469, 4938), (2470, 4940), (2471, 4942), (2472, 4944), (2473, 4946), (2474, 4948), (2475, 4950), (2476, 4952), (2477, 4954), (2478, 4956), (2479, 4958), (2480, 4960), (2481, 4962), (2482, 4964), (2483, 4966), (2484, 4968), (2485, 4970), (2486, 4972), (2487, 4974), (2488, 4976), (2489, 4978), (2490, 4980), (2491, 4982), (2492, 4984), (2493, 4986), (2494, 4988), (2495, 4990), (2496, 4992), (2497, 4994), (2498, 4996), (2499, 4998);
+insert into b values (2500, 5000), (2501, 5002), (2502, 5004), (2503, 5006), (2504, 5008), (2505, 5010), (2506, 5012), (2507, 5014), (2508, 5016), (2509, 5018), (2510, 5020), (2511, 5022), (2512, 5024), (2513, 5026), (2514, 5028), (2515, 5030), (2516, 5032), (2517, 5034), (2518, 5036), (2519, 5038), (2520, 5040), (2521, 5042), (2522, 5044), (2523, 5046), (2524, 5048), (2525, 5050), (2526, 5052), (2527, 5054), (2528, 5056), (2529, 5058), (2530, 5060), (2531, 5062), (2532, 5064), (2533, 5066), (2534, 5068), (2535, 5070), (2536, 5072), (2537, 5074), (2538, 5076), (2539, 5078), (2540, 5080), (2541, 5082), (2542, 5084), (2543, 5086), (2544, 5088), (2545, 5090), (2546, 5092), (2547, 5094), (2548, 5096), (2549, 5098);
+insert into b values (2550, 5100), (2551, 5102), (2552, 5104), (2553, 5106), (2554, 5108), (2555, 5110), (2556, 5112), (2557, 5114), (2558, 5116), (2559, 5118), (2560, 5120), (2561, 5122), (2562, 5124), (2563, 5126), (2564, 5128), (2565, 5130), (2566, 5132), (2567, 5134), (2568, 5136), (2569, 5138), (2570, 5140), (2571, 5142), (2572, 5144), (2573, 5146), (2574, 5148), (2575, 5150), (2576, 5152), (2577, 5154), (2578, 5156), (2579, 5158), (2580, 5160), (2581, 5162), (2582, 5164), (2583, 5166), (2584, 5168), (2585, 5170), (2586, 5172), (2587, 5174), (2588, 5176), (2589, 5178), (2590, 5180), (2591, 5182), (2592, 5184), (2593, 5186), (2594, 5188), (2595, 5190), (2596, 5192), (2597, 5194), (2598, 5196), (2599, 5198);
+insert into b values (2600, 5200), (2601, 5202), (2602, 5204), (2603, 5206), (2604, 5208), (2605, 5210), (2606, 5212), (2607, 5214), (2608, 5216), (2609, 5218), (2610, 5220), (2611, 5222), (2612, 5224), (2613, 5226), (2614, 5228), (2615, 5230), (2616, 5232), (2617, 5234), (2618, 5236), (2619, 5238), (2620, 5240), (2621, 5242), (2622, 5244), (2623, 5246), (2624, 5248), (2625, 5250), (2626, 5252), (2627, 5254), (2628, 5256), (2629, 5258), (2630, 5260), (2631, 5262), (2632, 5264), (2633, 5266), (2634, 5268), (2635, 5270), (2636, 5272), (2637, 5274), (2638, 5276), (2639, 5278), (2640, 5280), (2641, 5282), (2642, 5284), (2643, 5286), (2644, 5288), (2645, 5290), (2646, 5292), (2647, 5294), (2648, 5296), (2649, 5298);
+insert into b values (2650, 5300), (2651, 5302), (2652, 5304), (2653, 5306), (2654, 5308), (2655, 5310), (2656, 5312), (2657, 5314), (2658, 5316), (2659, 5318), (2660, 5320), (2661, 5322), (2662, 5324), (2663, 5326), (2664, 5328), (2665, 5330), (2666, 5332), (2667, 5334), (2668, 5336), (2669, 5338), (2670, 5340), (2671, 5342), (2672, 5344), (2673, 5346), (2674, 5348), (2675, 5350), (2676, 5352), (2677, 5354), (2678, 5356), (2679, 5358), (2680, 5360), (2681, 5362), (2682, 5364), (2683, 5366), (2684, 5368), (2685, 5370), (2686, 5372), (2687, 5374), (2688, 5376), (2689, 5378), (2690, 5380), (2691, 5382), (2692, 5384), (2693, 5386), (2694, 5388), (2695, 5390), (2696, 5392), (2697, 5394), (2698, 5396), (2699, 5398);
+insert into b values (2700, 5400), (2701, 5402), (2702, 5404), (2703, 5406), (2704, 5408), (2705, 5410), (2706, 5412), (2707, 5414), (2708, 5416), (2709, 5418), (2710, 5420), (2711, 5422), (2712, 5424), (2713, 5426), (2714, 5428), (2715, 5430), (2716, 5432), (2717, 5434), (2718, 5436), (2719, 5438), (2720, 5440), (2721, 5442), (2722, 5444), (2723, 5446), (2724, 5448), (2725, 5450), (2726, 5452), (2727, 5454), (2728, 5456), (2729, 5458), (2730, 5460), (2731, 5462), (2732, 5464), (2733, 5466), (2734, 5468), (2735, 5470), (2736, 5472), (2737, 5474), (2738, 5476), (2739, 5478), (2740, 5480), (2741, 5482), (2742, 5484), (2743, 5486), (2744, 5488), (2745, 5490), (2746, 5492), (2747, 5494), (2748, 5496), (2749, 5498);
+insert into b values (2750, 5500), (2751, 5502), (2752, 5504), (2753, 5506), (2754, 5508), (2755, 5510), (2756, 5512), (2757, 5514), (2758, 5516), (2759, 5518), (2760, 5520), (2761, 5522), (2762, 5524), (2763, 5526), (2764, 5528), (2765, 5530), (2766, 5532), (2767, 5534), (2768, 5536), (2769, 5538), (2770, 5540), (2771, 5542), (2772, 5544), (2773, 5546), (2774, 5548), (2775, 5550), (2776, 5552), (2777, 5554), (2778, 5556), (2779, 5558), (2780, 5560), (2781, 5562), (2782, 5564), (2783, 5566), (2784, 5568), (2785, 5570), (2786, 5572), (2787, 5574), (2788, 5576), (2789, 5578), (2790, 5580), (2791, 5582), (2792, 5584), (2793, 5586), (2794, 5588), (2795, 5590), (2796, 5592), (2797, 5594), (2798, 5596), (2799, 5598);
+insert into b values (2800, 5600), (2801, 5602), (2802, 5604), (2803, 5606), (2804, 5608), (2805, 5610), (2806, 5612), (2807, 5614), (2808, 5616), (2809, 5618), (2810, 5620), (2811, 5622), (2812, 5624), (2813, 5626), (2814, 5628), (2815, 5630), (2816, 5632), (2817, 5634), (2818, 5636), (2819, 5638), (2820, 5640), (2821, 5642), (2822, 5644), (2823, 5646), (2824, 5648), (2825, 5650), (2826, 5652), (2827, 5654), (2828, 5656), (2829, 5658), (2830, 5660), (2831, 5662), (2832, 5664), (2833, 5666), (2834, 5668), (2835, 5670), (2836, 5672), (2837, 5674), (2838, 5676), (2839, 5678), (2840, 5680), (2841, 5682), (2842, 5684), (2843, 5686), (2844, 5688), (2845, 5690), (2846, 5692), (2847, 5694), (2848, 5696), (2849, 5698);
+insert into b values (2850, 5700), (2851, 5702), (2852, 5704), (2853, 5706), (2854, 5708), (2855, 5710), (2856, 5712), (2857, 5714), (2858, 5716), (2859, 5718), (2860, 5720), (2861, 5722), (2862, 5724), (2863, 5726), (2864, 5728), (2865, 5730), (2866, 5732), (2867, 5734), (2868, 5736), (2869, 5738), (2870, 5740), (2871, 5742), (2872, 5744), (2873, 5746), (2874, 5748), (2875, 5750), (2876, 5752), (2877, 5754), (2878, 5756), (2879, 5758), (2880, 5760), (2881, 5762), (2882, 5764), (2883, 5766), (2884, 5768), (2885, 5770), (2886, 5772), (2887, 5774), (2888, 5776), (2889, 5778), (2890, 5780), (2891, 5782), (2892, 5784), (2893, 5786), (2894, 5788), (2895, 5790), (2896, 5792), (2897, 5794), (2898, 5796), (2899, 5798);
+insert into b values (2900, 5800), (2901, 5802), (2902, 5804), (2903, 5806), (2904, 5808), (2905, 5810), (2906, 5812), (2907, 5814), (2908, 5816), (2909, 5818), (2910, 5820), (2911, 5822), (2912, 5824), (2913, 5826), (2914, 5828), (2915, 5830), (2916, 5832), (2917, 5834), (2918, 5836), (2919, 5838), (2920, 5840), (2921, 5842), (2922, 5844), (2923, 5846), (2924, 5848), (2925, 5850), (2926, 5852), (2927, 5854), (2928, 5856), (2929, 5858), (2930, 5860), (2931, 5862), (2932, 5864), (2933, 5866), (2934, 5868), (2935, 5870), (2936, 5872), (2937, 5874), (2938, 5876), (2939, 5878), (2940, 5880), (2941, 5882), (2942, 5884), (2943, 5886), (2944, 5888), (2945, 5890), (2946, 5892), (2947, 5894), (2948, 5896), (2949, 5898);
+insert into b values (2950, 5900), (2951, 5902), (2952, 5904), (2953, 5906), (2954, 5908), (2955, 5910), (2956, 5912), (2957, 5914), (2958, 5916), (2959, 5918), (2960, 5920), (2961, 5922), (2962, 5924), (2963, 5926), (2964, 5928), (2965, 5930), (2966, 5932), (2967, 5934), (2968, 5936), (2969, 5938), (2970, 5940), (2971, 5942), (2972, 5944), (2973, 5946), (2974, 5948), (2975, 5950), (2976, 5952), (2977, 5954), (2978, 5956), (2979, 5958), (2980, 5960), (2981, 5962), (2982, 5964), (2983, 5966), (2984, 5968), (2985, 5970), (2986, 5972), (2987, 5974), (2988, 5976), (2989, 5978), (2990, 5980), (2991, 5982), (2992, 5984), (2993, 5986), (2994, 5988), (2995, 5990), (2996, 5992), (2997, 5994), (2998, 5996), (2999, 5998);
+insert into c values (0, 0), (1, 1), (2, 2), (3, 3), (4, 4), (5, 5), (6, 6), (7, 7), (8, 8), (9, 9), (0, 10), (1, 11), (2, 12), (3, 13), (4, 14);
+insert into d values (0, 0), (1, 1), (2, 2), (3, 3), (4, 4);
+analyze;
+select count(*), sum(a.id), sum(b.id), sum(c.w) from a, b, c where a.id = b.id and a.k = c.k;
+set enable_hashjoin = false;
+select count(*), sum(a.id), sum(b.id), sum(d.w) from a, b, d where a.id = b.id and a.k = d.k;
+create index c(k, w);
+select count(*), sum(a.id), sum(b.id), sum(c.w) from a, b, c where a.id = b.id and a.k = c.k;
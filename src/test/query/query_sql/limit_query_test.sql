@@ -0,0 +1,30 @@
+create table t (id int, g int, v float, name char(8));
+create index t(id);
+insert into t values (5, 1, 0.5, 'e');
+insert into t values (3, 2, 1.5, 'c');
+insert into t values (1, 1, 2.5, 'a');
+insert into t values (4, 2, 0.5, 'd');
+insert into t values (2, 1, 1.5, 'b');
+select id, v from t order by v desc, id limit 3;
+select id, v from t order by v desc, id limit 2 offset 2;
+select id from t order by id limit 2;
+select id from t order by id limit 2 offset 1;
+select id from t where id > 1 order by id limit 2 offset 2;
+select id from t order by g, id limit 10 offset 5;
+select id from t order by id limit 3 offset 7;
+select id from t limit 0;
+select id from t order by id limit -1;
+select id from t order by id limit 1 offset -1;
+select id from t order by id limit 2147483647 offset 2147483647;
+create table u (a int, b float, c int, s char(4));
+create index u(a);
+create index u(b);
+create index u(c, a);
+insert into u values (1, 1.0, 10, 'x');
+insert into u values (2, 2.5, 10, 'y');
+insert into u values (3, 3.0, 20, 'x');
+insert into u values (4, 4.5, 20, 'y');
+insert into u values (5, -0.5, 20, 'z');
+select a, b from u order by b desc limit 2;
+select a from u order by c, a desc limit 3 offset 1;
+select a, b from u where a > 1 order by b limit 2;
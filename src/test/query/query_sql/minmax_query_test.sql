@@ -0,0 +1,19 @@
+create table t (a int, b float, c int, s char(4));
+create index t(a);
+create index t(b);
+create index t(c, a);
+insert into t values (1, 1.0, 10, 'x');
+insert into t values (2, 2.5, 10, 'y');
+insert into t values (3, 3.0, 20, 'x');
+insert into t values (4, 4.5, 20, 'y');
+insert into t values (5, -0.5, 20, 'z');
+select min(a) from t where c = 20;
+select max(a) from t where c = 20;
+select min(a), max(a) from t where c = 10;
+select max(a) from t where c = 99;
+select min(b) from t;
+select max(b) from t;
+select min(a) from t;
+select max(c) from t;
+delete from t where a = 5;
+select max(a) from t where c = 20;
@@ -0,0 +1,12 @@
+create table t (a int, b float, c int, s char(4));
+create index t(a);
+create index t(b);
+create index t(c, a);
+insert into t values (1, 1.0, 10, 'x');
+insert into t values (2, 2.5, 10, 'y');
+insert into t values (3, 3.0, 20, 'x');
+insert into t values (4, 4.5, 20, 'y');
+insert into t values (5, -0.5, 20, 'z');
+select a, b from t order by c desc, b;
+select s, a from t order by s, a desc;
+select s, c, a from t order by s desc, c, a;
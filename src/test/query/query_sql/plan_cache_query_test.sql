@@ -0,0 +1,30 @@
+create table t (a int, b float, c int, s char(4));
+create index t(a);
+create index t(b);
+create index t(c, a);
+insert into t values (1, 1.0, 10, 'x');
+insert into t values (2, 2.5, 10, 'y');
+insert into t values (3, 3.0, 20, 'x');
+insert into t values (4, 4.5, 20, 'y');
+insert into t values (5, -0.5, 20, 'z');
+select a from t where a > 2 order by a;
+select a from t where a > 2.5 order by a;
+select a from t where a > 2 order by a;
+select a from t where a >= 2.5 order by a;
+select a from t where a < 2.5 order by a;
+select a from t where a = 3.0;
+select a from t where a = 3.5;
+select a from t where a = 3;
+select a from t where a <= 2147483648.0 order by a;
+select a from t where b > 2 order by b;
+select a from t where b > 2.5 order by b;
+select a from t where b > 2 order by b;
+select a from t where b = 3;
+select a from t where b = 2.5;
+select a from t where b = 3;
+select count(*) from t where a > 1 and b < 4;
+select count(*) from t where a > 1.5 and b < 4;
+select count(*) from t where a > 1 and b < 4;
+update t set c = 30 where a = 5;
+update t set c = 20.0 where a = 5;
+select c from t where a = 5;
@@ -0,0 +1,23 @@
+create table t (a int, b float, c int, s char(4));
+create index t(a);
+create index t(b);
+create index t(c, a);
+insert into t values (1, 1.0, 10, 'x');
+insert into t values (2, 2.5, 10, 'y');
+insert into t values (3, 3.0, 20, 'x');
+insert into t values (4, 4.5, 20, 'y');
+insert into t values (5, -0.5, 20, 'z');
+prepare pa as select a from t where a > ? order by a;
+execute pa (2);
+execute pa (4.0);
+execute pa (2.5);
+execute pa (0);
+prepare pb as select a from t where b <= ? order by b;
+execute pb (2);
+execute pb (2.5);
+prepare pc as select min(a), max(a) from t where c = ?;
+execute pc (10);
+execute pc (20);
+execute pc (30);
+create index t(s);
+execute pa (3);
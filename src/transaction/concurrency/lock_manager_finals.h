@@ -7,21 +7,26 @@
 #include <vector>
 
 #include "common/config_finals.h"
+#include "common/predicate_finals.h"
 #include "common/value_finals.h"
 #include "storage/memory_pool_manager.h"
 #include "transaction/transaction_finals.h"
 
+// 一个表上的间隙锁：各列取值落在 [lower, upper] 中的记录，开闭由 *_is_closed 决定。
+// 区间在构造时编译成谓词，判断记录是否落在间隙内时不再逐列分派类型
 class Gap
 {
     friend class IndexScanExecutor;
 
 public:
-    Gap(TabMeta *tab_meta, char *upper, char *lower, std::vector<int> upper_is_closed, std::vector<int> lower_is_closed, const std::vector<int> &col_idx, PoolManager *memory_pool_manager) : memory_pool_manager_(memory_pool_manager), upper_(upper), lower_(lower), col_tot_len(tab_meta->col_tot_len), upper_is_closed_(std::move(upper_is_closed)), lower_is_closed_(std::move(lower_is_closed))
+    Gap(TabMeta *tab_meta, char *upper, char *lower, std::vector<int> upper_is_closed, std::vector<int> lower_is_closed, const std::vector<int> &col_idx, PoolManager *memory_pool_manager) : memory_pool_manager_(memory_pool_manager), upper_(upper), lower_(lower), col_tot_len(tab_meta->col_tot_len)
     {
-        cols.reserve(col_idx.size());
         for (auto idx : col_idx)
         {
-            cols.push_back(tab_meta->cols[idx]);
+            auto &col = tab_meta->cols[idx];
+            Predicate::Operand value{0, col.offset, col.len, col.type};
+            range_.add(value, upper_is_closed[idx] ? OP_LE : OP_LT, upper_ + col.offset);
+            range_.add(value, lower_is_closed[idx] ? OP_GE : OP_GT, lower_ + col.offset);
         }
     }
 
@@ -31,134 +36,14 @@ public:
         memory_pool_manager_->deallocate(lower_, col_tot_len);
     }
 
-    bool overlap(const char *key) const
-    {
-        for (auto &col : cols)
-        {
-            switch (col.type)
-            {
-            case ColType::TYPE_INT:
-            {
-                auto up = *(int *)(upper_ + col.offset);
-                auto low = *(int *)(lower_ + col.offset);
-                auto value = *(int *)(key + col.offset);
-                if (upper_is_closed_[col.idx])
-                {
-                    if (value > up)
-                    {
-                        return false;
-                    }
-                }
-                else
-                {
-                    if (value >= up)
-                    {
-                        return false;
-                    }
-                }
-                if (lower_is_closed_[col.idx])
-                {
-                    if (value < low)
-                    {
-                        return false;
-                    }
-                }
-                else
-                {
-                    if (value <= low)
-                    {
-                        return false;
-                    }
-                }
-                break;
-            }
-            case ColType::TYPE_FLOAT:
-            {
-                auto up = *(float *)(upper_ + col.offset);
-                auto low = *(float *)(lower_ + col.offset);
-                auto value = *(float *)(key + col.offset);
-                if (upper_is_closed_[col.idx])
-                {
-                    if (value > up)
-                    {
-                        return false;
-                    }
-                }
-                else
-                {
-                    if (value >= up)
-                    {
-                        return false;
-                    }
-                }
-                if (lower_is_closed_[col.idx])
-                {
-                    if (value < low)
-                    {
-                        return false;
-                    }
-                }
-                else
-                {
-                    if (value <= low)
-                    {
-                        return false;
-                    }
-                }
-                break;
-            }
-            case ColType::TYPE_STRING:
-            {
-                auto up = upper_ + col.offset;
-                auto low = lower_ + col.offset;
-                auto value = key + col.offset;
-
-                auto upcmp = memcmp(value, up, col.len);
-                auto lowcmp = memcmp(value, low, col.len);
-
-                if (upper_is_closed_[col.idx])
-                {
-                    if (upcmp > 0)
-                    {
-                        return false;
-                    }
-                }
-                else
-                {
-                    if (upcmp >= 0)
-                    {
-                        return false;
-                    }
-                }
-                if (lower_is_closed_[col.idx])
-                {
-                    if (lowcmp < 0)
-                    {
-                        return false;
-                    }
-                }
-                else
-                {
-                    if (lowcmp <= 0)
-                    {
-                        return false;
-                    }
-                }
-                break;
-            }
-            }
-        }
-        return true;
-    }
+    bool overlap(const char *key) const { return range_.eval(key); }
 
 private:
     PoolManager *memory_pool_manager_;
     char *upper_;
     char *lower_;
     int col_tot_len;
-    std::vector<ColMeta> cols;
-    std::vector<int> upper_is_closed_;
-    std::vector<int> lower_is_closed_;
+    Predicate range_;
 };
 
 class LockManager